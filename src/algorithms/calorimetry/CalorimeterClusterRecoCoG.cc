@@ -56,10 +56,10 @@ void CalorimeterClusterRecoCoG::process(const CalorimeterClusterRecoCoG::Input&
   const auto [proto, mchitlinks, mchitassociations] = input;
   auto [clusters, links, associations]              = output;
 
-  // Check if truth associations are possible
-  const bool do_assoc = mchitlinks != nullptr && !mchitlinks->empty();
+  // Check if truth associations are possible (and wanted)
+  const bool do_assoc = !m_data_mode.dataOnly() && mchitlinks != nullptr && !mchitlinks->empty();
   if (!do_assoc) {
-    debug("Provided MCRecoCalorimeterHitLink collection is empty. No truth associations "
+    debug("Data-only mode or empty MCRecoCalorimeterHitLink collection. No truth associations "
           "will be performed.");
   }
   // Build fast lookup once per event using podio::LinkNavigator
@@ -31,6 +31,7 @@
 #include <utility>
 
 #include "CalorimeterClusterRecoCoGConfig.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 static double constWeight(double /*E*/, double /*tE*/, double /*p*/, int /*type*/) { return 1.0; }
@@ -80,6 +81,7 @@ public:
 
 private:
   std::function<double(double, double, double, int)> weightFunc;
+  const algorithms::DataModeSvc& m_data_mode = algorithms::DataModeSvc::instance();
 
 private:
   std::optional<edm4eic::MutableCluster> reconstruct(const edm4eic::ProtoCluster& pcl) const;
@@ -17,10 +17,10 @@
 #include <DD4hep/Readout.h>
 #include <DDSegmentation/BitFieldCoder.h>
 #include <Evaluator/DD4hepUnits.h>
-#include <algorithms/service.h>
 #include <edm4eic/MCRecoCalorimeterHitAssociationCollection.h>
 #include <edm4hep/CaloHitContributionCollection.h>
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 #include <podio/RelationRange.h>
 #include <podio/detail/Link.h>
 #include <podio/detail/LinkCollectionImpl.h>
@@ -35,12 +35,12 @@
 #include <stdexcept>
 #include <string>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "algorithms/calorimetry/CalorimeterHitDigiConfig.h"
-#include "services/evaluator/EvaluatorSvc.h"
+#include "algorithms/interfaces/CounterRNG.h"
+#include "algorithms/interfaces/SortedGrouping.h"
 
 using namespace dd4hep;
 
@@ -82,6 +82,17 @@ void CalorimeterHitDigi::init() {
   tRes    = m_cfg.tRes / dd4hep::ns;
   stepTDC = dd4hep::ns / m_cfg.resolutionTDC;
 
+  // zero suppression, as in CalorimeterHitReco
+  // Should set either zeroSuppressionThresholdFactor or zeroSuppressionThresholdValue, not both
+  if (m_cfg.zeroSuppressionThresholdFactor * m_cfg.zeroSuppressionThresholdValue != 0) {
+    error("zeroSuppressionThresholdFactor = {}, zeroSuppressionThresholdValue = {}. Only one of "
+          "these should be non-zero.",
+          m_cfg.zeroSuppressionThresholdFactor, m_cfg.zeroSuppressionThresholdValue);
+    throw std::runtime_error("Zero suppression threshold misconfigured");
+  }
+  thresholdADC = m_cfg.zeroSuppressionThresholdFactor * m_cfg.pedSigmaADC +
+                 m_cfg.zeroSuppressionThresholdValue;
+
   // sanity checks
   if (m_cfg.readout.empty()) {
     error("readoutClass is not provided, it is needed to know the fields in readout ids");
@@ -109,20 +120,12 @@ void CalorimeterHitDigi::init() {
   }
   id_mask = ~id_inverse_mask;
 
-  std::function hit_to_map = [this](const edm4hep::SimCalorimeterHit& h) {
-    std::unordered_map<std::string, double> params;
-    for (const auto& p : id_spec.fields()) {
-      const std::string& name                  = p.first;
-      const dd4hep::IDDescriptor::Field* field = p.second;
-      params.emplace(name, field->value(h.getCellID()));
-      trace("{} = {}", name, field->value(h.getCellID()));
-    }
-    return params;
-  };
-
-  auto& serviceSvc = algorithms::ServiceSvc::instance();
-  corrMeanScale =
-      serviceSvc.service<EvaluatorSvc>("EvaluatorSvc")->compile(m_cfg.corrMeanScale, hit_to_map);
+  corrMeanScale.compile(m_cfg.corrMeanScale, id_spec);
+  if (corrMeanScale.isConstant()) {
+    debug("corrMeanScale is constant: {}", corrMeanScale(0));
+  } else {
+    debug("corrMeanScale depends on fields: {}", fmt::join(corrMeanScale.referencedFields(), ", "));
+  }
 
   std::map<std::string, readout_enum> readoutTypes{{"simple", kSimpleReadout},
                                                    {"poisson_photon", kPoissonPhotonReadout},
@@ -139,41 +142,37 @@ void CalorimeterHitDigi::process(const CalorimeterHitDigi::Input& input,
 
   const auto [headers, simhits]    = input;
   auto [rawhits, links, rawassocs] = output;
+  const bool data_only             = m_data_mode.dataOnly();
 
-  // local random generator
-  auto seed = m_uid.getUniqueID(*headers, name());
-  std::default_random_engine generator(seed);
-  std::normal_distribution<double> gaussian;
+  // random streams per merged cell, independent of the order of the cells
+  const auto stream_key = m_uid.getStreamKey(*headers, name());
 
   // find the hits that belong to the same group (for merging)
-  std::unordered_map<uint64_t, std::vector<std::size_t>> merge_map;
-  std::size_t ix = 0;
+  thread_local SortedGrouping<uint64_t> merge_groups;
+  merge_groups.clear();
+  merge_groups.reserve(simhits->size());
   for (const auto& ahit : *simhits) {
     uint64_t hid = ahit.getCellID() & id_mask;
 
     trace("org cell ID in {:s}: {:#064b}", m_cfg.readout, ahit.getCellID());
     trace("new cell ID in {:s}: {:#064b}", m_cfg.readout, hid);
 
-    merge_map[hid].push_back(ix);
-
-    ix++;
+    merge_groups.add(hid);
   }
+  merge_groups.sort();
 
   // signal sum
   // NOTE: we take the cellID of the most energetic hit in this group so it is a real cellID from an MC hit
-  for (const auto& [id, ixs] : merge_map) {
-
-    // create hit and association in advance
-    edm4hep::MutableRawCalorimeterHit rawhit;
-    std::vector<edm4eic::MutableMCRecoCalorimeterHitLink> links_staging;
-    std::vector<edm4eic::MutableMCRecoCalorimeterHitAssociation> rawassocs_staging;
+  for (const auto& [id, ixs] : merge_groups.groups()) {
+    CounterRNG generator(stream_key, id);
+    std::normal_distribution<double> gaussian;
 
     double edep      = 0;
     double time      = std::numeric_limits<double>::max();
     double max_edep  = 0;
     auto leading_hit = (*simhits)[ixs[0]];
     // sum energy, take time from the most energetic hit
-    for (unsigned long i : ixs) {
+    for (std::size_t i : ixs) {
       auto hit = (*simhits)[i];
 
       double timeC = std::numeric_limits<double>::max();
@@ -193,17 +192,6 @@ void CalorimeterHitDigi::process(const CalorimeterHitDigi::Input& input,
         leading_hit = hit;
         time        = std::min(timeC, time);
       }
-
-      edm4eic::MutableMCRecoCalorimeterHitAssociation assoc;
-      assoc.setRawHit(rawhit);
-      assoc.setSimHit(hit);
-      assoc.setWeight(hit.getEnergy());
-      rawassocs_staging.push_back(assoc);
-      edm4eic::MutableMCRecoCalorimeterHitLink link;
-      link.setFrom(rawhit);
-      link.setTo(hit);
-      link.setWeight(hit.getEnergy());
-      links_staging.push_back(link);
     }
     if (time > m_cfg.capTime) {
       debug("retaining hit, even though time %f ns > %f ns", time / dd4hep::ns,
@@ -218,7 +206,7 @@ void CalorimeterHitDigi::process(const CalorimeterHitDigi::Input& input,
                             std::pow(m_cfg.eRes[1], 2) + std::pow(m_cfg.eRes[2] / (edep), 2))
             : 0;
 
-    double corrMeanScale_value = corrMeanScale(leading_hit);
+    double corrMeanScale_value = corrMeanScale(leading_hit.getCellID());
 
     double ped = m_cfg.pedMeanADC + gaussian(generator) * m_cfg.pedSigmaADC;
 
@@ -265,18 +253,34 @@ void CalorimeterHitDigi::process(const CalorimeterHitDigi::Input& input,
             adc, time, m_cfg.capTime, tdc, corrMeanScale_value);
     }
 
+    const auto amplitude = adc > m_cfg.capADC ? m_cfg.capADC : adc;
+
+    // zero suppression: no raw hit, links or associations are created
+    if (m_cfg.zeroSuppression && amplitude < m_cfg.pedMeanADC + thresholdADC) {
+      trace("suppressed hit {:#018x}: amplitude {} < {}", leading_hit.getCellID(), amplitude,
+            m_cfg.pedMeanADC + thresholdADC);
+      continue;
+    }
+
+    auto rawhit = rawhits->create();
     rawhit.setCellID(leading_hit.getCellID());
-    rawhit.setAmplitude(adc > m_cfg.capADC ? m_cfg.capADC : adc);
+    rawhit.setAmplitude(amplitude);
     rawhit.setTimeStamp(tdc);
-    rawhits->push_back(rawhit);
 
-    for (auto& link : links_staging) {
-      link.setWeight(link.getWeight() / edep);
-      links->push_back(link);
+    if (data_only) {
+      continue;
     }
-    for (auto& assoc : rawassocs_staging) {
-      assoc.setWeight(assoc.getWeight() / edep);
-      rawassocs->push_back(assoc);
+    for (std::size_t i : ixs) {
+      auto hit = (*simhits)[i];
+
+      auto link = links->create();
+      link.setFrom(rawhit);
+      link.setTo(hit);
+      link.setWeight(hit.getEnergy() / edep);
+      auto assoc = rawassocs->create();
+      assoc.setRawHit(rawhit);
+      assoc.setSimHit(hit);
+      assoc.setWeight(hit.getEnergy() / edep);
     }
   }
 }
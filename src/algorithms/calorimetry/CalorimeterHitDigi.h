@@ -21,11 +21,12 @@
 #include <edm4hep/RawCalorimeterHitCollection.h>
 #include <edm4hep/SimCalorimeterHitCollection.h>
 #include <stdint.h>
-#include <functional>
 #include <string>
 #include <string_view>
 
 #include "CalorimeterHitDigiConfig.h"
+#include "CellIDExpression.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/UniqueIDGenSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
@@ -56,9 +57,12 @@ private:
   // unitless counterparts of inputs
   double stepTDC{0}, tRes{0};
 
+  // zero-suppression threshold above pedestal
+  double thresholdADC{0};
+
   uint64_t id_mask{0};
 
-  std::function<double(const edm4hep::SimCalorimeterHit& h)> corrMeanScale;
+  CellIDExpression corrMeanScale;
 
   dd4hep::IDDescriptor id_spec;
 
@@ -67,7 +71,8 @@ private:
 
 private:
   const algorithms::GeoSvc& m_geo         = algorithms::GeoSvc::instance();
-  const algorithms::UniqueIDGenSvc& m_uid = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::UniqueIDGenSvc& m_uid    = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::DataModeSvc& m_data_mode = algorithms::DataModeSvc::instance();
 };
 
 } // namespace eicrecon
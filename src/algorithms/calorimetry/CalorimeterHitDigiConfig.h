@@ -34,6 +34,13 @@ struct CalorimeterHitDigiConfig {
   double resolutionTDC{1};
   std::string corrMeanScale{"1.0"};
 
+  // zero suppression, with the same threshold as CalorimeterHitReco: raw hits with
+  // amplitude < pedMeanADC + thresholdFactor * pedSigmaADC + thresholdValue are dropped
+  // together with their links and associations (set only one of factor and value)
+  bool zeroSuppression{false};
+  double zeroSuppressionThresholdFactor{0};
+  double zeroSuppressionThresholdValue{0};
+
   // signal sums
   std::string readout{""};
   std::vector<std::string> fields{};
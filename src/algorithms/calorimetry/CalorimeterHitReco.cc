@@ -36,7 +36,6 @@
 #include <vector>
 
 #include "algorithms/calorimetry/CalorimeterHitRecoConfig.h"
-#include "services/evaluator/EvaluatorSvc.h"
 
 using namespace dd4hep;
 
@@ -120,19 +119,7 @@ void CalorimeterHitReco::init() {
 
   id_spec = m_detector->readout(m_cfg.readout).idSpec();
 
-  std::function hit_to_map = [this](const edm4hep::RawCalorimeterHit& h) {
-    std::unordered_map<std::string, double> params;
-    for (const auto& p : id_spec.fields()) {
-      const std::string& name                  = p.first;
-      const dd4hep::IDDescriptor::Field* field = p.second;
-      params.emplace(name, field->value(h.getCellID()));
-      trace("{} = {}", name, field->value(h.getCellID()));
-    }
-    return params;
-  };
-
-  auto& serviceSvc = algorithms::ServiceSvc::instance();
-  sampFrac = serviceSvc.service<EvaluatorSvc>("EvaluatorSvc")->compile(m_cfg.sampFrac, hit_to_map);
+  sampFrac.compile(m_cfg.sampFrac, id_spec);
 
   // local detector name has higher priority
   if (!m_cfg.localDetElement.empty()) {
@@ -197,7 +184,7 @@ void CalorimeterHitReco::process(const CalorimeterHitReco::Input& input,
                         : -1;
 
     // convert ADC to energy
-    float sampFrac_value = sampFrac(rh);
+    float sampFrac_value = sampFrac(cellID);
     float energy         = (((signed)rh.getAmplitude() - (signed)m_cfg.pedMeanADC)) /
                            static_cast<float>(m_cfg.capADC) * m_cfg.dyRangeADC / sampFrac_value;
 
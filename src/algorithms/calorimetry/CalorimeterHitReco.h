@@ -19,12 +19,12 @@
 #include <edm4hep/RawCalorimeterHitCollection.h>
 #include <stdint.h>
 #include <cstddef>
-#include <functional>
 #include <gsl/pointers>
 #include <string>
 #include <string_view>
 
 #include "CalorimeterHitRecoConfig.h"
+#include "CellIDExpression.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -51,7 +51,7 @@ private:
   double thresholdADC{0};
   double stepTDC{0};
 
-  std::function<double(const edm4hep::RawCalorimeterHit& h)> sampFrac;
+  CellIDExpression sampFrac;
 
   dd4hep::IDDescriptor id_spec;
   dd4hep::BitFieldCoder* id_dec = nullptr;
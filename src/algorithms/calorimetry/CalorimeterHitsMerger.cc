@@ -33,7 +33,6 @@
 #include <vector>
 
 #include "algorithms/calorimetry/CalorimeterHitsMergerConfig.h"
-#include "services/evaluator/EvaluatorSvc.h"
 
 namespace eicrecon {
 
@@ -78,18 +77,7 @@ void CalorimeterHitsMerger::init() {
     return;
   }
 
-  // lambda to translate IDDescriptor fields into function parameters
-  std::function hit_transform = [this](const edm4eic::CalorimeterHit& hit) {
-    std::unordered_map<std::string, double> params;
-    for (const auto& name_field : id_desc.fields()) {
-      params.emplace(name_field.first, name_field.second->value(hit.getCellID()));
-      trace("{} = {}", name_field.first, name_field.second->value(hit.getCellID()));
-    }
-    return params;
-  };
-
   // loop through provided readout fields
-  auto& svc          = algorithms::ServiceSvc::instance();
   std::size_t iField = 0;
   for (std::string& field : fields) {
 
@@ -97,8 +85,7 @@ void CalorimeterHitsMerger::init() {
     const std::string field_transform = transforms.at(iField);
 
     // set transformation for each field
-    ref_maps[field] =
-        svc.service<EvaluatorSvc>("EvaluatorSvc")->compile(field_transform, hit_transform);
+    ref_maps[field].compile(field_transform, id_desc);
     trace("{}: using transformation '{}'", field, field_transform);
     ++iField;
   } // end field loop
@@ -184,8 +171,8 @@ void CalorimeterHitsMerger::build_merge_map(const edm4eic::CalorimeterHitCollect
 
       // apply mapping to field if provided,
       // otherwise copy value of field
-      if (ref_maps.contains(name_field.first)) {
-        ref_fields.emplace_back(name_field.first, ref_maps[name_field.first](hit));
+      if (const auto it = ref_maps.find(name_field.first); it != ref_maps.end()) {
+        ref_fields.emplace_back(name_field.first, static_cast<int>(it->second(hit.getCellID())));
       } else {
         ref_fields.emplace_back(name_field.first,
                                 id_decoder->get(hit.getCellID(), name_field.first));
@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "CalorimeterHitsMergerConfig.h"
+#include "CellIDExpression.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -37,7 +38,6 @@ namespace eicrecon {
 // aliases for convenience
 using MergeMap = std::unordered_map<uint64_t, std::vector<std::size_t>>;
 using RefField = std::pair<std::string, int>;
-using MapFunc  = std::function<int(const edm4eic::CalorimeterHit&)>;
 
 using CalorimeterHitsMergerAlgorithm =
     algorithms::Algorithm<algorithms::Input<edm4eic::CalorimeterHitCollection>,
@@ -60,7 +60,7 @@ private:
   uint64_t ref_mask{0};
 
 private:
-  mutable std::map<std::string, MapFunc> ref_maps;
+  std::map<std::string, CellIDExpression> ref_maps;
   dd4hep::IDDescriptor id_desc;
   dd4hep::BitFieldCoder* id_decoder;
 
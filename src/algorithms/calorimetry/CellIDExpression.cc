@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <DD4hep/IDDescriptor.h>
+#include <algorithms/service.h>
+#include <cctype>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "CellIDExpression.h"
+#include "services/evaluator/EvaluatorSvc.h"
+
+namespace eicrecon {
+
+namespace {
+
+  /// Identifiers (C++ names) appearing in `expr`
+  std::set<std::string> identifiers(const std::string& expr) {
+    std::set<std::string> result;
+    std::size_t pos = 0;
+    while (pos < expr.size()) {
+      const auto c = static_cast<unsigned char>(expr[pos]);
+      if (std::isalpha(c) != 0 || c == '_') {
+        std::size_t end = pos + 1;
+        while (end < expr.size() &&
+               (std::isalnum(static_cast<unsigned char>(expr[end])) != 0 || expr[end] == '_')) {
+          ++end;
+        }
+        result.insert(expr.substr(pos, end - pos));
+        pos = end;
+      } else if (std::isdigit(c) != 0 || c == '.') {
+        // skip numeric literals, including exponents and suffixes (e.g. 1e-3f)
+        ++pos;
+        while (pos < expr.size() &&
+               (std::isalnum(static_cast<unsigned char>(expr[pos])) != 0 || expr[pos] == '.' ||
+                ((expr[pos] == '+' || expr[pos] == '-') &&
+                 (expr[pos - 1] == 'e' || expr[pos - 1] == 'E')))) {
+          ++pos;
+        }
+      } else {
+        ++pos;
+      }
+    }
+    return result;
+  }
+
+} // namespace
+
+void CellIDExpression::compile(const std::string& expr, const dd4hep::IDDescriptor& id_spec) {
+  std::function cellID_to_map = [id_spec](CellID cellID) {
+    std::unordered_map<std::string, double> params;
+    for (const auto& [name, field] : id_spec.fields()) {
+      params.emplace(name, field->value(cellID));
+    }
+    return params;
+  };
+
+  auto& serviceSvc = algorithms::ServiceSvc::instance();
+  m_func = serviceSvc.service<EvaluatorSvc>("EvaluatorSvc")->compile(expr, cellID_to_map);
+
+  m_fields.clear();
+  m_key_mask     = 0;
+  const auto ids = identifiers(expr);
+  for (const auto& [name, field] : id_spec.fields()) {
+    if (ids.contains(name)) {
+      m_fields.push_back(name);
+      m_key_mask |= field->mask();
+    }
+  }
+
+  {
+    std::unique_lock lock(m_cache_mutex);
+    m_cache.clear();
+  }
+  m_constant.reset();
+  if (m_fields.empty()) {
+    m_constant = m_func(0);
+  }
+}
+
+double CellIDExpression::operator()(CellID cellID) const {
+  if (m_constant) {
+    return *m_constant;
+  }
+
+  const CellID key = cellID & m_key_mask;
+  {
+    std::shared_lock lock(m_cache_mutex);
+    if (auto it = m_cache.find(key); it != m_cache.end()) {
+      return it->second;
+    }
+  }
+
+  const double value = m_func(cellID);
+  std::unique_lock lock(m_cache_mutex);
+  m_cache.emplace(key, value);
+  return value;
+}
+
+} // namespace eicrecon
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <DD4hep/IDDescriptor.h>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eicrecon {
+
+/**
+ * @brief EvaluatorSvc expression of the readout fields of a cellID, memoized
+ * per value of the fields it references.
+ *
+ * At compile time the expression is scanned for the readout field names it
+ * uses. Expressions without any field are evaluated once. Otherwise results
+ * are cached under `cellID & keyMask()`, where the mask covers only the
+ * referenced fields, so that e.g. a sampling fraction depending on `layer`
+ * is evaluated once per layer rather than once per hit. The cache fills on
+ * first access and may be shared between concurrent callers.
+ */
+class CellIDExpression {
+public:
+  using CellID = std::uint64_t;
+
+  /// Compile `expr` with variables named after the fields of `id_spec`
+  void compile(const std::string& expr, const dd4hep::IDDescriptor& id_spec);
+
+  double operator()(CellID cellID) const;
+
+  bool isConstant() const { return m_constant.has_value(); }
+  CellID keyMask() const { return m_key_mask; }
+  const std::vector<std::string>& referencedFields() const { return m_fields; }
+
+private:
+  std::function<double(CellID)> m_func;
+  std::optional<double> m_constant;
+  CellID m_key_mask{0};
+  std::vector<std::string> m_fields;
+
+  mutable std::shared_mutex m_cache_mutex;
+  mutable std::unordered_map<CellID, double> m_cache;
+};
+
+} // namespace eicrecon
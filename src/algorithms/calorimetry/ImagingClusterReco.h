@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "ImagingClusterRecoConfig.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -65,6 +66,8 @@ public:
   void process(const Input& input, const Output& output) const final;
 
 private:
+  const algorithms::DataModeSvc& m_data_mode = algorithms::DataModeSvc::instance();
+
   std::vector<edm4eic::MutableCluster>
   reconstruct_cluster_layers(const edm4eic::ProtoCluster& pcl) const;
 
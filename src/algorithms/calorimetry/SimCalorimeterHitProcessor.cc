@@ -17,37 +17,20 @@
 #include <podio/RelationRange.h>
 #include <cmath>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
 #include <gsl/pointers>
 #include <limits>
 #include <stdexcept>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include "algorithms/calorimetry/SimCalorimeterHitProcessorConfig.h"
+#include "algorithms/interfaces/SortedGrouping.h"
 
 using namespace dd4hep;
 
-// Define necessary hash functions
-namespace std {
-
-// Hash specialization for std::tuple<edm4hep::MCParticle, uint64_t, int>
-// --> provided because std::hash is not defined for std::tuple in the used standard library
-template <> struct hash<std::tuple<edm4hep::MCParticle, uint64_t, int>> {
-  size_t operator()(const std::tuple<edm4hep::MCParticle, uint64_t, int>& key) const noexcept {
-    const auto& [particle, cellID, timeID] = key;
-    size_t h1                              = hash<podio::ObjectID>{}(particle.getObjectID());
-    size_t h2                              = hash<uint64_t>{}(cellID);
-    size_t h3                              = hash<int>{}(timeID);
-    return ((h1 ^ (h2 << 1)) >> 1) ^ (h3 << 1);
-  }
-};
-
-} // namespace std
-
 // unnamed namespace for internal utility
 namespace {
 // Lookup primary MCParticle @TODO this should be a shared utility function in the edm4xxx
@@ -134,89 +117,147 @@ void SimCalorimeterHitProcessor::init() {
     debug("ID mask in {:s}: {:#064b}", m_cfg.readout, m_contribution_id_mask.value());
   }
 
-  // get reference position for attenuating hits and contributions
-  if (!m_cfg.attenuationReferencePositionName.empty()) {
-    m_attenuationReferencePosition =
-        m_geo.detector()->constant<double>(m_cfg.attenuationReferencePositionName) *
-        edm4eic::unit::mm / dd4hep::mm;
+  // get reference positions for attenuating hits and contributions
+  m_attenuationReferencePositions.clear();
+  for (const auto& name : m_cfg.attenuationReferencePositionNames) {
+    m_attenuationReferencePositions.emplace_back(m_geo.detector()->constant<double>(name) *
+                                                 edm4eic::unit::mm / dd4hep::mm);
+  }
+  if (m_attenuationReferencePositions.empty()) {
+    m_attenuationReferencePositions.emplace_back(std::nullopt);
   }
 }
 
 // Group contributions by (primary particle, cell ID), apply optional attenuation, and optionally merge into superhits
+// The input is traversed once for all readout ends, each with its own pair of output collections
 void SimCalorimeterHitProcessor::process(const SimCalorimeterHitProcessor::Input& input,
                                          const SimCalorimeterHitProcessor::Output& output) const {
 
   const auto [in_hits]              = input;
   auto [out_hits, out_hit_contribs] = output;
 
-  // Map for staging output information. We have 2 levels of structure:
-  //   - top level: (MCParticle, Merged Hit CellID)
+  const std::size_t n_ends = m_attenuationReferencePositions.size();
+  if (out_hits.size() != n_ends || out_hit_contribs.size() != n_ends) {
+    error("Expected {} hit and contribution output collections (one per readout end), "
+          "got {} and {}",
+          n_ends, out_hits.size(), out_hit_contribs.size());
+    throw std::runtime_error("Number of output collections does not match the readout ends");
+  }
+
+  // Staging of output information. We have 2 levels of structure:
+  //   - top level: (MCParticle, Merged Hit CellID, timeID)
   //   - second level: (Merged Contributions)
   // Ideally we would want immediately create our output objects and modify the
   // contributions when needed. That could reduce the following code to a single loop
   // (instead of 2 consecutive loops). However, this is not possible as we may have to merge
-  // (hence modify) contributions which is not supported for PodIO VectorMembers. Using
-  // reasonable contribution merging, at least the intermediary structure should be
-  // quite a bit smaller than the original hit collection.
-  using HitIndex = std::tuple<edm4hep::MCParticle, uint64_t /* cellID */, int /* timeID */>;
-  std::unordered_map<HitIndex,
-                     std::unordered_map<uint64_t /* cellID */, HitContributionAccumulator>>
-      hit_map;
-
-  for (const auto& ih : *in_hits) {
+  // (hence modify) contributions which is not supported for PodIO VectorMembers. Instead,
+  // every contribution is recorded once, with a key combining both levels per readout end,
+  // and the keys are sorted: contributions to merge then form consecutive runs, and runs
+  // for the same top-level key are adjacent, so that each output hit is built from one
+  // contiguous block.
+  using HitKey = std::tuple<std::uint32_t /* primary collectionID */, int /* primary index */,
+                            std::uint64_t /* cellID */, int /* timeID */,
+                            std::uint64_t /* contribution cellID */>;
+  struct ContributionRecord {
+    edm4hep::MCParticle primary;
+    float energy;
+    float time;
+    edm4hep::Vector3f position;
+    std::size_t hit_index;
+  };
+  std::vector<ContributionRecord> records;
+  // per (input hit, readout end): attenuation factor and total time delay
+  std::vector<double> hit_att_factors;
+  std::vector<double> hit_delays;
+  hit_att_factors.reserve(in_hits->size() * n_ends);
+  hit_delays.reserve(in_hits->size() * n_ends);
+  thread_local std::vector<SortedGrouping<HitKey>> hit_groups;
+  hit_groups.resize(n_ends);
+  for (auto& groups : hit_groups) {
+    groups.clear();
+  }
+
+  for (std::size_t hit_index = 0; hit_index < in_hits->size(); ++hit_index) {
+    const auto& ih = (*in_hits)[hit_index];
     // the cell ID of the new superhit we are making
     const uint64_t newhit_cellID =
         (ih.getCellID() & m_hit_id_mask.value() & m_contribution_id_mask.value());
     // the cell ID of this particular contribution (we are using contributions to store
     // the hits making up this "superhit" with more segmentation)
     const uint64_t newcontrib_cellID = (ih.getCellID() & m_contribution_id_mask.value());
-    // Optional attenuation
-    const double attFactor =
-        m_attenuationReferencePosition ? get_attenuation(ih.getPosition().z) : 1.;
+    // Optional attenuation and propagation time, per readout end
+    for (const auto& ref_zpos : m_attenuationReferencePositions) {
+      hit_att_factors.push_back(ref_zpos ? get_attenuation(*ref_zpos, ih.getPosition().z) : 1.);
+      const double propagationTime =
+          ref_zpos ? std::abs(*ref_zpos - ih.getPosition().z) * m_cfg.inversePropagationSpeed
+                   : 0.;
+      hit_delays.push_back(propagationTime + m_cfg.fixedTimeDelay);
+    }
     // Use primary particle (traced back through parents) to group contributions
     for (const auto& contrib : ih.getContributions()) {
       edm4hep::MCParticle primary = lookup_primary(contrib);
-      const double propagationTime =
-          m_attenuationReferencePosition
-              ? std::abs(m_attenuationReferencePosition.value() - ih.getPosition().z) *
-                    m_cfg.inversePropagationSpeed
-              : 0.;
-      const double totalTime  = contrib.getTime() + propagationTime + m_cfg.fixedTimeDelay;
-      const int newhit_timeID = std::floor(totalTime / m_cfg.timeWindow);
-      auto& hit_accum         = hit_map[{primary, newhit_cellID, newhit_timeID}][newcontrib_cellID];
-      hit_accum.add(contrib.getEnergy(), attFactor, totalTime, ih.getPosition());
+      const auto primary_id       = primary.getObjectID();
+      const auto record_index     = static_cast<std::uint32_t>(records.size());
+      for (std::size_t end = 0; end < n_ends; ++end) {
+        const double totalTime  = contrib.getTime() + hit_delays[hit_index * n_ends + end];
+        const int newhit_timeID = std::floor(totalTime / m_cfg.timeWindow);
+        hit_groups[end].add({primary_id.collectionID, primary_id.index, newhit_cellID,
+                             newhit_timeID, newcontrib_cellID},
+                            record_index);
+      }
+      records.push_back(
+          {primary, contrib.getEnergy(), contrib.getTime(), ih.getPosition(), hit_index});
     }
   }
 
   // We now have our data structured as we want it, next we need to visit all hits again
   // and create our output structures
-  for (const auto& [hit_idx, contribs] : hit_map) {
-
-    auto out_hit = out_hits->create();
-
-    const auto& [particle, cellID, timeID] = hit_idx;
-    HitContributionAccumulator new_hit;
-    for (const auto& [contrib_idx, contrib] : contribs) {
-      // Aggregate contributions to for the global hit; use effective "attenuation"
-      new_hit.add(contrib.getEnergy(), contrib.getAttEnergy() / contrib.getEnergy(),
-                  contrib.getMinTime(), contrib.getAvgPosition());
-      // Now store the contribution itself
-      auto out_hit_contrib = out_hit_contribs->create();
-      out_hit_contrib.setPDG(particle.getPDG());
-      out_hit_contrib.setEnergy(contrib.getEnergy()); // UNattenuated energy
-      out_hit_contrib.setTime(contrib.getMinTime());
-      out_hit_contrib.setStepPosition(contrib.getAvgPosition());
-      out_hit_contrib.setParticle(particle);
-      out_hit.addToContributions(out_hit_contrib);
+  for (std::size_t end = 0; end < n_ends; ++end) {
+    auto& groups = hit_groups[end];
+    groups.sort();
+
+    std::size_t group = 0;
+    while (group < groups.size()) {
+      const auto& [collectionID, index, cellID, timeID, first_contrib_cellID] = groups[group].key;
+      const auto& particle = records[groups[group].indices.front()].primary;
+
+      auto out_hit = out_hits[end]->create();
+      HitContributionAccumulator new_hit;
+      // all contribution groups sharing the hit key (first four key elements)
+      for (; group < groups.size(); ++group) {
+        const auto& [key, indices] = groups[group];
+        if (std::get<0>(key) != collectionID || std::get<1>(key) != index ||
+            std::get<2>(key) != cellID || std::get<3>(key) != timeID) {
+          break;
+        }
+        HitContributionAccumulator contrib;
+        for (std::uint32_t i : indices) {
+          const auto& record   = records[i];
+          const std::size_t hk = record.hit_index * n_ends + end;
+          contrib.add(record.energy, hit_att_factors[hk], record.time + hit_delays[hk],
+                      record.position);
+        }
+        // Aggregate contributions to for the global hit; use effective "attenuation"
+        new_hit.add(contrib.getEnergy(), contrib.getAttEnergy() / contrib.getEnergy(),
+                    contrib.getMinTime(), contrib.getAvgPosition());
+        // Now store the contribution itself
+        auto out_hit_contrib = out_hit_contribs[end]->create();
+        out_hit_contrib.setPDG(particle.getPDG());
+        out_hit_contrib.setEnergy(contrib.getEnergy()); // UNattenuated energy
+        out_hit_contrib.setTime(contrib.getMinTime());
+        out_hit_contrib.setStepPosition(contrib.getAvgPosition());
+        out_hit_contrib.setParticle(particle);
+        out_hit.addToContributions(out_hit_contrib);
+      }
+      out_hit.setCellID(cellID);
+      out_hit.setEnergy(new_hit.getAttEnergy()); // sum of attenuated energies
+      out_hit.setPosition(new_hit.getAvgPosition());
     }
-    out_hit.setCellID(cellID);
-    out_hit.setEnergy(new_hit.getAttEnergy()); // sum of attenuated energies
-    out_hit.setPosition(new_hit.getAvgPosition());
   }
 }
 
-double SimCalorimeterHitProcessor::get_attenuation(double zpos) const {
-  double length = std::abs(m_attenuationReferencePosition.value() - zpos);
+double SimCalorimeterHitProcessor::get_attenuation(double ref_zpos, double zpos) const {
+  double length = std::abs(ref_zpos - zpos);
   double factor =
       m_cfg.attenuationParameters[0] * std::exp(-length / m_cfg.attenuationParameters[1]) +
       (1 - m_cfg.attenuationParameters[0]) * std::exp(-length / m_cfg.attenuationParameters[2]);
@@ -12,6 +12,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "SimCalorimeterHitProcessorConfig.h"
 #include "algorithms/interfaces/WithPodConfig.h"
@@ -20,8 +21,8 @@ namespace eicrecon {
 
 using SimCalorimeterHitProcessorAlgorithm =
     algorithms::Algorithm<algorithms::Input<edm4hep::SimCalorimeterHitCollection>,
-                          algorithms::Output<edm4hep::SimCalorimeterHitCollection,
-                                             edm4hep::CaloHitContributionCollection>>;
+                          algorithms::Output<std::vector<edm4hep::SimCalorimeterHitCollection>,
+                                             std::vector<edm4hep::CaloHitContributionCollection>>>;
 
 class SimCalorimeterHitProcessor : public SimCalorimeterHitProcessorAlgorithm,
                                    public WithPodConfig<SimCalorimeterHitProcessorConfig> {
@@ -33,7 +34,7 @@ public:
             {"inputHitCollection"},
             {"outputHitCollection", "outputHitContributionCollection"},
             "Regroup the hits by particle, add up the hits if"
-            "they have e z-segmentation, and attenuate."} {}
+            "they have e z-segmentation, and attenuate towards each readout end."} {}
 
   void init() final;
   void process(const Input&, const Output&) const final;
@@ -46,12 +47,12 @@ private:
 
   const algorithms::GeoSvc& m_geo = algorithms::GeoSvc::instance();
 
-  // a reference value for attenuation
-  std::optional<double> m_attenuationReferencePosition;
+  // reference values for attenuation, one per readout end (nullopt: no attenuation)
+  std::vector<std::optional<double>> m_attenuationReferencePositions;
 
 private:
   // attenuation function
-  double get_attenuation(double zpos) const;
+  double get_attenuation(double ref_zpos, double zpos) const;
 };
 
 } // namespace eicrecon
@@ -17,7 +17,9 @@ struct SimCalorimeterHitProcessorConfig {
   std::vector<double> attenuationParameters{0};
 
   std::string readout{""};
-  std::string attenuationReferencePositionName{""};
+  // names of the detector constants with the positions of the readout ends; one pair of
+  // output collections is produced per readout end, a single unattenuated one if empty
+  std::vector<std::string> attenuationReferencePositionNames{};
   // fields for merging hits
   std::vector<std::string> hitMergeFields{};
   // fields for merging contributions
@@ -12,18 +12,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
 #include "CALOROCDigitization.h"
-
-namespace {
-
-struct RawEntry {
-  double adc{0};
-  double toa{0};
-  double tot{0};
-};
-} // namespace
+#include "algorithms/digi/WaveformKernels.h"
 
 namespace eicrecon {
 
@@ -35,109 +28,96 @@ void CALOROCDigitization::process(const CALOROCDigitization::Input& input,
   auto [out_digi_hits]   = output;
 
   for (const auto& pulse : *in_pulses) {
-    double pulse_t     = pulse.getTime();
-    double pulse_dt    = pulse.getInterval();
-    std::size_t n_amps = pulse.getAmplitude().size();
-    std::size_t time_stamp =
-        static_cast<std::size_t>(std::ceil((pulse_t - m_cfg.adc_phase) / m_cfg.time_window));
-    std::size_t idx_amp_first = static_cast<std::size_t>(
-        (m_cfg.adc_phase + time_stamp * m_cfg.time_window - pulse_t) / pulse_dt);
-    std::size_t sample_tick = static_cast<std::size_t>(m_cfg.time_window / pulse_dt);
-
-    std::vector<RawEntry> raw_samples(m_cfg.n_samples);
-
-    // ADCs are filled in advance because the measurement indices
-    // are already determined.
-    // CALOROC measures pulse amplitude for ADC.
-    for (std::size_t i = 0; i < m_cfg.n_samples; i++) {
-      std::size_t idx_amp = idx_amp_first + i * sample_tick;
-      if (idx_amp < n_amps)
-        raw_samples[i].adc = pulse.getAmplitude()[idx_amp];
-      else
-        break;
-    }
-
-    std::size_t idx_sample  = 0;
-    std::size_t idx_toa     = 0;
-    double t_upcross        = 0;
-    bool is_above_threshold = false;
-
-    // Measure the TOAs and TOTs while scanning the amplitudes.
-    // Start from i = 1 since amplitude[i-1] is used to calculate the crossing time.
-    for (std::size_t i = 1; i < n_amps; i++) {
-      double t = pulse_t + i * pulse_dt;
-      if (i > idx_amp_first)
-        idx_sample = (i + sample_tick - idx_amp_first - 1) / sample_tick;
-      if (idx_sample == m_cfg.n_samples)
-        break;
-
-      // Measure up-crossing time for TOA
-      if (!is_above_threshold && pulse.getAmplitude()[i] > m_cfg.toa_thres) {
-        idx_toa   = idx_sample;
-        t_upcross = get_crossing_time(m_cfg.toa_thres, pulse_dt, t, pulse.getAmplitude()[i],
-                                      pulse.getAmplitude()[i - 1]);
-        raw_samples[idx_toa].toa =
-            m_cfg.adc_phase + (time_stamp + idx_toa) * m_cfg.time_window - t_upcross;
-        is_above_threshold = true;
-      }
-
-      // Measure down-crossing time for TOT
-      if (is_above_threshold && pulse.getAmplitude()[i] < m_cfg.tot_thres) {
-        raw_samples[idx_toa].tot =
-            get_crossing_time(m_cfg.tot_thres, pulse_dt, t, pulse.getAmplitude()[i],
-                              pulse.getAmplitude()[i - 1]) -
-            t_upcross;
-        is_above_threshold = false;
-      }
-    }
-
-    // Fill CALOROCSamples and RawCALOROCHit
     auto out_digi_hit = out_digi_hits->create();
     out_digi_hit.setCellID(pulse.getCellID());
-    out_digi_hit.setSamplePhase(std::llround(m_cfg.adc_phase / m_cfg.dyRangeTOA * m_cfg.capTOA));
-    out_digi_hit.setTimeStamp(time_stamp);
-
-    for (const auto& raw_sample : raw_samples) {
-      auto adc =
-          std::clamp(std::llround(raw_sample.adc / m_cfg.dyRangeSingleGainADC * m_cfg.capADC), 0LL,
-                     static_cast<long long>(m_cfg.capADC) - 1);
-      auto toa = std::clamp(std::llround(raw_sample.toa / m_cfg.dyRangeTOA * m_cfg.capTOA), 0LL,
-                            static_cast<long long>(m_cfg.capTOA) - 1);
-      auto tot = std::clamp(std::llround(raw_sample.tot / m_cfg.dyRangeTOT * m_cfg.capTOT), 0LL,
-                            static_cast<long long>(m_cfg.capTOT) - 1);
-
-      out_digi_hit.addToASamples([&]() {
-        edm4eic::CALOROC1ASample aSample;
-        aSample.ADC               = adc;
-        aSample.timeOfArrival     = toa;
-        aSample.timeOverThreshold = tot;
-        return aSample;
-      }());
-
-      auto high_adc =
-          std::clamp(std::llround(raw_sample.adc / m_cfg.dyRangeHighGainADC * m_cfg.capADC), 0LL,
-                     static_cast<long long>(m_cfg.capADC) - 1);
-      auto low_adc =
-          std::clamp(std::llround(raw_sample.adc / m_cfg.dyRangeLowGainADC * m_cfg.capADC), 0LL,
-                     static_cast<long long>(m_cfg.capADC) - 1);
-
-      out_digi_hit.addToBSamples([&]() {
-        edm4eic::CALOROC1BSample bSample;
-        bSample.highGainADC   = high_adc;
-        bSample.lowGainADC    = low_adc;
-        bSample.timeOfArrival = toa;
-        return bSample;
-      }());
-    }
+    const auto amplitudes = pulse.getAmplitude();
+    digitize(out_digi_hit, pulse.getTime(), pulse.getInterval(),
+             std::span<const float>{amplitudes.begin(), amplitudes.end()});
   }
 } // CALOROCDigitization:process
 
-double CALOROCDigitization::get_crossing_time(double thres, double dt, double t, double amp1,
-                                              double amp2) const {
-  double numerator   = (amp1 - thres) * dt;
-  double denominator = amp2 - amp1;
-  double added       = t;
-  return (numerator / denominator) + added;
-}
+void CALOROCDigitization::digitize(edm4eic::MutableRawCALOROCHit& out_digi_hit, double pulse_t,
+                                   double pulse_dt, std::span<const float> amplitudes) const {
+  std::size_t n_amps = amplitudes.size();
+  std::size_t time_stamp =
+      static_cast<std::size_t>(std::ceil((pulse_t - m_cfg.adc_phase) / m_cfg.time_window));
+  std::size_t idx_amp_first = static_cast<std::size_t>(
+      (m_cfg.adc_phase + time_stamp * m_cfg.time_window - pulse_t) / pulse_dt);
+  std::size_t sample_tick = static_cast<std::size_t>(m_cfg.time_window / pulse_dt);
+
+  std::vector<double> raw_adcs(m_cfg.n_samples, 0);
+  std::vector<double> raw_toas(m_cfg.n_samples, 0);
+  std::vector<double> raw_tots(m_cfg.n_samples, 0);
+
+  // ADCs are filled in advance because the measurement indices
+  // are already determined.
+  // CALOROC measures pulse amplitude for ADC.
+  waveform::strided_gather(amplitudes, idx_amp_first, sample_tick, std::span{raw_adcs});
+
+  // The scan stops at the first amplitude belonging to the sample after the last one
+  const std::size_t idx_amp_end =
+      std::min(n_amps, m_cfg.n_samples == 0
+                           ? std::size_t{1}
+                           : idx_amp_first + (m_cfg.n_samples - 1) * sample_tick + 1);
+  const auto scanned      = amplitudes.first(idx_amp_end);
+  const auto sample_index = [&](std::size_t i) -> std::size_t {
+    return i > idx_amp_first ? (i + sample_tick - idx_amp_first - 1) / sample_tick : 0;
+  };
+
+  // Measure the TOAs and TOTs by alternating searches for the up- and down-crossings.
+  // Start from i = 1 since amplitude[i-1] is used to calculate the crossing time.
+  for (std::size_t i = 1;; ++i) {
+    // Measure up-crossing time for TOA
+    i = waveform::find_first_above(scanned, m_cfg.toa_thres, i);
+    if (i == waveform::npos) {
+      break;
+    }
+    const std::size_t idx_toa = sample_index(i);
+    const double t_upcross =
+        waveform::crossing_time(m_cfg.toa_thres, pulse_dt, pulse_t + i * pulse_dt,
+                                amplitudes[i], amplitudes[i - 1]);
+    raw_toas[idx_toa] = m_cfg.adc_phase + (time_stamp + idx_toa) * m_cfg.time_window - t_upcross;
+
+    // Measure down-crossing time for TOT
+    i = waveform::find_first_below(scanned, m_cfg.tot_thres, i);
+    if (i == waveform::npos) {
+      break;
+    }
+    raw_tots[idx_toa] =
+        waveform::crossing_time(m_cfg.tot_thres, pulse_dt, pulse_t + i * pulse_dt,
+                                amplitudes[i], amplitudes[i - 1]) -
+        t_upcross;
+  }
+
+  // Fill CALOROCSamples and RawCALOROCHit
+  out_digi_hit.setSamplePhase(std::llround(m_cfg.adc_phase / m_cfg.dyRangeTOA * m_cfg.capTOA));
+  out_digi_hit.setTimeStamp(time_stamp);
+
+  for (std::size_t i = 0; i < m_cfg.n_samples; i++) {
+    auto adc = waveform::clamp_quantize(raw_adcs[i], m_cfg.dyRangeSingleGainADC, m_cfg.capADC);
+    auto toa = waveform::clamp_quantize(raw_toas[i], m_cfg.dyRangeTOA, m_cfg.capTOA);
+    auto tot = waveform::clamp_quantize(raw_tots[i], m_cfg.dyRangeTOT, m_cfg.capTOT);
+
+    out_digi_hit.addToASamples([&]() {
+      edm4eic::CALOROC1ASample aSample;
+      aSample.ADC               = adc;
+      aSample.timeOfArrival     = toa;
+      aSample.timeOverThreshold = tot;
+      return aSample;
+    }());
+
+    auto high_adc = waveform::clamp_quantize(raw_adcs[i], m_cfg.dyRangeHighGainADC, m_cfg.capADC);
+    auto low_adc  = waveform::clamp_quantize(raw_adcs[i], m_cfg.dyRangeLowGainADC, m_cfg.capADC);
+
+    out_digi_hit.addToBSamples([&]() {
+      edm4eic::CALOROC1BSample bSample;
+      bSample.highGainADC   = high_adc;
+      bSample.lowGainADC    = low_adc;
+      bSample.timeOfArrival = toa;
+      return bSample;
+    }());
+  }
+} // CALOROCDigitization:digitize
+
 } // namespace eicrecon
 #endif
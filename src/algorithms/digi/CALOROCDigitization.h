@@ -6,6 +6,7 @@
 #include <algorithms/algorithm.h>
 #include <edm4eic/RawCALOROCHitCollection.h>
 #include <edm4eic/SimPulseCollection.h>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -30,8 +31,10 @@ public:
   virtual void init() final;
   void process(const Input&, const Output&) const;
 
-private:
-  double get_crossing_time(double thres, double dt, double t, double amp1, double amp2) const;
+  /// Fill the samples and time stamp of `out_digi_hit` from a pulse starting at `pulse_t`
+  /// with sampling interval `pulse_dt`
+  void digitize(edm4eic::MutableRawCALOROCHit& out_digi_hit, double pulse_t, double pulse_dt,
+                std::span<const float> amplitudes) const;
 };
 
 } // namespace eicrecon
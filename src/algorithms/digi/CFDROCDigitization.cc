@@ -6,13 +6,16 @@
 #include <podio/RelationRange.h>
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <gsl/pointers>
-#include <stack>
-#include <utility>
+#include <span>
+#include <vector>
 
 #include "CFDROCDigitization.h"
 #include "algorithms/digi/CFDROCDigitizationConfig.h"
+#include "algorithms/digi/WaveformKernels.h"
 
 namespace eicrecon {
 
@@ -25,8 +28,10 @@ void CFDROCDigitization::process(const CFDROCDigitization::Input& input,
   // This code is doing none of that, it's simply finding pulse height at a fraction of peak
   // more sophisticaed algorithm TBD
   //
+  std::vector<std::size_t> peaks;
   for (const auto& pulse : *simhits) {
-    auto adcs = pulse.getAdcCounts();
+    const auto adc_counts = pulse.getAdcCounts();
+    const std::span<const std::int32_t> adcs{adc_counts.begin(), adc_counts.end()};
     if (adcs.empty()) {
       continue;
     }
@@ -34,51 +39,27 @@ void CFDROCDigitization::process(const CFDROCDigitization::Input& input,
 
     // first we find all the peaks and store their location
     // Then we find the time corresponding to fraction of the peak height
-    // use stack to store peak height and time
-    std::stack<std::pair<int, int>> peakTimeAndHeight;
+    waveform::find_local_peaks(adcs, peaks);
 
-    for (size_t time_bin = 1; time_bin < adcs.size() - 1; ++time_bin) {
-      auto V      = adcs[time_bin];
-      auto prev_V = adcs[time_bin - 1];
-      auto next_V = adcs[time_bin + 1];
-      if ((std::abs(prev_V) < std::abs(V)) &&
-          (std::abs(V) >= std::abs(next_V))) { // To get peak of the Analog signal
-        peakTimeAndHeight.emplace(time_bin, V);
-      }
-    }
-
-    // scan the peak in reverse time to find TDC values at fraction of peaks height
-    // start from the last adc bin
-    int time_bin = static_cast<int>(adcs.size() - 2);
-    // find time corresponding to each peak one by one
-    while (!peakTimeAndHeight.empty()) {
-      auto peak = peakTimeAndHeight.top();
-      if (peak.first >= time_bin) {
-        // peaks that are situated later than current time are all discarded
-        peakTimeAndHeight.pop();
+    // scan the peaks in reverse time to find TDC values at fraction of peaks height
+    // start from the last but one adc bin
+    std::size_t time_bin = std::max<std::size_t>(adcs.size(), 2) - 2;
+    for (auto peak = peaks.rbegin(); peak != peaks.rend(); ++peak) {
+      if (*peak >= time_bin) {
+        // peaks that are situated later than the last crossing are all discarded
         continue;
       }
-      time_bin            = peak.first;
-      int target_height_V = static_cast<int>(peak.second * m_cfg.fraction);
-      int prev_V          = adcs[time_bin];
-      --time_bin;
-      // scan the peak in reverse time to find TDC values at fraction of peaks height
-      for (; time_bin >= 0; --time_bin) {
-        double V = adcs[time_bin];
-        // check voltage threshold
-        if (std::abs(V) <= std::abs(target_height_V) &&
-            std::abs(target_height_V) <= std::abs(prev_V)) {
-          int tdc = time_bin + n_CFDROC_cycle * m_cfg.tdc_range;
-          // limit the range of adc values
-          int adc = std::min(m_cfg.adc_range, std::abs(peak.second));
-          rawhits->create(pulse.getCellID(), adc, tdc);
-          // the peak is found. Break the time scan to the next peak
-          break;
-        }
-        prev_V = V;
+      const std::int32_t peak_V = adcs[*peak];
+      int target_height_V       = static_cast<int>(peak_V * m_cfg.fraction);
+      time_bin                  = waveform::find_cfd_crossing(adcs, *peak, target_height_V);
+      if (time_bin == waveform::npos) {
+        // no crossing before this peak, so there is none before the earlier ones either
+        break;
       }
-      // discard current peak from stack to look for the next peak
-      peakTimeAndHeight.pop();
+      int tdc = static_cast<int>(time_bin) + n_CFDROC_cycle * m_cfg.tdc_range;
+      // limit the range of adc values
+      int adc = std::min(m_cfg.adc_range, std::abs(peak_V));
+      rawhits->create(pulse.getCellID(), adc, tdc);
     }
   }
 } // CFDROCDigitization:process
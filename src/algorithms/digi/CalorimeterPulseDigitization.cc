@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+//
+// Pulse generation, combination, noise and CALOROC digitization in a single pass
+
+#include <edm4eic/EDM4eicVersion.h>
+#include <tuple>
+
+#if EDM4EIC_VERSION_MAJOR > 8 || (EDM4EIC_VERSION_MAJOR == 8 && EDM4EIC_VERSION_MINOR >= 7)
+#include <DDDigi/noise/FalphaNoise.h>
+#include <edm4hep/MCParticle.h>
+#include <edm4hep/SimCalorimeterHit.h>
+#include <edm4hep/Vector3f.h>
+#include <podio/RelationRange.h>
+#include <cstddef>
+#include <cstdint>
+#include <gsl/pointers>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "CalorimeterPulseDigitization.h"
+#include "algorithms/interfaces/SortedGrouping.h"
+
+namespace {
+
+// Pulse of one hit in the scratch amplitude buffer, with the accessors used by PulseCombiner
+struct ScratchPulse {
+  float time;
+  float interval;
+  std::span<const float> amplitude;
+  std::uint32_t index; // in the generated pulses
+
+  float getTime() const { return time; }
+  float getInterval() const { return interval; }
+  std::span<const float> getAmplitude() const { return amplitude; }
+};
+
+struct GeneratedPulse {
+  std::size_t hit_index;
+  float time;
+  float integral;
+  std::size_t offset;
+  std::size_t size;
+};
+
+} // namespace
+
+namespace eicrecon {
+
+void CalorimeterPulseDigitization::init() {
+  m_generation = std::make_unique<PulseGeneration<edm4hep::SimCalorimeterHit>>(
+      std::string(name()) + ":PulseGeneration");
+  m_generation->level(level());
+  m_generation->applyConfig(m_cfg.generation);
+  m_generation->init();
+
+  m_combiner = std::make_unique<PulseCombiner>(std::string(name()) + ":PulseCombiner");
+  m_combiner->level(level());
+  m_combiner->applyConfig(m_cfg.combiner);
+  m_combiner->init();
+
+  m_noise = std::make_unique<PulseNoise>(std::string(name()) + ":PulseNoise");
+  m_noise->level(level());
+  m_noise->applyConfig(m_cfg.noise);
+  m_noise->init();
+
+  m_digitization =
+      std::make_unique<CALOROCDigitization>(std::string(name()) + ":CALOROCDigitization");
+  m_digitization->level(level());
+  m_digitization->applyConfig(m_cfg.digitization);
+  m_digitization->init();
+}
+
+void CalorimeterPulseDigitization::process(
+    const CalorimeterPulseDigitization::Input& input,
+    const CalorimeterPulseDigitization::Output& output) const {
+  const auto [headers, hits]           = input;
+  auto [out_digi_hits, out_pulse_sets] = output;
+
+  // Intermediate pulses: generated, combined and optionally noisy, or none
+  if (!out_pulse_sets.empty() && out_pulse_sets.size() != 2 && out_pulse_sets.size() != 3) {
+    error("Expected no, 2 or 3 pulse output collections, got {}", out_pulse_sets.size());
+    throw std::runtime_error("Invalid number of pulse output collections");
+  }
+  const bool keep_pulses       = !out_pulse_sets.empty();
+  const bool keep_noisy_pulses = out_pulse_sets.size() == 3;
+
+  // local random generator, drawn from in the order of the combined pulses as in PulseNoise
+  auto seed = m_uid.getUniqueID(*headers, name());
+  std::default_random_engine generator(seed);
+  dd4hep::detail::FalphaNoise falpha(m_cfg.noise.poles, m_cfg.noise.alpha, m_cfg.noise.variance);
+
+  // Generate the pulses of all hits into one amplitude buffer
+  thread_local std::vector<float> amplitude_buffer;
+  thread_local std::vector<GeneratedPulse> generated;
+  amplitude_buffer.clear();
+  generated.clear();
+  std::vector<float> amplitudes;
+  for (std::size_t hit_index = 0; hit_index < hits->size(); ++hit_index) {
+    const auto& hit           = (*hits)[hit_index];
+    const auto [time, charge] = HitAdapter<edm4hep::SimCalorimeterHit>::getPulseSources(hit);
+
+    double start_time = 0;
+    float integral    = 0;
+    if (!m_generation->generatePulse(time, charge, amplitudes, start_time, integral)) {
+      continue;
+    }
+    generated.push_back({hit_index, static_cast<float>(start_time), integral,
+                         amplitude_buffer.size(), amplitudes.size()});
+    amplitude_buffer.insert(amplitude_buffer.end(), amplitudes.begin(), amplitudes.end());
+
+    if (keep_pulses) {
+      auto pulse = out_pulse_sets[0]->create();
+      pulse.setCellID(hit.getCellID());
+      pulse.setInterval(m_cfg.generation.timestep);
+      pulse.setTime(start_time);
+      for (float amplitude : amplitudes) {
+        pulse.addToAmplitude(amplitude);
+      }
+      pulse.setIntegral(integral);
+      pulse.setPosition(
+          edm4hep::Vector3f(hit.getPosition().x, hit.getPosition().y, hit.getPosition().z));
+      HitAdapter<edm4hep::SimCalorimeterHit>::addRelations(pulse, hit);
+    }
+  }
+
+  // Group the generated pulses by (masked) cellID, as PulseCombiner does
+  thread_local SortedGrouping<std::uint64_t> cell_groups;
+  cell_groups.clear();
+  cell_groups.reserve(generated.size());
+  for (const auto& pulse : generated) {
+    cell_groups.add((*hits)[pulse.hit_index].getCellID() & m_combiner->cellMask());
+  }
+  cell_groups.sort();
+
+  // Combine, add noise and digitize per cell
+  std::vector<ScratchPulse> cell_pulses;
+  std::vector<std::size_t> cluster_starts;
+  std::vector<float> combined;
+  for (const auto& group : cell_groups.groups()) {
+    cell_pulses.clear();
+    for (std::uint32_t index : group.indices) {
+      const auto& pulse = generated[index];
+      cell_pulses.push_back(
+          {pulse.time, static_cast<float>(m_cfg.generation.timestep),
+           std::span<const float>{amplitude_buffer}.subspan(pulse.offset, pulse.size), index});
+    }
+    if (cell_pulses.size() == 1) {
+      cluster_starts = {0, 1};
+    } else {
+      m_combiner->clusterPulses(cell_pulses, cluster_starts);
+    }
+
+    for (std::size_t i_cluster = 0; i_cluster + 1 < cluster_starts.size(); ++i_cluster) {
+      const std::span<const ScratchPulse> cluster{
+          cell_pulses.data() + cluster_starts[i_cluster],
+          cluster_starts[i_cluster + 1] - cluster_starts[i_cluster]};
+      const auto& first_pulse = generated[cluster[0].index];
+      const auto& first_hit   = (*hits)[first_pulse.hit_index];
+
+      float integral = first_pulse.integral;
+      if (cluster.size() == 1) {
+        combined.assign(cluster[0].amplitude.begin(), cluster[0].amplitude.end());
+      } else {
+        combined = PulseCombiner::sumPulses(cluster);
+        integral = std::accumulate(combined.begin(), combined.end(), 0.0F);
+      }
+
+      std::optional<edm4eic::MutableSimPulse> combined_pulse;
+      if (keep_pulses) {
+        combined_pulse = out_pulse_sets[1]->create();
+        combined_pulse->setCellID(first_hit.getCellID());
+        combined_pulse->setInterval(cluster[0].interval);
+        combined_pulse->setTime(cluster[0].time);
+        for (float amplitude : combined) {
+          combined_pulse->addToAmplitude(amplitude);
+        }
+        combined_pulse->setIntegral(integral);
+        combined_pulse->setPosition(edm4hep::Vector3f(
+            first_hit.getPosition().x, first_hit.getPosition().y, first_hit.getPosition().z));
+        for (const auto& pulse : cluster) {
+          const auto generated_pulse = (*out_pulse_sets[0])[pulse.index];
+          // a single pulse is passed on as a copy by PulseCombiner
+          if (cluster.size() > 1) {
+            combined_pulse->addToPulses(generated_pulse);
+          }
+          for (auto particle : generated_pulse.getParticles()) {
+            combined_pulse->addToParticles(particle);
+          }
+          for (auto hit : generated_pulse.getCalorimeterHits()) {
+            combined_pulse->addToCalorimeterHits(hit);
+          }
+        }
+      }
+
+      if (m_cfg.add_noise) {
+        const float noisy_integral = m_noise->addNoise(combined, generator, falpha);
+        if (keep_noisy_pulses) {
+          auto noisy_pulse = out_pulse_sets[2]->create();
+          noisy_pulse.setCellID(combined_pulse->getCellID());
+          noisy_pulse.setInterval(combined_pulse->getInterval());
+          noisy_pulse.setTime(combined_pulse->getTime());
+          for (float amplitude : combined) {
+            noisy_pulse.addToAmplitude(amplitude);
+          }
+          noisy_pulse.setIntegral(noisy_integral);
+          noisy_pulse.setPosition(combined_pulse->getPosition());
+          noisy_pulse.addToPulses(*combined_pulse);
+          for (auto particle : combined_pulse->getParticles()) {
+            noisy_pulse.addToParticles(particle);
+          }
+          for (auto hit : combined_pulse->getCalorimeterHits()) {
+            noisy_pulse.addToCalorimeterHits(hit);
+          }
+        }
+      }
+
+      auto digi_hit = out_digi_hits->create();
+      digi_hit.setCellID(first_hit.getCellID());
+      m_digitization->digitize(digi_hit, cluster[0].time, cluster[0].interval, combined);
+    }
+  }
+} // CalorimeterPulseDigitization:process
+
+} // namespace eicrecon
+#endif
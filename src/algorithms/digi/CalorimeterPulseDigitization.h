@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+//
+// Pulse generation, combination, noise and CALOROC digitization in a single pass
+
+#pragma once
+
+#include <algorithms/algorithm.h>
+#include <edm4eic/RawCALOROCHitCollection.h>
+#include <edm4eic/SimPulseCollection.h>
+#include <edm4hep/EventHeaderCollection.h>
+#include <edm4hep/SimCalorimeterHitCollection.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "algorithms/digi/CALOROCDigitization.h"
+#include "algorithms/digi/CalorimeterPulseDigitizationConfig.h"
+#include "algorithms/digi/PulseCombiner.h"
+#include "algorithms/digi/PulseGeneration.h"
+#include "algorithms/digi/PulseNoise.h"
+#include "algorithms/interfaces/UniqueIDGenSvc.h"
+#include "algorithms/interfaces/WithPodConfig.h"
+
+namespace eicrecon {
+
+using CalorimeterPulseDigitizationAlgorithm = algorithms::Algorithm<
+    algorithms::Input<edm4hep::EventHeaderCollection, edm4hep::SimCalorimeterHitCollection>,
+    algorithms::Output<edm4eic::RawCALOROCHitCollection,
+                       std::vector<edm4eic::SimPulseCollection>>>;
+
+/**
+ * Runs PulseGeneration, PulseCombiner, PulseNoise and CALOROCDigitization per cell on
+ * scratch amplitude buffers, and emits only the CALOROC hits. The intermediate pulse
+ * collections (generated, combined and noisy pulses, with their relations) are filled
+ * only if pulse output collections are given: all three, or only the generated and
+ * combined pulses if two are given.
+ */
+class CalorimeterPulseDigitization : public CalorimeterPulseDigitizationAlgorithm,
+                                     public WithPodConfig<CalorimeterPulseDigitizationConfig> {
+
+public:
+  CalorimeterPulseDigitization(std::string_view name)
+      : CalorimeterPulseDigitizationAlgorithm{
+            name,
+            {"eventHeader", "inputHitCollection"},
+            {"outputDigiHits", "outputPulses"},
+            "Generate, combine, add noise to and digitize calorimeter pulses in one pass"} {}
+
+  void init() final;
+  void process(const Input&, const Output&) const final;
+
+private:
+  std::unique_ptr<PulseGeneration<edm4hep::SimCalorimeterHit>> m_generation;
+  std::unique_ptr<PulseCombiner> m_combiner;
+  std::unique_ptr<PulseNoise> m_noise;
+  std::unique_ptr<CALOROCDigitization> m_digitization;
+
+  const algorithms::UniqueIDGenSvc& m_uid = algorithms::UniqueIDGenSvc::instance();
+};
+
+} // namespace eicrecon
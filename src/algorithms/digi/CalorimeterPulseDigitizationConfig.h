@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include "algorithms/digi/CALOROCDigitizationConfig.h"
+#include "algorithms/digi/PulseCombinerConfig.h"
+#include "algorithms/digi/PulseGenerationConfig.h"
+#include "algorithms/digi/PulseNoiseConfig.h"
+
+namespace eicrecon {
+
+struct CalorimeterPulseDigitizationConfig {
+
+  // Stages of PulseGeneration -> PulseCombiner -> [PulseNoise ->] CALOROCDigitization,
+  // with the same meaning as for the standalone algorithms
+  PulseGenerationConfig generation;
+  PulseCombinerConfig combiner;
+  bool add_noise{true};
+  PulseNoiseConfig noise;
+  CALOROCDigitizationConfig digitization;
+};
+
+} // namespace eicrecon
@@ -6,14 +6,16 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
 #include <gsl/pointers>
 #include <limits>
 #include <podio/RelationRange.h>
-#include <vector>
+#include <span>
 
 #include "EICROCDigitization.h"
 #include "algorithms/digi/EICROCDigitizationConfig.h"
+#include "algorithms/digi/WaveformKernels.h"
 
 namespace eicrecon {
 
@@ -27,22 +29,18 @@ void EICROCDigitization::process(const EICROCDigitization::Input& input,
 
   for (const auto& pulse : *simhits) {
     int tdc = std::numeric_limits<int>::max();
-    int V   = 0;
 
-    int time_bin          = 0;
-    double adc_prev       = 0;
-    auto adcs             = pulse.getAdcCounts();
+    const auto adc_counts = pulse.getAdcCounts();
+    const std::span<const std::int32_t> adcs{adc_counts.begin(), adc_counts.end()};
     double n_EICROC_cycle = static_cast<int>(std::floor(pulse.getTime() / m_cfg.tMax + 1e-3));
-    for (const auto adc : adcs) {
-      if (adc_prev >= thres && adc <= thres) {
-        tdc = time_bin + n_EICROC_cycle * m_cfg.tdc_range;
-      }
-      if (std::abs(adc) > std::abs(V)) { // To get peak of the Analog signal
-        V = adc;
-      }
-      adc_prev = adc;
-      ++time_bin;
+
+    // TDC at the last falling crossing of the threshold
+    const std::size_t time_bin = waveform::find_last_falling_crossing(adcs, thres, 0.);
+    if (time_bin != waveform::npos) {
+      tdc = static_cast<int>(time_bin) + n_EICROC_cycle * m_cfg.tdc_range;
     }
+    // To get peak of the Analog signal
+    const int V = waveform::abs_peak(adcs);
 
     // limit the range of adc values
     int adc = std::min(adc_range, -V);
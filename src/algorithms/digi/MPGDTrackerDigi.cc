@@ -123,6 +123,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <gsl/pointers>
 #include <gsl/util>
@@ -162,6 +163,16 @@ void MPGDTrackerDigi::init() {
   parseIDDescriptor();
   parseSegmentation();
 
+  // SUBVOLUMES of all detectors w/ this readout
+  for (const auto& [name, subdetector] : m_detector->detectors()) {
+    const auto sensitive = m_detector->sensitiveDetector(name);
+    if (sensitive.isValid() && sensitive.readout().isValid() &&
+        sensitive.readout().name() == m_cfg.readout) {
+      cacheSubVolumes(subdetector);
+    }
+  }
+  debug(R"(Cached {} SUBVOLUMES for "{}" readout)", m_subVolumes.size(), m_cfg.readout);
+
   // Ordering of SUBVOLUMES (based on "STRIP" FIELD)
   m_stripRank = [&](CellID vID) {
     CellID sID = vID & m_stripBits;
@@ -218,13 +229,69 @@ void MPGDTrackerDigi::init() {
   };
 }
 
+// Recursively cache the SUBVOLUMES, i.e. the detector elements of sensitive volumes
+void MPGDTrackerDigi::cacheSubVolumes(const DetElement& element) {
+  const VolumeManager& volman = m_detector->volumeManager();
+  for (const auto& [name, child] : element.children()) {
+    const CellID vID = child.volumeID() & m_volumeBits;
+    DetElement sensitive;
+    try {
+      sensitive = volman.lookupDetElement(vID);
+    } catch (const std::exception&) {
+      // not a sensitive volume
+    }
+    if (sensitive.isValid() && sensitive.ptr() == child.ptr()) {
+      m_subVolumes.try_emplace(vID, makeSubVolume(child));
+    }
+    cacheSubVolumes(child);
+  }
+}
+
+MPGDTrackerDigi::SubVolume MPGDTrackerDigi::makeSubVolume(const DetElement& element) {
+  SubVolume subVolume;
+  subVolume.element = element;
+  // TGeoHMatrix: Take a copy of the matrix, as it's used beyond any lookup.
+  subVolume.toVolume = element.nominal().worldTransformation();
+  const auto& shape  = element.solid();
+  if (std::string_view{shape.type()} == "TGeoTubeSeg") {
+    const Tube& tube = shape;
+    subVolume.shape  = 0;
+    subVolume.rMin   = tube.rMin();
+    subVolume.rMax   = tube.rMax();
+    subVolume.dZ     = tube.dZ();
+    // In "https://root.cern.ch/root/html534/guides/users-guide/Geometry.html"
+    // TGeoTubeSeg: "phi1 is converted to [0,360] (but still expressed in
+    // radian, as far as I can tell) and phi2 > phi1."
+    // => Convert it to [-pi,+pi].
+    subVolume.startPhi = tube.startPhi() * radian - 2 * TMath::Pi();
+    subVolume.endPhi   = tube.endPhi() * radian - 2 * TMath::Pi();
+  } else if (std::string_view{shape.type()} == "TGeoBBox") {
+    const Box& box  = shape;
+    subVolume.shape = 1;
+    subVolume.dX    = box.x();
+    subVolume.dY    = box.y();
+    subVolume.dZ    = box.z();
+  }
+  return subVolume;
+}
+
+// SUBVOLUME from the cache, else looked up (into <uncached>) for this call only
+const MPGDTrackerDigi::SubVolume& MPGDTrackerDigi::getSubVolume(CellID vID,
+                                                                 SubVolume& uncached) const {
+  if (auto it = m_subVolumes.find(vID); it != m_subVolumes.end()) {
+    return it->second;
+  }
+  uncached = makeSubVolume(m_detector->volumeManager().lookupDetElement(vID));
+  return uncached;
+}
+
 // Interfaces
 void getLocalPosMom(const edm4hep::SimTrackerHit& sim_hit, const TGeoHMatrix& toModule,
                     double* lpos, double* lmom);
 bool cExtrapolate(const double* lpos, const double* lmom, // Input subHit
                   double rT,                              // Target radius
                   double* lext);                          // Extrapolated position @ <rT>
-double getRef2Cur(DetElement refVol, DetElement curVol);
+double getRef2Cur(const TGeoHMatrix& toRefVol, const TGeoHMatrix& toCurVol);
 bool bExtrapolate(const double* lpos, const double* lmom, // Input subHit
                   double zT,                              // Target Z
                   double* lext);                          // Extrapolated position @ <zT>
@@ -244,6 +311,7 @@ void MPGDTrackerDigi::process(const MPGDTrackerDigi::Input& input,
 
   const auto [headers, sim_hits]       = input;
   auto [raw_hits, links, associations] = output;
+  const bool data_only                 = m_data_mode.dataOnly();
 
   // local random generator
   auto seed = m_uid.getUniqueID(*headers, name());
@@ -252,10 +320,9 @@ void MPGDTrackerDigi::process(const MPGDTrackerDigi::Input& input,
 
   // Maps of unique cellIDs with temporary structure RawHit
   std::unordered_map<std::uint64_t, edm4eic::MutableRawTrackerHit> cell_hit_maps[2];
-  // A map of strip cellIDs with vector of contributing cellIDs
-  std::map<std::uint64_t, std::vector<std::uint64_t>> stripID2cIDs;
-  // Prepare for strip segmentation
-  const VolumeManager& volman = m_detector->volumeManager();
+  // A map of strip cellIDs with vector of contributing sim_hits, booked as they are
+  // accumulated, so that associations need not search the sim_hits again.
+  std::unordered_map<std::uint64_t, std::vector<int>> stripID2simHits;
 
   // Reference to event, to be used to document error messages
   // (N.B.: I don't know how to properly handle these "headers": may there
@@ -276,8 +343,9 @@ void MPGDTrackerDigi::process(const MPGDTrackerDigi::Input& input,
     double time_smearing = gaussian(generator) * m_cfg.timeResolution;
 
     // ***** REFERENCE SUBVOLUME
-    CellID refID      = sim_hit.getCellID() & m_moduleBits;
-    DetElement refVol = volman.lookupDetElement(refID);
+    CellID refID = sim_hit.getCellID() & m_moduleBits;
+    SubVolume uncachedRef;
+    const SubVolume& ref = getSubVolume(refID, uncachedRef);
     // ***** COALESCE ALL MUTUALLY CONSISTENT SUBHITS
     //       EXTEND TRAVERSING SUBHITS
     // - Needed because we want to preserve the correlation between 'p' and
@@ -285,31 +353,32 @@ void MPGDTrackerDigi::process(const MPGDTrackerDigi::Input& input,
     //  one accumulates hits independently based on cellID).
     double lpos[3], eDep, time;
     std::vector<std::uint64_t> cIDs;
-    const auto& shape = refVol.solid();
-    if (std::string_view{shape.type()} == "TGeoTubeSeg") {
+    // Contributing sim_hits = [firstIdx,idx] (coalescence updates <idx>)
+    const int firstIdx = idx;
+    if (ref.shape == 0) {
       // ********** TUBE GEOMETRY
       if (!cCoalesceExtend(input, idx, cIDs, lpos, eDep, time))
         continue;
-    } else if (std::string_view{shape.type()} == "TGeoBBox") {
+    } else if (ref.shape == 1) {
       // ********** BOX GEOMETRY
       if (!bCoalesceExtend(input, idx, cIDs, lpos, eDep, time))
         continue;
     } else {
-      critical(R"(Bad input data: CellID {:x} has invalid shape "{}")", refID, shape.type());
+      critical(R"(Bad input data: CellID {:x} has invalid shape "{}")", refID,
+               ref.element.solid().type());
       throw std::runtime_error(R"(Inconsistency: Inappropriate SimHits fed to "MPGDTrackerDigi".)");
     }
 
     // ***** 2D-position on sensitive surface
     double surfPos[2];
     Position locPos;
-    if (std::string_view{shape.type()} == "TGeoTubeSeg") {
+    if (ref.shape == 0) {
       // Sensitive surface radius = REFERENCE VOLUME radius
-      const Tube& tRef = refVol.solid();
-      double R         = (tRef.rMin() + tRef.rMax()) / 2;
-      double phi       = atan2(lpos[1], lpos[0]);
-      surfPos[0]       = phi * R;
-      surfPos[1]       = lpos[2];
-      locPos           = Position(R * cos(phi), R * sin(phi), lpos[2]);
+      double R   = (ref.rMin + ref.rMax) / 2;
+      double phi = atan2(lpos[1], lpos[0]);
+      surfPos[0] = phi * R;
+      surfPos[1] = lpos[2];
+      locPos     = Position(R * cos(phi), R * sin(phi), lpos[2]);
     } else {
       locPos = Position(lpos[0], lpos[1], lpos[2]);
       if (m_gridAngle != 0.0) { // Transform to strip frame
@@ -369,7 +438,12 @@ void MPGDTrackerDigi::process(const MPGDTrackerDigi::Input& input,
           debug("  eDep {:.2f} is below threshold of {:.2f} [keV]", eDep, m_cfg.threshold / keV);
           continue;
         }
-        stripID2cIDs[cID]   = cIDs;
+        if (!data_only) {
+          std::vector<int>& simHits = stripID2simHits[cID];
+          for (int jdx = firstIdx; jdx <= idx; jdx++) {
+            simHits.push_back(jdx);
+          }
+        }
         double result_time  = time + time_smearing;
         auto hit_time_stamp = (std::int32_t)(result_time * 1e3);
         if (!cell_hit_map.contains(cID)) {
@@ -395,31 +469,32 @@ void MPGDTrackerDigi::process(const MPGDTrackerDigi::Input& input,
   } // End loop on sim_hit's
 
   // ***** RawHit INSTANTIATION AND RawHit<-SimHits ASSOCIATION:
+  // Each sim_hit is booked once per strip it contributed to (coalesced hits
+  // being disjoint ranges of sim_hits), so no further de-duplication is needed.
   for (auto& cell_hit_map : cell_hit_maps) {
     for (auto item : cell_hit_map) {
       raw_hits->push_back(item.second);
+      if (data_only) {
+        continue;
+      }
       CellID stripID = item.first;
-      const auto is  = stripID2cIDs.find(stripID);
-      if (is == stripID2cIDs.end()) {
-        error(R"(Inconsistency: CellID {:x} not found in "stripID2cIDs" map)", stripID);
-        throw std::runtime_error(R"(Inconsistency in the handling of "stripID2cIDs" map)");
+      const auto is  = stripID2simHits.find(stripID);
+      if (is == stripID2simHits.end()) {
+        error(R"(Inconsistency: CellID {:x} not found in "stripID2simHits" map)", stripID);
+        throw std::runtime_error(R"(Inconsistency in the handling of "stripID2simHits" map)");
       }
-      std::vector<std::uint64_t> cIDs = is->second;
-      for (CellID cID : cIDs) {
-        for (const auto& sim_hit : *sim_hits) {
-          if (sim_hit.getCellID() == cID) {
-            // create link
-            auto link = links->create();
-            link.setFrom(item.second);
-            link.setTo(sim_hit);
-            link.setWeight(1.0);
-            // set association
-            auto hitassoc = associations->create();
-            hitassoc.setWeight(1.0);
-            hitassoc.setRawHit(item.second);
-            hitassoc.setSimHit(sim_hit);
-          }
-        }
+      for (int idx : is->second) {
+        const auto sim_hit = (*sim_hits)[idx];
+        // create link
+        auto link = links->create();
+        link.setFrom(item.second);
+        link.setTo(sim_hit);
+        link.setWeight(1.0);
+        // set association
+        auto hitassoc = associations->create();
+        hitassoc.setWeight(1.0);
+        hitassoc.setRawHit(item.second);
+        hitassoc.setSimHit(sim_hit);
       }
     }
   }
@@ -713,11 +788,9 @@ bool MPGDTrackerDigi::cCoalesceExtend(const Input& input, int& idx,
   const edm4hep::SimTrackerHit& sim_hit = sim_hits->at(idx);
   CellID vID                            = sim_hit.getCellID() & m_volumeBits;
   CellID refID                          = vID & m_moduleBits; // => The REFERENCE SUBVOLUME
-  const VolumeManager& volman           = m_detector->volumeManager();
-  DetElement refVol                     = volman.lookupDetElement(refID);
-  // TGeoHMatrix: In order to avoid a "dangling-reference" warning, let's take
-  // a copy of the matrix instead of a reference to it.
-  const TGeoHMatrix toRefVol = refVol.nominal().worldTransformation();
+  SubVolume uncachedRef, uncachedCur;
+  const SubVolume& ref        = getSubVolume(refID, uncachedRef);
+  const TGeoHMatrix& toRefVol = ref.toVolume;
   double lmom[3];
   getLocalPosMom(sim_hit, toRefVol, lpos, lmom);
   const double edmm = edm4eic::unit::mm, ed2dd = dd4hep::mm / edmm;
@@ -726,22 +799,11 @@ bool MPGDTrackerDigi::cCoalesceExtend(const Input& input, int& idx,
   // Hit in progress
   eDep = sim_hit.getEDep();
   time = sim_hit.getTime();
-  // Get VOLUME parameters
-  const Tube& tRef = refVol.solid();
-  double dZ        = tRef.dZ();
-  // phi?
-  // In "https://root.cern.ch/root/html534/guides/users-guide/Geometry.html"
-  // TGeoTubeSeg: "phi1 is converted to [0,360] (but still expressed in
-  // radian, as far as I can tell) and phi2 > phi1."
-  // => Convert it to [-pi,+pi].
-  double startPhi = tRef.startPhi() * radian;
-  startPhi -= 2 * TMath::Pi();
-  double endPhi = tRef.endPhi() * radian;
-  endPhi -= 2 * TMath::Pi();
+  // Get VOLUME parameters (phi converted to [-pi,+pi], cf. "makeSubVolume")
+  double dZ = ref.dZ, startPhi = ref.startPhi, endPhi = ref.endPhi;
   // Get current SUBVOLUME
-  DetElement curVol = volman.lookupDetElement(vID);
-  const Tube& tCur  = curVol.solid();
-  double rMin = tCur.rMin(), rMax = tCur.rMax();
+  const SubVolume& cur = getSubVolume(vID, uncachedCur);
+  double rMin = cur.rMin, rMax = cur.rMax;
   // Is TRAVERSING?
   double lintos[2][3], louts[2][3], lpini[3], lpend[3], lmend[3];
   std::copy(std::begin(lmom), std::end(lmom), std::begin(lmend));
@@ -796,10 +858,10 @@ bool MPGDTrackerDigi::cCoalesceExtend(const Input& input, int& idx,
         break;
       }
       // Get 'j' radii
-      curVol           = volman.lookupDetElement(vJD);
-      const Tube& tubj = curVol.solid();
-      rMin             = tubj.rMin();
-      rMax             = tubj.rMax();
+      SubVolume uncachedJ;
+      const SubVolume& subj = getSubVolume(vJD, uncachedJ);
+      rMin                  = subj.rMin;
+      rMax                  = subj.rMax;
       double lpoj[3], lmoj[3];
       getLocalPosMom(sim_hjt, toRefVol, lpoj, lmoj);
       // Is TRAVERSING through the (quasi-)common wall?
@@ -858,7 +920,7 @@ bool MPGDTrackerDigi::cCoalesceExtend(const Input& input, int& idx,
   }
   // ***** EXTENSION?...
   if (sim_hit.isProducedBySecondary() && cIDs.size() < 2)
-    if (denyExtension(sim_hit, tCur.rMax() - tCur.rMin())) {
+    if (denyExtension(sim_hit, cur.rMax - cur.rMin)) {
       isContinuation = hasContinuation = false;
     }
   for (int io = 0; io < 2; io++) { // ...into/out-of
@@ -868,7 +930,7 @@ bool MPGDTrackerDigi::cCoalesceExtend(const Input& input, int& idx,
     extendHit(refID, cIDs, direction, lpini, lmom, lpend, lmend);
   }
   // ***** FLAG CASES W/ UNEXPECTED OUTCOME
-  flagUnexpected(header, 0, (tRef.rMin() + tRef.rMax()) / 2, sim_hit, lpini, lpend, lpos, lmom);
+  flagUnexpected(header, 0, (ref.rMin + ref.rMax) / 2, sim_hit, lpini, lpend, lpos, lmom);
   // ***** UPDATE (local position <lpos>, DoF)
   double DoF2 = 0, dir = 0;
   for (int i = 0; i < 3; i++) {
@@ -886,7 +948,7 @@ bool MPGDTrackerDigi::cCoalesceExtend(const Input& input, int& idx,
     debug("  =");
     // Print position, eDep and time of coalesced/extended hit
     Position locPos(lpos[0], lpos[1], lpos[2]); // Simplification: strip surface = REFERENCE surface
-    Position globPos = refVol.nominal().localToWorld(locPos);
+    Position globPos = ref.element.nominal().localToWorld(locPos);
     debug("  position  = ({:7.2f},{:7.2f},{:7.2f}) [mm]", globPos.X() / mm, globPos.Y() / mm,
           globPos.Z() / mm);
     debug("  edep = {:.0f} [eV]", eDep / eV);
@@ -902,11 +964,9 @@ bool MPGDTrackerDigi::bCoalesceExtend(const Input& input, int& idx,
   const edm4hep::SimTrackerHit& sim_hit = sim_hits->at(idx);
   CellID vID                            = sim_hit.getCellID() & m_volumeBits;
   CellID refID                          = vID & m_moduleBits; // => The REFERENCE SUBVOLUME
-  const VolumeManager& volman           = m_detector->volumeManager();
-  DetElement refVol                     = volman.lookupDetElement(refID);
-  // TGeoHMatrix: In order to avoid a "dangling-reference" warning, let's take
-  // a copy of the matrix instead of a reference to it.
-  const TGeoHMatrix toRefVol = refVol.nominal().worldTransformation();
+  SubVolume uncachedRef, uncachedCur;
+  const SubVolume& ref        = getSubVolume(refID, uncachedRef);
+  const TGeoHMatrix& toRefVol = ref.toVolume;
   double lmom[3];
   getLocalPosMom(sim_hit, toRefVol, lpos, lmom);
   const double edmm = edm4eic::unit::mm, ed2dd = dd4hep::mm / edmm;
@@ -916,13 +976,11 @@ bool MPGDTrackerDigi::bCoalesceExtend(const Input& input, int& idx,
   eDep = sim_hit.getEDep();
   time = sim_hit.getTime();
   // Get VOLUME parameters
-  const Box& bRef = refVol.solid(); // REFERENCE SUBVOLUME
-  double dX = bRef.x(), dY = bRef.y();
+  double dX = ref.dX, dY = ref.dY; // REFERENCE SUBVOLUME
   // Get current SUBVOLUME
-  DetElement curVol = volman.lookupDetElement(vID);
-  const Box& bCur   = curVol.solid();
-  double dZ         = bCur.z();
-  double ref2Cur    = getRef2Cur(refVol, curVol);
+  const SubVolume& cur = getSubVolume(vID, uncachedCur);
+  double dZ            = cur.dZ;
+  double ref2Cur       = getRef2Cur(toRefVol, cur.toVolume);
   // Is TRAVERSING?
   double lintos[2][3], louts[2][3], lpini[3], lpend[3], lmend[3];
   std::copy(std::begin(lmom), std::end(lmom), std::begin(lmend));
@@ -967,10 +1025,10 @@ bool MPGDTrackerDigi::bCoalesceExtend(const Input& input, int& idx,
         break;
       }
       // Get 'j' Z
-      curVol          = volman.lookupDetElement(vJD); // 'j' SUBVOLUME
-      const Box& boxj = curVol.solid();
-      dZ              = boxj.z();
-      double ref2j    = getRef2Cur(refVol, curVol);
+      SubVolume uncachedJ;
+      const SubVolume& subj = getSubVolume(vJD, uncachedJ); // 'j' SUBVOLUME
+      dZ                    = subj.dZ;
+      double ref2j          = getRef2Cur(toRefVol, subj.toVolume);
       // Is TRAVERSING through the (quasi)-common border?
       double lpoj[3], lmoj[3];
       getLocalPosMom(sim_hjt, toRefVol, lpoj, lmoj);
@@ -1025,7 +1083,7 @@ bool MPGDTrackerDigi::bCoalesceExtend(const Input& input, int& idx,
   }
   // ***** EXTENSION?...
   if (sim_hit.isProducedBySecondary() && cIDs.size() < 2)
-    if (denyExtension(sim_hit, bCur.z())) {
+    if (denyExtension(sim_hit, cur.dZ)) {
       isContinuation = hasContinuation = false;
     }
   for (int io = 0; io < 2; io++) { // ...into/out-of
@@ -1053,7 +1111,7 @@ bool MPGDTrackerDigi::bCoalesceExtend(const Input& input, int& idx,
     debug("  =");
     // Print position, eDep and time of coalesced/extended hit
     Position locPos(lpos[0], lpos[1], lpos[2]); // Simplification: strip surface = REFERENCE surface
-    Position globPos = refVol.nominal().localToWorld(locPos);
+    Position globPos = ref.element.nominal().localToWorld(locPos);
     debug("  position  = ({:7.2f},{:7.2f},{:7.2f}) [mm]", globPos.X() / mm, globPos.Y() / mm,
           globPos.Z() / mm);
     debug("  edep = {:.0f} [eV]", eDep / eV);
@@ -1800,13 +1858,9 @@ unsigned int MPGDTrackerDigi::bExtension(const double* lpos, const double* lmom,
   return status;
 }
 
-double getRef2Cur(DetElement refVol, DetElement curVol) {
-  // TGeoHMatrix: In order to avoid a "dangling-reference" warning,
-  // let's take a copy of the matrix instead of a reference to it.
-  const TGeoHMatrix toRefVol = refVol.nominal().worldTransformation();
-  const TGeoHMatrix toCurVol = curVol.nominal().worldTransformation();
-  const double* TRef         = toRefVol.GetTranslation();
-  const double* TCur         = toCurVol.GetTranslation();
+double getRef2Cur(const TGeoHMatrix& toRefVol, const TGeoHMatrix& toCurVol) {
+  const double* TRef = toRefVol.GetTranslation();
+  const double* TCur = toCurVol.GetTranslation();
   // For some reason, it has to be "Ref-Cur", while I (Y.B) would have expected the opposite...
   double gdT[3];
   for (int i = 0; i < 3; i++)
@@ -1898,10 +1952,9 @@ double outInDistance(int shape, int orientation, double lintos[][3], double lout
 unsigned int MPGDTrackerDigi::extendHit(CellID refID, std::vector<std::uint64_t>& cIDs,
                                         int direction, double* lpini, double* lmini, double* lpend,
                                         double* lmend) const {
-  unsigned int status         = 0;
-  const VolumeManager& volman = m_detector->volumeManager();
-  DetElement refVol           = volman.lookupDetElement(refID);
-  const auto& shape           = refVol.solid();
+  unsigned int status = 0;
+  SubVolume uncachedRef;
+  const SubVolume& ref = getSubVolume(refID, uncachedRef);
   double *lpoE, *lmoE; // Starting position/momentum
   if (direction < 0) {
     lpoE = lpini;
@@ -1930,26 +1983,20 @@ unsigned int MPGDTrackerDigi::extendHit(CellID refID, std::vector<std::uint64_t>
       continue;
     if (std::find(cIDs.begin(), cIDs.end(), vIDE) != cIDs.end())
       continue;
-    DetElement volE = volman.lookupDetElement(vIDE);
+    SubVolume uncachedE;
+    const SubVolume& volE = getSubVolume(vIDE, uncachedE);
     double lext[3];
-    if (std::string_view{shape.type()} == "TGeoTubeSeg") {
-      const Tube& tExt = volE.solid();
-      double R         = rankE == 0 ? tExt.rMin() : tExt.rMax();
-      double startPhi  = tExt.startPhi() * radian;
-      startPhi -= 2 * TMath::Pi();
-      double endPhi = tExt.endPhi() * radian;
-      endPhi -= 2 * TMath::Pi();
-      double dZ = tExt.dZ();
-      status    = cExtension(lpoE, lmoE, R, direction, dZ, startPhi, endPhi, lext);
-    } else if (std::string_view{shape.type()} == "TGeoBBox") {
-      double ref2E    = getRef2Cur(refVol, volE);
-      const Box& bExt = volE.solid();
-      double Z        = rankE == 0 ? -bExt.z() : +bExt.z();
+    if (ref.shape == 0) {
+      double R = rankE == 0 ? volE.rMin : volE.rMax;
+      status   = cExtension(lpoE, lmoE, R, direction, volE.dZ, volE.startPhi, volE.endPhi, lext);
+    } else if (ref.shape == 1) {
+      double ref2E = getRef2Cur(ref.toVolume, volE.toVolume);
+      double Z     = rankE == 0 ? -volE.dZ : +volE.dZ;
       Z -= ref2E;
-      double dX = bExt.x(), dY = bExt.y();
-      status = bExtension(lpoE, lmoE, Z, direction, dX, dY, lext);
+      status = bExtension(lpoE, lmoE, Z, direction, volE.dX, volE.dY, lext);
     } else {
-      critical(R"(Bad input data: CellID {:x} has invalid shape "{}")", refID, shape.type());
+      critical(R"(Bad input data: CellID {:x} has invalid shape "{}")", refID,
+               ref.element.solid().type());
       throw std::runtime_error(R"(Inconsistency: Inappropriate SimHits fed to "MPGDTrackerDigi".)");
     }
     if (status != 0x1)
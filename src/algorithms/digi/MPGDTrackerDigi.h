@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <DD4hep/DetElement.h>
 #include <DD4hep/Detector.h>
 #include <DD4hep/Objects.h>
 #include <DD4hep/Segmentations.h>
 #include <Parsers/Primitives.h>
+#include <TGeoMatrix.h>
 #include <algorithms/algorithm.h>
 #include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
 #include <edm4eic/MCRecoTrackerHitLinkCollection.h>
@@ -21,10 +23,12 @@
 #include <random>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "MPGDTrackerDigiConfig.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/UniqueIDGenSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
@@ -51,13 +55,28 @@ public:
   void process(const Input&, const Output&) const final;
 
 private:
-  const algorithms::UniqueIDGenSvc& m_uid = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::UniqueIDGenSvc& m_uid    = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::DataModeSvc& m_data_mode = algorithms::DataModeSvc::instance();
 
   // IDDESCRIPTOR and SEGMENTATION
   void parseIDDescriptor();
   void parseSegmentation();
   double m_gridAngle{0};
 
+  // SUBVOLUMES: shape and placement, cached at init
+  struct SubVolume {
+    dd4hep::DetElement element;
+    int shape{-1};                 // 0: "TGeoTubeSeg", 1: "TGeoBBox", -1: other
+    TGeoHMatrix toVolume;          // Copy of the nominal world transformation
+    double rMin{0}, rMax{0};       // Tube radii
+    double startPhi{0}, endPhi{0}; // Tube phi range, in [-pi,+pi]
+    double dX{0}, dY{0}, dZ{0};    // Half lengths (dZ also for tubes)
+  };
+  void cacheSubVolumes(const dd4hep::DetElement& element);
+  static SubVolume makeSubVolume(const dd4hep::DetElement& element);
+  const SubVolume& getSubVolume(dd4hep::CellID vID, SubVolume& uncached) const;
+  std::unordered_map<dd4hep::CellID, SubVolume> m_subVolumes; // Keyed by "volume" bits
+
   // COALESCE and EXTEND
   bool cCoalesceExtend(const Input& input, int& idx, std::vector<std::uint64_t>& cIDs, double* lpos,
                        double& eDep, double& time) const;
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+//
+// Sparse pixel noise patterns, sampled per event or drawn from a pre-generated library
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "algorithms/interfaces/CounterRNG.h"
+
+namespace eicrecon {
+
+/// Fill `indices` with a Poisson distributed number (of `mean`) of distinct pixels out of
+/// `num_pixels`, in increasing order, drawn without replacement (Floyd's algorithm)
+inline void sample_noise_pixels(CounterRNG& rng, std::uint64_t num_pixels, double mean,
+                                std::vector<std::uint64_t>& indices) {
+  indices.clear();
+  if (num_pixels == 0 || !(mean > 0)) {
+    return;
+  }
+  std::poisson_distribution<std::uint64_t> poisson(mean);
+  const std::uint64_t k = std::min(poisson(rng), num_pixels);
+
+  std::unordered_set<std::uint64_t> selected;
+  selected.reserve(k);
+  indices.reserve(k);
+  for (std::uint64_t j = num_pixels - k; j < num_pixels; ++j) {
+    std::uniform_int_distribution<std::uint64_t> pixel(0, j);
+    auto index = pixel(rng);
+    if (!selected.insert(index).second) {
+      index = j;
+      selected.insert(index);
+    }
+    indices.push_back(index);
+  }
+  std::sort(indices.begin(), indices.end());
+}
+
+/**
+ * Library of pre-generated noise patterns over a set of `num_pixels` equivalent pixels.
+ *
+ * Every entry is a sorted array of distinct pixel indices, sampled as in
+ * `sample_noise_pixels`. An event draws one entry and applies a random cyclic offset
+ * and reflection of the pixel indices, which keeps the pattern uniform over the pixels
+ * and sorted, so the same few patterns do not visibly repeat. This replaces the per-event
+ * Poisson and pixel draws by a copy when the noise generation would otherwise dominate.
+ */
+class NoiseLibrary {
+public:
+  NoiseLibrary() = default;
+
+  /// Generate `num_entries` patterns with `mean` noisy pixels on average; entry `i` is
+  /// drawn from stream `i` of `key`
+  NoiseLibrary(std::uint64_t num_pixels, double mean, std::size_t num_entries, std::uint64_t key)
+      : m_num_pixels(num_pixels), m_mean(mean), m_key(key) {
+    std::vector<std::uint64_t> indices;
+    m_offsets.reserve(num_entries + 1);
+    for (std::size_t entry = 0; entry < num_entries; ++entry) {
+      CounterRNG rng(key, entry);
+      sample_noise_pixels(rng, num_pixels, mean, indices);
+      m_indices.insert(m_indices.end(), indices.begin(), indices.end());
+      m_offsets.push_back(m_indices.size());
+    }
+  }
+
+  std::uint64_t numPixels() const { return m_num_pixels; }
+  double mean() const { return m_mean; }
+  std::uint64_t key() const { return m_key; }
+  std::size_t size() const { return m_offsets.size() - 1; }
+  bool empty() const { return size() == 0; }
+
+  std::span<const std::uint64_t> entry(std::size_t i) const {
+    return std::span{m_indices}.subspan(m_offsets[i], m_offsets[i + 1] - m_offsets[i]);
+  }
+
+  /// Fill `indices` with the sorted pixel indices of a random, randomly shifted entry
+  void draw(CounterRNG& rng, std::vector<std::uint64_t>& indices) const {
+    indices.clear();
+    if (empty() || m_num_pixels == 0) {
+      return;
+    }
+    const auto pattern = entry(std::uniform_int_distribution<std::size_t>(0, size() - 1)(rng));
+    const auto offset  = std::uniform_int_distribution<std::uint64_t>(0, m_num_pixels - 1)(rng);
+    const bool reflect = (rng() & 1) != 0;
+
+    // indices wrapping around the end come first after the shift
+    const auto wrap = std::lower_bound(pattern.begin(), pattern.end(), m_num_pixels - offset);
+    indices.reserve(pattern.size());
+    for (auto it = wrap; it != pattern.end(); ++it) {
+      indices.push_back(*it - (m_num_pixels - offset));
+    }
+    for (auto it = pattern.begin(); it != wrap; ++it) {
+      indices.push_back(*it + offset);
+    }
+    if (reflect) {
+      std::reverse(indices.begin(), indices.end());
+      for (auto& index : indices) {
+        index = m_num_pixels - 1 - index;
+      }
+    }
+  }
+
+  /// Text format: a header line `noise-library <num_pixels> <num_entries> <mean> <key>`,
+  /// then one line per entry with the number of pixels followed by the pixel indices. The
+  /// mean is written with enough digits to read back exactly.
+  void write(std::ostream& out) const {
+    const auto precision = out.precision(std::numeric_limits<double>::max_digits10);
+    out << "noise-library " << m_num_pixels << ' ' << size() << ' ' << m_mean << ' ' << m_key
+        << '\n';
+    out.precision(precision);
+    for (std::size_t i = 0; i < size(); ++i) {
+      const auto pattern = entry(i);
+      out << pattern.size();
+      for (const auto index : pattern) {
+        out << ' ' << index;
+      }
+      out << '\n';
+    }
+  }
+
+  static NoiseLibrary read(std::istream& in) {
+    NoiseLibrary library;
+    std::string tag;
+    std::size_t num_entries = 0;
+    if (!(in >> tag >> library.m_num_pixels >> num_entries >> library.m_mean >> library.m_key) ||
+        tag != "noise-library") {
+      throw std::runtime_error("malformed noise library header");
+    }
+    library.m_offsets.reserve(num_entries + 1);
+    for (std::size_t entry = 0; entry < num_entries; ++entry) {
+      std::size_t count = 0;
+      if (!(in >> count)) {
+        throw std::runtime_error("truncated noise library");
+      }
+      const auto begin = library.m_indices.size();
+      library.m_indices.resize(begin + count);
+      for (std::size_t i = begin; i < begin + count; ++i) {
+        if (!(in >> library.m_indices[i]) || library.m_indices[i] >= library.m_num_pixels ||
+            (i > begin && library.m_indices[i] <= library.m_indices[i - 1])) {
+          throw std::runtime_error("noise library entries must be sorted, distinct pixels");
+        }
+      }
+      library.m_offsets.push_back(library.m_indices.size());
+    }
+    return library;
+  }
+
+private:
+  std::uint64_t m_num_pixels{0};
+  double m_mean{0};
+  std::uint64_t m_key{0};
+  // pixel indices of all entries, entry `i` is [m_offsets[i], m_offsets[i + 1])
+  std::vector<std::uint64_t> m_indices;
+  std::vector<std::size_t> m_offsets{0};
+};
+
+} // namespace eicrecon
@@ -22,11 +22,13 @@
 #include <podio/detail/LinkCollectionImpl.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <tuple>
 
 #include "algorithms/digi/PhotoMultiplierHitDigiConfig.h"
+#include "algorithms/interfaces/SortedGrouping.h"
 
 namespace eicrecon {
 
@@ -48,6 +50,7 @@ void PhotoMultiplierHitDigi::process(const PhotoMultiplierHitDigi::Input& input,
                                      const PhotoMultiplierHitDigi::Output& output) const {
   const auto [headers, sim_hits]     = input;
   auto [raw_hits, links, hit_assocs] = output;
+  const bool data_only               = m_data_mode.dataOnly();
 
   // local random generator
   auto seed = m_uid.getUniqueID(*headers, name());
@@ -56,8 +59,9 @@ void PhotoMultiplierHitDigi::process(const PhotoMultiplierHitDigi::Input& input,
   std::uniform_real_distribution<double> uniform;
 
   trace("{:=^70}", " call PhotoMultiplierHitDigi::process ");
-  std::unordered_map<CellIDType, std::vector<HitData>> hit_groups;
-  // collect the photon hit in the same cell
+  // accepted photon and noise hits, grouped by pixel below
+  thread_local std::vector<PixelHit> pixel_hits;
+  pixel_hits.clear();
   // calculate signal
   trace("{:-<70}", "Loop over simulated hits ");
   for (std::size_t sim_hit_index = 0; sim_hit_index < sim_hits->size(); sim_hit_index++) {
@@ -92,59 +96,64 @@ void PhotoMultiplierHitDigi::process(const PhotoMultiplierHitDigi::Input& input,
     auto time  = sim_hit.getTime();
     double amp = m_cfg.speMean + gaussian(generator) * m_cfg.speError;
 
-    // insert hit to `hit_groups`
-    InsertHit(hit_groups, id, amp, time, sim_hit_index, generator, gaussian);
-  }
-
-  // print `hit_groups`
-  if (level() <= algorithms::LogLevel::kTrace) {
-    trace("{:-<70}", "Accepted hit groups ");
-    for (auto& [id, hitVec] : hit_groups) {
-      for (auto& hit : hitVec) {
-        trace("hit_group: pixel id={:#018X} -> npe={} signal={} time={}", id, hit.npe, hit.signal,
-              hit.time);
-        for (auto i : hit.sim_hit_indices) {
-          trace(" - MC hit: EDep={}, id={}", sim_hits->at(i).getEDep(),
-                sim_hits->at(i).getObjectID().index);
-        }
-      }
-    }
+    pixel_hits.push_back(
+        {.cellID = id, .amp = amp, .time = time, .sim_hit_index = sim_hit_index, .is_noise = false});
   }
 
   //build noise raw hits
   if (m_cfg.enableNoise) {
     trace("{:=^70}", " BEGIN NOISE INJECTION ");
-    float p            = m_cfg.noiseRate * m_cfg.noiseTimeWindow;
-    auto cellID_action = [this, &gaussian, &generator, &hit_groups, &uniform](auto id) {
+    double p = m_cfg.noiseRate * m_cfg.noiseTimeWindow;
+    thread_local std::vector<CellIDType> noise_cellIDs;
+    m_RngCellIDs(noise_cellIDs, p, m_uid.getStreamKey(*headers, name()));
+    for (auto id : noise_cellIDs) {
       // cell time, signal amplitude
       double amp    = m_cfg.speMean + gaussian(generator) * m_cfg.speError;
       TimeType time = m_cfg.noiseTimeWindow * uniform(generator) / dd4hep::ns;
 
-      // insert in `hit_groups`, or if the pixel already has a hit, update `npe` and `signal`
-      this->InsertHit(hit_groups, id, amp, time,
-                      0, // not used
-                      generator, gaussian, true);
-    };
-    m_VisitRngCellIDs(cellID_action, p);
+      // merged with the signal hits of the pixel, if any, when grouping below
+      pixel_hits.push_back(
+          {.cellID = id, .amp = amp, .time = time, .sim_hit_index = 0, .is_noise = true});
+    }
+  }
+
+  // group hits by pixel; within a pixel, signal hits come first in input order, then noise
+  thread_local SortedGrouping<CellIDType> pixel_groups;
+  pixel_groups.clear();
+  pixel_groups.reserve(pixel_hits.size());
+  for (const auto& pixel_hit : pixel_hits) {
+    pixel_groups.add(pixel_hit.cellID);
   }
+  pixel_groups.sort();
 
   // build output `RawTrackerHit` and `MCRecoTrackerHitAssociation` collections
   trace("{:-<70}", "Digitized raw hits ");
-  for (auto& it : hit_groups) {
-    for (auto& data : it.second) {
+  std::vector<HitData> hit_groups;
+  for (const auto& [id, indices] : pixel_groups.groups()) {
+    // collect the photon hits in the same pixel and time window
+    hit_groups.clear();
+    for (std::uint32_t i : indices) {
+      InsertHit(hit_groups, pixel_hits[i], generator, gaussian);
+    }
+
+    for (auto& data : hit_groups) {
+      trace("hit_group: pixel id={:#018X} -> npe={} signal={} time={}", id, data.npe, data.signal,
+            data.time);
 
       // build `RawTrackerHit`
       auto raw_hit = raw_hits->create();
-      raw_hit.setCellID(it.first);
+      raw_hit.setCellID(id);
       raw_hit.setCharge(static_cast<decltype(edm4eic::RawTrackerHitData::charge)>(data.signal));
       raw_hit.setTimeStamp(static_cast<decltype(edm4eic::RawTrackerHitData::timeStamp)>(
           data.time / m_cfg.timeResolution));
       trace("raw_hit: cellID={:#018X} -> charge={} timeStamp={}", raw_hit.getCellID(),
             raw_hit.getCharge(), raw_hit.getTimeStamp());
 
-      // build `MCRecoTrackerHitAssociation` (for non-noise hits only)
-      if (!data.sim_hit_indices.empty()) {
+      // build `MCRecoTrackerHitAssociation` (for non-noise hits only, unless data-only)
+      if (!data_only && !data.sim_hit_indices.empty()) {
         for (auto i : data.sim_hit_indices) {
+          trace(" - MC hit: EDep={}, id={}", sim_hits->at(i).getEDep(),
+                sim_hits->at(i).getObjectID().index);
           // create link
           auto link = links->create();
           link.setFrom(raw_hit);
@@ -248,51 +257,32 @@ bool PhotoMultiplierHitDigi::qe_pass(double ev, double rand) const {
   return rand <= prob;
 }
 
-// add a hit to local `hit_groups` data structure
-// NOLINTBEGIN(bugprone-easily-swappable-parameters)
-void PhotoMultiplierHitDigi::InsertHit(
-    std::unordered_map<CellIDType, std::vector<HitData>>& hit_groups, CellIDType id, double amp,
-    TimeType time, std::size_t sim_hit_index, std::default_random_engine& generator,
-    std::normal_distribution<double>& gaussian,
-    bool is_noise_hit) const // NOLINTEND(bugprone-easily-swappable-parameters)
-{
-  auto it = hit_groups.find(id);
-  if (it != hit_groups.end()) {
-    std::size_t i = 0;
-    for (auto ghit = it->second.begin(); ghit != it->second.end(); ++ghit, ++i) {
-      if (std::abs(time - ghit->time) <= (m_cfg.hitTimeWindow)) {
-        // hit group found, update npe, signal, and list of MC hits
-        ghit->npe += 1;
-        ghit->signal += amp;
-        if (!is_noise_hit) {
-          ghit->sim_hit_indices.push_back(sim_hit_index);
-        }
-        trace(" -> add to group @ {:#018X}: signal={}", id, ghit->signal);
-        break;
+// add a hit to the time groups `hit_groups` of its pixel
+void PhotoMultiplierHitDigi::InsertHit(std::vector<HitData>& hit_groups, const PixelHit& hit,
+                                       std::default_random_engine& generator,
+                                       std::normal_distribution<double>& gaussian) const {
+  for (auto& ghit : hit_groups) {
+    if (std::abs(hit.time - ghit.time) <= (m_cfg.hitTimeWindow)) {
+      // hit group found, update npe, signal, and list of MC hits
+      ghit.npe += 1;
+      ghit.signal += hit.amp;
+      if (!hit.is_noise) {
+        ghit.sim_hit_indices.push_back(hit.sim_hit_index);
       }
+      trace(" -> add to group @ {:#018X}: signal={}", hit.cellID, ghit.signal);
+      return;
     }
-    // no hits group found
-    if (i >= it->second.size()) {
-      auto sig = amp + m_cfg.pedMean + m_cfg.pedError * gaussian(generator);
-      decltype(HitData::sim_hit_indices) indices;
-      if (!is_noise_hit) {
-        indices.push_back(sim_hit_index);
-      }
-      hit_groups.insert(
-          {id, {HitData{.npe = 1, .signal = sig, .time = time, .sim_hit_indices = indices}}});
-      trace(" -> no group found,");
-      trace("    so new group @ {:#018X}: signal={}", id, sig);
-    }
-  } else {
-    auto sig = amp + m_cfg.pedMean + m_cfg.pedError * gaussian(generator);
-    decltype(HitData::sim_hit_indices) indices;
-    if (!is_noise_hit) {
-      indices.push_back(sim_hit_index);
-    }
-    hit_groups.insert(
-        {id, {HitData{.npe = 1, .signal = sig, .time = time, .sim_hit_indices = indices}}});
-    trace(" -> new group @ {:#018X}: signal={}", id, sig);
   }
+
+  // no hits group found
+  auto sig = hit.amp + m_cfg.pedMean + m_cfg.pedError * gaussian(generator);
+  decltype(HitData::sim_hit_indices) indices;
+  if (!hit.is_noise) {
+    indices.push_back(hit.sim_hit_index);
+  }
+  hit_groups.push_back(
+      HitData{.npe = 1, .signal = sig, .time = hit.time, .sim_hit_indices = indices});
+  trace(" -> new group @ {:#018X}: signal={}", hit.cellID, sig);
 }
 
 } // namespace eicrecon
@@ -36,11 +36,11 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "PhotoMultiplierHitDigiConfig.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/UniqueIDGenSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
@@ -78,11 +78,21 @@ public:
     std::vector<std::size_t> sim_hit_indices;
   };
 
-  // set `m_VisitAllRngPixels`, a visitor to run an action (type
-  // `function<void(cellID)>`) on a selection of random CellIDs; must be
+  // local structure to hold an accepted photon or noise hit, before grouping
+  struct PixelHit {
+    CellIDType cellID;
+    double amp;
+    TimeType time;
+    std::size_t sim_hit_index;
+    bool is_noise;
+  };
+
+  // set `m_RngCellIDs`, which fills a list of distinct random noisy CellIDs,
+  // given the per-pixel noise probability and a per-event seed; must be
   // defined externally, since this would be detector-specific
-  void SetVisitRngCellIDs(std::function<void(std::function<void(CellIDType)>, float)> visitor) {
-    m_VisitRngCellIDs = visitor;
+  void SetRngCellIDs(
+      std::function<void(std::vector<CellIDType>&, double, std::uint64_t)> generator) {
+    m_RngCellIDs = generator;
   }
 
   // set `m_PixelGapMask`, which takes `cellID` and MC hit position, returning
@@ -93,10 +103,11 @@ public:
   }
 
 protected:
-  // visitor of all possible CellIDs (set with SetVisitRngCellIDs)
-  std::function<void(std::function<void(CellIDType)>, float)> m_VisitRngCellIDs =
-      [](std::function<void(CellIDType)> /* visitor_action */,
-         float /* p */) { /* default no-op */ };
+  // random noisy CellIDs (set with SetRngCellIDs)
+  std::function<void(std::vector<CellIDType>&, double, std::uint64_t)> m_RngCellIDs =
+      [](std::vector<CellIDType>& cellIDs, double /* p */, std::uint64_t /* seed */) {
+        cellIDs.clear();
+      };
 
   // pixel gap mask
   std::function<bool(CellIDType, dd4hep::Position)> m_PixelGapMask =
@@ -106,17 +117,17 @@ protected:
       };
 
 private:
-  // add a hit to local `hit_groups` data structure
-  void InsertHit(std::unordered_map<CellIDType, std::vector<HitData>>& hit_groups, CellIDType id,
-                 double amp, TimeType time, std::size_t sim_hit_index,
-                 std::default_random_engine& generator, std::normal_distribution<double>& gaussian,
-                 bool is_noise_hit = false) const;
+  // add a hit to the time groups `hit_groups` of its pixel
+  void InsertHit(std::vector<HitData>& hit_groups, const PixelHit& hit,
+                 std::default_random_engine& generator,
+                 std::normal_distribution<double>& gaussian) const;
 
   const dd4hep::Detector* m_detector{algorithms::GeoSvc::instance().detector()};
   const dd4hep::rec::CellIDPositionConverter* m_converter{
       algorithms::GeoSvc::instance().cellIDPositionConverter()};
 
-  const algorithms::UniqueIDGenSvc& m_uid = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::UniqueIDGenSvc& m_uid    = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::DataModeSvc& m_data_mode = algorithms::DataModeSvc::instance();
 
   // std::default_random_engine generator; // TODO: need something more appropriate here
   // std::normal_distribution<double> m_normDist; // defaults to mean=0, sigma=1
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <spdlog/spdlog.h>
+#include <cstddef>
 
 namespace eicrecon {
 class PhotoMultiplierHitDigiConfig {
@@ -25,6 +26,8 @@ public:
   bool enableNoise       = false;
   double noiseRate       = 20000; // [Hz]
   double noiseTimeWindow = 20.0;  // [ns]
+  // number of pre-generated noise patterns to draw from (0: sample noise pixels every event)
+  std::size_t noiseLibrarySize = 0;
 
   // SiPM pixels
   bool enablePixelGaps = false; // enable/disable removal of hits in gaps between pixels
@@ -72,6 +75,7 @@ std::ostream& operator<<(std::ostream& os, const PhotoMultiplierHitDigiConfig& c
   print_param("enableNoise", cfg.enableNoise);
   print_param("noiseRate", cfg.noiseRate);
   print_param("noiseTimeWindow", cfg.noiseTimeWindow);
+  print_param("noiseLibrarySize", cfg.noiseLibrarySize);
   os << fmt::format("{:-^60}", " Quantum Efficiency vs. Wavelength ") << std::endl;
   for (auto& [wl, qe] : cfg.quantumEfficiency)
     os << fmt::format("  {:>10} {:<}", wl, qe) << std::endl;
@@ -16,14 +16,15 @@
 #include <algorithm>
 #include <cmath>
 #include <gsl/pointers>
-#include <map>
 #include <numeric>
+#include <span>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "PulseCombiner.h"
+#include "algorithms/interfaces/SortedGrouping.h"
 
 namespace eicrecon {
 
@@ -59,28 +60,40 @@ void PulseCombiner::process(const PulseCombiner::Input& input,
   const auto [inPulses] = input;
   auto [outPulses]      = output;
 
-  // Create map containing vector of pulses from each CellID
-  std::map<uint64_t, std::vector<PulseType>> cell_pulses;
+  // Group pulses from each (masked) CellID
+  thread_local SortedGrouping<uint64_t> cell_groups;
+  cell_groups.clear();
+  cell_groups.reserve(inPulses->size());
   for (const PulseType& pulse : *inPulses) {
-    uint64_t shiftedCellID = pulse.getCellID() & m_detector_bitmask;
-    cell_pulses[shiftedCellID].push_back(pulse);
+    cell_groups.add(pulse.getCellID() & m_detector_bitmask);
   }
+  cell_groups.sort();
 
   // Loop over detector elements and combine pulses
-  for (const auto& [cellID, pulses] : cell_pulses) {
-    if (pulses.size() == 1) {
-      outPulses->push_back(pulses.at(0).clone());
+  std::vector<PulseType> pulses;
+  std::vector<std::size_t> cluster_starts;
+  for (const auto& [cellID, indices] : cell_groups.groups()) {
+    if (indices.size() == 1) {
+      outPulses->push_back((*inPulses)[indices[0]].clone());
       debug("CellID {} has only one pulse, no combination needed", cellID);
     } else {
-      std::vector<std::vector<PulseType>> clusters = clusterPulses(pulses);
-      for (auto cluster : clusters) {
+      pulses.clear();
+      for (std::uint32_t index : indices) {
+        pulses.push_back((*inPulses)[index]);
+      }
+      clusterPulses(pulses, cluster_starts);
+      const std::size_t n_clusters = cluster_starts.size() - 1;
+      for (std::size_t i_cluster = 0; i_cluster < n_clusters; ++i_cluster) {
+        const std::span<const PulseType> cluster{pulses.data() + cluster_starts[i_cluster],
+                                                 cluster_starts[i_cluster + 1] -
+                                                     cluster_starts[i_cluster]};
         // Clone the first pulse in the cluster
         auto sum_pulse = outPulses->create();
         sum_pulse.setCellID(cluster[0].getCellID());
         sum_pulse.setInterval(cluster[0].getInterval());
         sum_pulse.setTime(cluster[0].getTime());
 
-        auto newPulse = sumPulses(cluster);
+        auto newPulse = sumPulses<PulseType>(cluster);
         for (auto pulse : newPulse) {
           sum_pulse.addToAmplitude(pulse);
         }
@@ -90,7 +103,7 @@ void PulseCombiner::process(const PulseCombiner::Input& input,
         sum_pulse.setIntegral(integral);
         sum_pulse.setPosition(edm4hep::Vector3f(
             cluster[0].getPosition().x, cluster[0].getPosition().y, cluster[0].getPosition().z));
-        for (auto pulse : cluster) {
+        for (const auto& pulse : cluster) {
           sum_pulse.addToPulses(pulse);
           for (auto particle : pulse.getParticles()) {
             sum_pulse.addToParticles(particle);
@@ -104,75 +117,10 @@ void PulseCombiner::process(const PulseCombiner::Input& input,
         }
       }
       debug("CellID {} has {} pulses, combined into {} clusters", cellID, pulses.size(),
-            clusters.size());
+            n_clusters);
     }
   }
 
 } // PulseCombiner:process
 
-std::vector<std::vector<PulseType>>
-PulseCombiner::clusterPulses(const std::vector<PulseType> pulses) const {
-
-  // Clone the pulses array of pointers so they aren't const
-  std::vector<PulseType> ordered_pulses{pulses};
-
-  // Sort pulses by time, greaty simplifying the combination process
-  std::ranges::sort(ordered_pulses,
-                    [](PulseType a, PulseType b) { return a.getTime() < b.getTime(); });
-
-  // Create vector of pulses
-  std::vector<std::vector<PulseType>> cluster_pulses;
-  float clusterEndTime = 0;
-  bool makeNewPulse    = true;
-  // Create clusters of pulse indices which overlap with at least the minimum separation
-  for (auto pulse : ordered_pulses) {
-    float pulseStartTime = pulse.getTime();
-    float pulseEndTime   = pulse.getTime() + pulse.getInterval() * pulse.getAmplitude().size();
-    if (!makeNewPulse) {
-      if (pulseStartTime < clusterEndTime + m_cfg.minimum_separation) {
-        cluster_pulses.back().push_back(pulse);
-        clusterEndTime = std::max(clusterEndTime, pulseEndTime);
-      } else {
-        makeNewPulse = true;
-      }
-    }
-    if (makeNewPulse) {
-      cluster_pulses.push_back({pulse});
-      clusterEndTime = pulseEndTime;
-      makeNewPulse   = false;
-    }
-  }
-
-  return cluster_pulses;
-
-} // PulseCombiner::clusterPulses
-
-std::vector<float> PulseCombiner::sumPulses(const std::vector<PulseType> pulses) {
-
-  // Find maximum time of pulses in cluster
-  float maxTime = 0;
-  for (auto pulse : pulses) {
-    maxTime =
-        std::max(maxTime, pulse.getTime() + pulse.getInterval() * pulse.getAmplitude().size());
-  }
-
-  //Calculate maxTime in interval bins
-  int maxStep = std::round((maxTime - pulses[0].getTime()) / pulses[0].getInterval());
-
-  std::vector<float> newPulse(maxStep, 0.0);
-
-  for (auto pulse : pulses) {
-    //Calculate start and end of pulse in interval bins
-    int startStep = (pulse.getTime() - pulses[0].getTime()) / pulse.getInterval();
-    int pulseSize = pulse.getAmplitude().size();
-    int endStep   = startStep + pulseSize;
-    for (int i = startStep; i < endStep; i++) {
-      // Add pulse values to new pulse
-      newPulse[i] += pulse.getAmplitude()[i - startStep];
-    }
-  }
-
-  return newPulse;
-} // PulseCombiner::sumPulses
-
 } // namespace eicrecon
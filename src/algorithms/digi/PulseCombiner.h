@@ -8,7 +8,11 @@
 
 #include <algorithms/algorithm.h>
 #include <edm4eic/SimPulseCollection.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -32,9 +36,69 @@ public:
   virtual void init() final;
   void process(const Input&, const Output&) const final;
 
+  /// Mask of the cellID fields pulses are combined over
+  uint64_t cellMask() const { return m_detector_bitmask; }
+
+  /// Sort the pulses of one cell by time and record where each cluster of overlapping
+  /// pulses starts, followed by pulses.size(). PulseT provides getTime(), getInterval()
+  /// and getAmplitude(), as PulseType does.
+  template <typename PulseT>
+  void clusterPulses(std::vector<PulseT>& pulses, std::vector<std::size_t>& cluster_starts) const {
+
+    // Sort pulses by time, greaty simplifying the combination process
+    std::ranges::sort(pulses, [](const PulseT& a, const PulseT& b) {
+      return a.getTime() < b.getTime();
+    });
+
+    // Record where each cluster starts in the sorted pulses
+    cluster_starts.clear();
+    float clusterEndTime = 0;
+    // Create clusters of pulses which overlap with at least the minimum separation
+    for (std::size_t i = 0; i < pulses.size(); ++i) {
+      const auto& pulse    = pulses[i];
+      float pulseStartTime = pulse.getTime();
+      float pulseEndTime   = pulse.getTime() + pulse.getInterval() * pulse.getAmplitude().size();
+      if (i > 0 && pulseStartTime < clusterEndTime + m_cfg.minimum_separation) {
+        clusterEndTime = std::max(clusterEndTime, pulseEndTime);
+      } else {
+        cluster_starts.push_back(i);
+        clusterEndTime = pulseEndTime;
+      }
+    }
+    cluster_starts.push_back(pulses.size());
+
+  } // PulseCombiner::clusterPulses
+
+  /// Sum a cluster of pulses, sorted by time, into one amplitude series
+  template <typename PulseT> static std::vector<float> sumPulses(std::span<const PulseT> pulses) {
+
+    // Find maximum time of pulses in cluster
+    float maxTime = 0;
+    for (const auto& pulse : pulses) {
+      maxTime =
+          std::max(maxTime, pulse.getTime() + pulse.getInterval() * pulse.getAmplitude().size());
+    }
+
+    //Calculate maxTime in interval bins
+    int maxStep = std::round((maxTime - pulses[0].getTime()) / pulses[0].getInterval());
+
+    std::vector<float> newPulse(maxStep, 0.0);
+
+    for (const auto& pulse : pulses) {
+      //Calculate start and end of pulse in interval bins
+      int startStep = (pulse.getTime() - pulses[0].getTime()) / pulse.getInterval();
+      int pulseSize = pulse.getAmplitude().size();
+      int endStep   = startStep + pulseSize;
+      for (int i = startStep; i < endStep; i++) {
+        // Add pulse values to new pulse
+        newPulse[i] += pulse.getAmplitude()[i - startStep];
+      }
+    }
+
+    return newPulse;
+  } // PulseCombiner::sumPulses
+
 private:
-  std::vector<std::vector<PulseType>> clusterPulses(const std::vector<PulseType> pulses) const;
-  static std::vector<float> sumPulses(const std::vector<PulseType> pulses);
   uint64_t m_detector_bitmask = 0xFFFFFFFFFFFFFFFF;
 };
 
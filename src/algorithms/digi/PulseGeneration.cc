@@ -12,15 +12,19 @@
 #include <edm4hep/MCParticle.h>
 #include <edm4hep/Vector3f.h>
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "PulseGeneration.h"
@@ -176,6 +180,105 @@ public:
   }
 };
 
+// ----------------------------------------------------------------------------
+// Tabulated Pulse Shape
+// ----------------------------------------------------------------------------
+// Pulse shape at unit charge on a regular time grid, interpolated linearly. For
+// shapes linear in charge, a pulse is the interpolated template scaled by the
+// charge. Running maxima of |shape| from either end of the grid give, for a
+// given threshold, the time range outside of which no sample can pass it.
+class PulseTemplate {
+public:
+  PulseTemplate(SignalPulse& pulse, double t_min, double t_max, double step, double tolerance)
+      : m_t_min(t_min), m_step(step), m_inv_step(1. / step) {
+    const auto n = static_cast<std::size_t>(std::ceil((t_max - t_min) / step)) + 2;
+    m_values.resize(n);
+    for (std::size_t k = 0; k < n; ++k) {
+      m_values[k] = pulse(t_min + k * step, 1.0);
+    }
+    for (double value : m_values) {
+      m_peak = std::max(m_peak, std::abs(value));
+    }
+
+    // drop the tail where the shape stays below tolerance, samples there are evaluated directly
+    m_tail = tolerance * m_peak;
+    std::size_t size = n;
+    while (size > 2 && std::abs(m_values[size - 1]) < m_tail) {
+      --size;
+    }
+    m_values.resize(std::min(size + 1, n));
+    m_values.shrink_to_fit();
+    m_t_max = m_t_min + (m_values.size() - 1) * m_step;
+
+    m_prefix_max.resize(m_values.size());
+    m_suffix_max.resize(m_values.size());
+    double running = 0;
+    for (std::size_t k = 0; k < m_values.size(); ++k) {
+      running         = std::max(running, std::abs(m_values[k]));
+      m_prefix_max[k] = running;
+    }
+    running = 0;
+    for (std::size_t k = m_values.size(); k-- > 0;) {
+      running         = std::max(running, std::abs(m_values[k]));
+      m_suffix_max[k] = running;
+    }
+  }
+
+  bool contains(double t) const { return t >= m_t_min && t <= m_t_max; }
+
+  double operator()(double t) const {
+    const double u      = std::max(0., (t - m_t_min) * m_inv_step);
+    const std::size_t k = std::min(static_cast<std::size_t>(u), m_values.size() - 2);
+    const double f      = u - k;
+    return m_values[k] + f * (m_values[k + 1] - m_values[k]);
+  }
+
+  double peak() const { return m_peak; }
+  double maxTime() const { return m_t_max; }
+
+  // Earliest time at which |shape| can reach `bound` (assumes bound <= peak)
+  double firstTime(double bound) const {
+    const auto k = std::ranges::lower_bound(m_prefix_max, bound) - m_prefix_max.begin();
+    return m_t_min + (k > 0 ? k - 1 : 0) * m_step;
+  }
+
+  // Latest time at which |shape| can reach `bound`, unbounded if the tail may reach it
+  double lastTime(double bound) const {
+    if (bound <= m_tail) {
+      return std::numeric_limits<double>::infinity();
+    }
+    const auto k = std::ranges::upper_bound(m_suffix_max, bound, std::greater{}) -
+                   m_suffix_max.begin();
+    return m_t_min + k * m_step;
+  }
+
+  // Largest deviation from the shape between grid points, relative to the peak, also
+  // comparing charges away from unity to check the linearity of the shape in charge
+  double maxRelativeError(SignalPulse& pulse) const {
+    constexpr std::array<double, 3> charges{1.0, 1e-3, 10.0};
+    double max_error = 0;
+    for (std::size_t k = 0; k + 1 < m_values.size(); ++k) {
+      const double t              = m_t_min + (k + 0.5) * m_step;
+      const double template_value = (*this)(t);
+      for (double charge : charges) {
+        max_error = std::max(max_error, std::abs(pulse(t, charge) / charge - template_value));
+      }
+    }
+    return m_peak > 0 ? max_error / m_peak : std::numeric_limits<double>::infinity();
+  }
+
+private:
+  double m_t_min;
+  double m_t_max;
+  double m_step;
+  double m_inv_step;
+  double m_peak{0};
+  double m_tail{0};
+  std::vector<double> m_values;
+  std::vector<double> m_prefix_max;
+  std::vector<double> m_suffix_max;
+};
+
 std::tuple<double, double>
 HitAdapter<edm4hep::SimTrackerHit>::getPulseSources(const edm4hep::SimTrackerHit& hit) {
   return {hit.getTime(), hit.getEDep()};
@@ -207,78 +310,156 @@ template <typename HitT> void PulseGeneration<HitT>::init() {
   m_min_sampling_time = m_cfg.min_sampling_time;
 
   m_min_sampling_time = std::max<double>(m_pulse->getMaximumTime(), m_min_sampling_time);
+
+  m_template.reset();
+  if (m_cfg.template_oversampling > 0) {
+    // sample times relative to the hit time lie in [-timestep, max_time_bins * timestep)
+    auto pulse_template = std::make_shared<const PulseTemplate>(
+        *m_pulse, -m_cfg.timestep, m_cfg.max_time_bins * m_cfg.timestep,
+        m_cfg.timestep / m_cfg.template_oversampling, m_cfg.template_tolerance);
+    const double error = pulse_template->maxRelativeError(*m_pulse);
+    if (error <= m_cfg.template_tolerance) {
+      this->debug("Tabulated pulse shape up to {} ns, relative error {}",
+                  pulse_template->maxTime() / edm4eic::unit::ns, error);
+      m_template = std::move(pulse_template);
+    } else {
+      this->warning("Pulse shape \"{}\" can not be tabulated within tolerance {} (error {}), "
+                    "evaluating it directly",
+                    m_cfg.pulse_shape_function, m_cfg.template_tolerance, error);
+    }
+  }
 }
 
 template <typename HitT>
-void PulseGeneration<HitT>::process(
-    const typename PulseGenerationAlgorithm<HitT>::Input& input,
-    const typename PulseGenerationAlgorithm<HitT>::Output& output) const {
-  const auto [simhits] = input;
-  auto [rawPulses]     = output;
-
+bool PulseGeneration<HitT>::generatePulse(double time, double charge,
+                                          std::vector<float>& amplitudes, double& start_time,
+                                          float& integral) const {
   // Cache pulse shape trait to avoid repeated method calls in hot path
   const bool is_unimodal = m_pulse->isUnimodal();
 
-  for (const auto& hit : *simhits) {
-    const auto [time, charge] = HitAdapter<HitT>::getPulseSources(hit);
+  // tabulated samples of the current pulse
+  thread_local std::vector<double> samples;
 
-    // Calculate nearest timestep to the hit time rounded down (assume clocks aligned with time 0)
-    double signal_time = m_cfg.timestep * std::floor(time / m_cfg.timestep);
-
-    bool passed_threshold   = false;
-    std::uint32_t skip_bins = 0;
-    float previous          = 0;
-    float integral          = 0;
-    std::vector<float> pulse;
-
-    for (std::uint32_t i = 0; i < m_cfg.max_time_bins; i++) {
-      double t    = signal_time + i * m_cfg.timestep - time;
-      auto signal = (*m_pulse)(t, charge);
-
-      // Early exit conditions: below threshold and falling, or min sampling time after threshold
-      if (std::abs(signal) < m_cfg.ignore_thres) {
-        if (!passed_threshold) {
-          // Before threshold crossed - check if we can exit early
-          // For unimodal pulses: once falling below threshold, we've passed the peak
-          // For non-unimodal: must keep searching (may have multiple peaks)
-          if (is_unimodal) {
-            auto diff = std::abs(signal) - std::abs(previous);
-            previous  = signal;
-            if (diff >= 0) {
-              // Rising before threshold crossed
-              skip_bins = i;
-              continue;
-            } else {
-              // Falling without threshold ever crossed - safe to exit for unimodal
-              break;
-            }
-          } else {
-            // Conservative: keep searching for potential later peaks
+  // Calculate nearest timestep to the hit time rounded down (assume clocks aligned with time 0)
+  double signal_time = m_cfg.timestep * std::floor(time / m_cfg.timestep);
+
+  // Sample range [begin_bin, end_bin), of which [begin_bin, table_end_bin) is tabulated.
+  // With a template, bins before begin_bin are known to be below threshold, and after
+  // end_bin the pulse is known to have ended, so that they need not be sampled
+  std::uint32_t begin_bin     = 0;
+  std::uint32_t end_bin       = m_cfg.max_time_bins;
+  std::uint32_t table_end_bin = 0;
+
+  // last bin with a sample time not after t
+  auto bin_at = [&](double t) {
+    const double bin = std::floor((t - (signal_time - time)) / m_cfg.timestep);
+    return static_cast<std::uint32_t>(
+        std::clamp<double>(bin, 0, static_cast<double>(m_cfg.max_time_bins)));
+  };
+  if (m_template) {
+    if (charge == 0 || m_template->peak() * std::abs(charge) < m_cfg.ignore_thres) {
+      // no sample can pass the threshold
+      return false;
+    }
+    const double bound     = m_cfg.ignore_thres / std::abs(charge);
+    begin_bin              = bin_at(m_template->firstTime(bound));
+    const double last_time = std::max<double>(m_template->lastTime(bound), m_min_sampling_time);
+    if (std::isfinite(last_time)) {
+      // one more sample to stop at
+      end_bin = std::min(bin_at(last_time) + 2, m_cfg.max_time_bins);
+    }
+    table_end_bin = std::clamp(bin_at(m_template->maxTime()), begin_bin, end_bin);
+
+    samples.resize(table_end_bin - begin_bin);
+    for (std::uint32_t i = begin_bin; i < table_end_bin; i++) {
+      samples[i - begin_bin] = charge * (*m_template)(signal_time + i * m_cfg.timestep - time);
+    }
+  }
+  auto sample = [&](std::uint32_t i) -> double {
+    if (i >= begin_bin && i < table_end_bin) {
+      return samples[i - begin_bin];
+    }
+    double t = signal_time + i * m_cfg.timestep - time;
+    if (m_template && m_template->contains(t)) {
+      return charge * (*m_template)(t);
+    }
+    return (*m_pulse)(t, charge);
+  };
+
+  bool passed_threshold   = false;
+  std::uint32_t skip_bins = begin_bin > 0 ? begin_bin - 1 : 0;
+  float previous          = begin_bin > 0 ? sample(begin_bin - 1) : 0;
+  integral                = 0;
+  amplitudes.clear();
+
+  for (std::uint32_t i = begin_bin; i < end_bin; i++) {
+    double t    = signal_time + i * m_cfg.timestep - time;
+    auto signal = sample(i);
+
+    // Early exit conditions: below threshold and falling, or min sampling time after threshold
+    if (std::abs(signal) < m_cfg.ignore_thres) {
+      if (!passed_threshold) {
+        // Before threshold crossed - check if we can exit early
+        // For unimodal pulses: once falling below threshold, we've passed the peak
+        // For non-unimodal: must keep searching (may have multiple peaks)
+        if (is_unimodal) {
+          auto diff = std::abs(signal) - std::abs(previous);
+          previous  = signal;
+          if (diff >= 0) {
+            // Rising before threshold crossed
             skip_bins = i;
-            previous  = signal;
             continue;
-          }
-        } else {
-          // After threshold crossed, stop after min sampling time
-          if (t > m_min_sampling_time) {
+          } else {
+            // Falling without threshold ever crossed - safe to exit for unimodal
             break;
           }
+        } else {
+          // Conservative: keep searching for potential later peaks
+          skip_bins = i;
+          previous  = signal;
+          continue;
+        }
+      } else {
+        // After threshold crossed, stop after min sampling time
+        if (t > m_min_sampling_time) {
+          break;
         }
       }
-
-      passed_threshold = true;
-      pulse.push_back(signal);
-      integral += signal;
     }
 
-    if (!passed_threshold) {
+    passed_threshold = true;
+    amplitudes.push_back(signal);
+    integral += signal;
+  }
+
+  if (!passed_threshold) {
+    return false;
+  }
+  start_time = signal_time + skip_bins * m_cfg.timestep;
+  return true;
+}
+
+template <typename HitT>
+void PulseGeneration<HitT>::process(
+    const typename PulseGenerationAlgorithm<HitT>::Input& input,
+    const typename PulseGenerationAlgorithm<HitT>::Output& output) const {
+  const auto [simhits] = input;
+  auto [rawPulses]     = output;
+
+  std::vector<float> pulse;
+  for (const auto& hit : *simhits) {
+    const auto [time, charge] = HitAdapter<HitT>::getPulseSources(hit);
+
+    double start_time = 0;
+    float integral    = 0;
+    if (!generatePulse(time, charge, pulse, start_time, integral)) {
       continue;
     }
 
     auto time_series = rawPulses->create();
     time_series.setCellID(hit.getCellID());
     time_series.setInterval(m_cfg.timestep);
-    time_series.setTime(signal_time + skip_bins * m_cfg.timestep);
+    time_series.setTime(start_time);
 
     for (const auto& value : pulse) {
       time_series.addToAmplitude(value);
@@ -15,6 +15,7 @@
 #include <string_view>
 #include <tuple>
 #include <variant>
+#include <vector>
 
 #include "algorithms/digi/PulseGenerationConfig.h"
 #include "algorithms/interfaces/WithPodConfig.h"
@@ -42,6 +43,7 @@ using PulseGenerationAlgorithm =
                           algorithms::Output<PulseType::collection_type>>;
 
 class SignalPulse;
+class PulseTemplate;
 
 template <typename HitT>
 class PulseGeneration : public PulseGenerationAlgorithm<HitT>,
@@ -54,8 +56,14 @@ public:
   void process(const typename PulseGenerationAlgorithm<HitT>::Input&,
                const typename PulseGenerationAlgorithm<HitT>::Output&) const final;
 
+  /// Sample the pulse of a deposit of `charge` at `time` into `amplitudes`, with the
+  /// time of the first sample in `start_time`; false if the pulse never passes threshold
+  bool generatePulse(double time, double charge, std::vector<float>& amplitudes,
+                     double& start_time, float& integral) const;
+
 private:
   std::shared_ptr<SignalPulse> m_pulse;
+  std::shared_ptr<const PulseTemplate> m_template;
   float m_min_sampling_time = 0 * edm4eic::unit::ns;
 };
 
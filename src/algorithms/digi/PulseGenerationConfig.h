@@ -15,6 +15,14 @@ struct PulseGenerationConfig {
   double timestep          = 0.2 * edm4eic::unit::ns; // Minimum digitization time step
   double min_sampling_time = 0 * edm4eic::unit::ns;   // Minimum sampling time
   uint32_t max_time_bins   = 10000;
+
+  // Tabulation of the pulse shape at unit charge on a grid with step timestep / oversampling,
+  // interpolated instead of evaluating the shape per sample (0, the default, evaluates it
+  // directly). The table is only used for shapes linear in charge, with interpolation errors
+  // within the tolerance (relative to the pulse peak); otherwise the shape is evaluated
+  // directly. Enabling it changes the pulse amplitudes by up to the tolerance
+  uint32_t template_oversampling = 0;
+  double template_tolerance      = 1e-4;
 };
 
 } // namespace eicrecon
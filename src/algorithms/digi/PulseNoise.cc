@@ -9,8 +9,8 @@
 #include <edm4hep/SimCalorimeterHit.h>
 #include <edm4hep/SimTrackerHit.h>
 #include <podio/RelationRange.h>
-#include <cstddef>
 #include <random>
+#include <span>
 #include <tuple>
 #include <vector>
 
@@ -29,6 +29,7 @@ void PulseNoise::process(const PulseNoise::Input& input, const PulseNoise::Outpu
   std::default_random_engine generator(seed);
   dd4hep::detail::FalphaNoise falpha(m_cfg.poles, m_cfg.alpha, m_cfg.variance);
 
+  std::vector<float> amplitudes;
   for (const auto& pulse : *inPulses) {
 
     //Clone input pulse to a mutable output pulse
@@ -37,13 +38,11 @@ void PulseNoise::process(const PulseNoise::Input& input, const PulseNoise::Outpu
     out_pulse.setInterval(pulse.getInterval());
     out_pulse.setTime(pulse.getTime());
 
-    float integral = 0;
     //Add noise to the pulse
-    for (std::size_t i = 0; i < pulse.getAmplitude().size(); i++) {
-      double noise     = falpha(generator) * m_cfg.scale + m_cfg.pedestal;
-      double amplitude = pulse.getAmplitude()[i] + noise;
+    amplitudes.assign(pulse.getAmplitude().begin(), pulse.getAmplitude().end());
+    float integral = addNoise(amplitudes, generator, falpha);
+    for (float amplitude : amplitudes) {
       out_pulse.addToAmplitude(amplitude);
-      integral += amplitude;
     }
 
     out_pulse.setIntegral(integral);
@@ -63,4 +62,16 @@ void PulseNoise::process(const PulseNoise::Input& input, const PulseNoise::Outpu
   }
 
 } // PulseNoise:process
+
+float PulseNoise::addNoise(std::span<float> amplitudes, std::default_random_engine& generator,
+                           dd4hep::detail::FalphaNoise& falpha) const {
+  float integral = 0;
+  for (float& amplitude : amplitudes) {
+    double noise = falpha(generator) * m_cfg.scale + m_cfg.pedestal;
+    double noisy = amplitude + noise;
+    amplitude    = noisy;
+    integral += noisy;
+  }
+  return integral;
+} // PulseNoise::addNoise
 } // namespace eicrecon
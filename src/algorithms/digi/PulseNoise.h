@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <DDDigi/noise/FalphaNoise.h>
 #include <algorithms/algorithm.h>
 #include <edm4eic/SimPulseCollection.h>
 #include <edm4hep/EventHeaderCollection.h>
+#include <random>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -32,6 +35,10 @@ public:
   virtual void init() final;
   void process(const Input&, const Output&) const;
 
+  /// Add noise to `amplitudes` in place, returning their integral
+  float addNoise(std::span<float> amplitudes, std::default_random_engine& generator,
+                 dd4hep::detail::FalphaNoise& falpha) const;
+
 private:
   const algorithms::UniqueIDGenSvc& m_uid = algorithms::UniqueIDGenSvc::instance();
 };
@@ -32,6 +32,8 @@
 #include <array>
 #include <cctype>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <gsl/pointers>
 #include <initializer_list>
 #include <iterator>
@@ -39,11 +41,15 @@
 #include <mutex>
 #include <numbers>
 #include <optional>
+#include <random>
 #include <stdexcept>
+#include <system_error>
 #include <tuple>
 #include <utility>
 
+#include "algorithms/digi/NoiseLibrary.h"
 #include "algorithms/digi/RandomNoisePixelConfig.h"
+#include "algorithms/interfaces/CounterRNG.h"
 
 namespace eicrecon {
 namespace {
@@ -283,8 +289,10 @@ namespace {
 
     auto layout         = std::make_shared<RandomNoisePixel::PixelLayout>();
     layout->kind        = kind;
-    layout->firstField  = std::move(firstField);
-    layout->secondField = std::move(secondField);
+    layout->firstField       = std::move(firstField);
+    layout->secondField      = std::move(secondField);
+    layout->firstFieldIndex  = decoder.index(layout->firstField);
+    layout->secondFieldIndex = decoder.index(layout->secondField);
 
     // Step 2a: a box contains every candidate pixel center, so store four limits.
     if (isPureBox(*component.volume->GetShape())) {
@@ -425,17 +433,19 @@ namespace {
       throw std::runtime_error("RandomNoisePixel cylindrical component contains no pixels");
     }
 
-    auto layout         = std::make_shared<RandomNoisePixel::PixelLayout>();
-    layout->kind        = RandomNoisePixel::GridKind::CylindricalPhiZ;
-    layout->firstField  = grid.fieldNamePhi();
-    layout->secondField = grid.fieldNameZ();
-    layout->rectangular = true;
-    layout->firstMin    = phiIndexMin;
-    layout->firstMax    = phiIndexMax;
-    layout->secondMin   = zIndexMin;
-    layout->secondMax   = zIndexMax;
-    const auto phiCount = static_cast<std::uint64_t>(phiIndexMax - phiIndexMin + 1);
-    const auto zCount   = static_cast<std::uint64_t>(zIndexMax - zIndexMin + 1);
+    auto layout              = std::make_shared<RandomNoisePixel::PixelLayout>();
+    layout->kind             = RandomNoisePixel::GridKind::CylindricalPhiZ;
+    layout->firstField       = grid.fieldNamePhi();
+    layout->secondField      = grid.fieldNameZ();
+    layout->firstFieldIndex  = decoder.index(layout->firstField);
+    layout->secondFieldIndex = decoder.index(layout->secondField);
+    layout->rectangular      = true;
+    layout->firstMin         = phiIndexMin;
+    layout->firstMax         = phiIndexMax;
+    layout->secondMin        = zIndexMin;
+    layout->secondMax        = zIndexMax;
+    const auto phiCount      = static_cast<std::uint64_t>(phiIndexMax - phiIndexMin + 1);
+    const auto zCount        = static_cast<std::uint64_t>(zIndexMax - zIndexMin + 1);
     if (phiCount > std::numeric_limits<std::uint64_t>::max() / zCount) {
       throw std::overflow_error("RandomNoisePixel cylindrical pixel count overflow");
     }
@@ -521,6 +531,9 @@ void RandomNoisePixel::init() {
 
   // Step 6: the temporary transforms have now been released; construct layer totals.
   buildLayers();
+
+  // Step 7: optionally prepare pre-generated noise patterns for every layer.
+  buildNoiseLibraries();
   info("RandomNoisePixel '{}': cached {} sensitive components and {} layer groups for readout '{}'",
        name(), m_components.size(), m_layers.size(), m_cfg.readout_name);
 }
@@ -721,6 +734,78 @@ void RandomNoisePixel::buildLayers() {
   }
 }
 
+// Read the per-layer pattern libraries from file, or generate them and optionally
+// write them out, so that events only copy and shift one pattern per layer.
+void RandomNoisePixel::buildNoiseLibraries() {
+  m_noiseLibraries.clear();
+  if (m_cfg.noise_library_size == 0 && m_cfg.noise_library_file.empty()) {
+    return;
+  }
+
+  // Each layer draws its patterns from its own counter-based stream.
+  const auto key = m_uid.getStreamKey(name());
+  auto layerMean = [&](const LayerGeometry& layer) {
+    return m_cfg.noise_rate_per_pixel_per_event * static_cast<double>(layer.totalPixels);
+  };
+
+  if (!m_cfg.noise_library_file.empty()) {
+    std::ifstream in{m_cfg.noise_library_file};
+    if (in) {
+      for (std::size_t layerIndex = 0; layerIndex < m_layers.size(); ++layerIndex) {
+        const auto& layer = m_layers[layerIndex];
+        auto library      = NoiseLibrary::read(in);
+        // a library of another rate, size or seed would silently change the noise
+        if (library.numPixels() != layer.totalPixels || library.mean() != layerMean(layer) ||
+            library.key() != mix64(key, layerIndex) ||
+            (m_cfg.noise_library_size != 0 && library.size() != m_cfg.noise_library_size)) {
+          throw std::runtime_error("RandomNoisePixel noise library '" + m_cfg.noise_library_file +
+                                   "' does not match the pixel count, noise rate, library size "
+                                   "or seed of detector '" +
+                                   layer.detectorName + "' layer " + std::to_string(layer.layer));
+        }
+        m_noiseLibraries.push_back(std::move(library));
+      }
+      info("RandomNoisePixel '{}': read noise library '{}'", name(), m_cfg.noise_library_file);
+      return;
+    }
+    if (m_cfg.noise_library_size == 0) {
+      throw std::invalid_argument("RandomNoisePixel noise library file not found: " +
+                                  m_cfg.noise_library_file);
+    }
+  }
+
+  for (std::size_t layerIndex = 0; layerIndex < m_layers.size(); ++layerIndex) {
+    const auto& layer = m_layers[layerIndex];
+    m_noiseLibraries.emplace_back(layer.totalPixels, layerMean(layer), m_cfg.noise_library_size,
+                                  mix64(key, layerIndex));
+  }
+
+  if (!m_cfg.noise_library_file.empty()) {
+    // Every event thread initializes its own instance: write to a private file and rename
+    // it, so that other instances read either no file or a complete one.
+    const std::string tmpFile =
+        m_cfg.noise_library_file + ".tmp" + std::to_string(std::random_device{}());
+    std::ofstream out{tmpFile};
+    for (const auto& library : m_noiseLibraries) {
+      library.write(out);
+    }
+    out.close();
+    std::error_code ec;
+    if (!out) {
+      std::filesystem::remove(tmpFile, ec);
+      throw std::runtime_error("RandomNoisePixel could not write noise library: " + tmpFile);
+    }
+    std::filesystem::rename(tmpFile, m_cfg.noise_library_file, ec);
+    if (ec) {
+      const auto reason = ec.message();
+      std::filesystem::remove(tmpFile, ec);
+      throw std::runtime_error("RandomNoisePixel could not write noise library: " +
+                               m_cfg.noise_library_file + ": " + reason);
+    }
+    info("RandomNoisePixel '{}': wrote noise library '{}'", name(), m_cfg.noise_library_file);
+  }
+}
+
 // Derive the event RNG seed from the run/event identity and algorithm name.
 std::uint64_t
 RandomNoisePixel::seedFromEventHeader(const edm4hep::EventHeaderCollection& headers) const {
@@ -730,16 +815,38 @@ RandomNoisePixel::seedFromEventHeader(const edm4hep::EventHeaderCollection& head
   return m_uid.getUniqueID(headers, name());
 }
 
+// Encode one flat pixel index with the cached bit-field positions of its two fields.
+std::uint64_t RandomNoisePixel::encodeCellID(const SensitiveComponent& component,
+                                             std::uint64_t linearIndex) const {
+  const auto [firstIndex, secondIndex] = pixelIndices(*component.layout, linearIndex);
+  auto cellID                          = component.baseVolumeID;
+  const auto& decoder                  = *m_readout.idSpec().decoder();
+  decoder[component.layout->firstFieldIndex].set(cellID, firstIndex);
+  decoder[component.layout->secondFieldIndex].set(cellID, secondIndex);
+  return cellID;
+}
+
 // Select one pixel uniformly within a sensitive component and encode its fields.
 std::uint64_t RandomNoisePixel::randomCellID(const SensitiveComponent& component,
                                              std::mt19937_64& rng) const {
   std::uniform_int_distribution<std::uint64_t> pickPixel(0, component.pixelCount - 1);
-  const auto [firstIndex, secondIndex] = pixelIndices(*component.layout, pickPixel(rng));
-  auto cellID                          = component.baseVolumeID;
-  const auto* decoder                  = m_readout.idSpec().decoder();
-  decoder->set(cellID, component.layout->firstField, firstIndex);
-  decoder->set(cellID, component.layout->secondField, secondIndex);
-  return cellID;
+  return encodeCellID(component, pickPixel(rng));
+}
+
+// Sorted layer-wide indices visit components in order, so each component lookup
+// only searches forward from the previous one.
+void RandomNoisePixel::appendLayerCellIDs(const LayerGeometry& layer,
+                                          std::span<const std::uint64_t> indices,
+                                          std::vector<std::uint64_t>& cellIDs) const {
+  auto componentPosition = layer.cumulativePixels.begin();
+  for (const auto index : indices) {
+    componentPosition = std::upper_bound(componentPosition, layer.cumulativePixels.end(), index);
+    const auto componentOffset =
+        static_cast<std::size_t>(componentPosition - layer.cumulativePixels.begin());
+    const auto componentStart = componentOffset == 0 ? 0 : *(componentPosition - 1);
+    const auto& component     = m_components[layer.componentIndices[componentOffset]];
+    cellIDs.push_back(encodeCellID(component, index - componentStart));
+  }
 }
 
 // Generate noise for one layer using lambda = rate_per_pixel_per_event * N_pixels.
@@ -807,7 +914,30 @@ void RandomNoisePixel::process(const Input& in, const Output& out) const {
   }
 
   // Step 1: make the random sequence depend on event identity, not thread scheduling.
-  std::mt19937_64 rng(seedFromEventHeader(*headers));
+  const auto seed = seedFromEventHeader(*headers);
+
+  // With a noise library, draw one shifted pattern per layer and emit sorted cell IDs.
+  // Patterns hold distinct pixels and layers do not share sensors, so there are no duplicates.
+  if (!m_noiseLibraries.empty()) {
+    CounterRNG rng(seed, 0);
+    thread_local std::vector<std::uint64_t> indices;
+    thread_local std::vector<std::uint64_t> cellIDs;
+    cellIDs.clear();
+    for (std::size_t layerIndex = 0; layerIndex < m_layers.size(); ++layerIndex) {
+      m_noiseLibraries[layerIndex].draw(rng, indices);
+      appendLayerCellIDs(m_layers[layerIndex], indices, cellIDs);
+    }
+    std::sort(cellIDs.begin(), cellIDs.end());
+    for (const auto cellID : cellIDs) {
+      auto hit = outHits->create();
+      hit.setCellID(cellID);
+      hit.setCharge(1.0e6);
+      hit.setTimeStamp(0);
+    }
+    return;
+  }
+
+  std::mt19937_64 rng(seed);
 
   // Step 2: a sorted map removes duplicates and gives stable output ordering.
   std::map<std::uint64_t, edm4eic::MutableRawTrackerHit> noiseHits;
@@ -17,12 +17,14 @@
 #include <map>
 #include <memory>
 #include <random>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "RandomNoisePixelConfig.h"
 #include "algorithms/algorithm.h"
+#include "algorithms/digi/NoiseLibrary.h"
 #include "algorithms/interfaces/UniqueIDGenSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
@@ -66,6 +68,8 @@ public:
     GridKind kind = GridKind::CartesianXY;
     std::string firstField;
     std::string secondField;
+    std::size_t firstFieldIndex  = 0;
+    std::size_t secondFieldIndex = 0;
     bool rectangular       = false;
     std::int64_t firstMin  = 0;
     std::int64_t firstMax  = -1;
@@ -119,12 +123,22 @@ private:
   // Group cached components by detector/layer and calculate cumulative pixel counts.
   void buildLayers();
 
+  // Generate, read or write the per-layer noise pattern libraries.
+  void buildNoiseLibraries();
+
   // Produce a deterministic seed from a required EventHeader collection.
   std::uint64_t seedFromEventHeader(const edm4hep::EventHeaderCollection& headers) const;
 
+  // Encode the complete cell ID of one flat pixel index within a component.
+  std::uint64_t encodeCellID(const SensitiveComponent& component, std::uint64_t linearIndex) const;
+
   // Select one addressable pixel from a component and encode its complete cell ID.
   std::uint64_t randomCellID(const SensitiveComponent& component, std::mt19937_64& rng) const;
 
+  // Encode sorted layer-wide pixel indices, e.g. from a noise library entry.
+  void appendLayerCellIDs(const LayerGeometry& layer, std::span<const std::uint64_t> indices,
+                          std::vector<std::uint64_t>& cellIDs) const;
+
   // Draw and create the Poisson-distributed noise hits for one detector layer.
   void addNoiseHitsForLayer(const LayerGeometry& layer,
                             std::map<std::uint64_t, edm4eic::MutableRawTrackerHit>& hitMap,
@@ -133,6 +147,7 @@ private:
   dd4hep::Readout m_readout;
   std::vector<SensitiveComponent> m_components;
   std::vector<LayerGeometry> m_layers;
+  std::vector<NoiseLibrary> m_noiseLibraries;
   const dd4hep::Detector* m_dd4hepGeo                     = nullptr;
   const dd4hep::rec::CellIDPositionConverter* m_converter = nullptr;
   const algorithms::UniqueIDGenSvc& m_uid                 = algorithms::UniqueIDGenSvc::instance();
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace eicrecon {
@@ -17,6 +18,15 @@ struct RandomNoisePixelConfig {
 
   // DD4hep readout whose sensitive components and segmentation should be used.
   std::string readout_name = "VertexBarrelHits";
+
+  // Number of pre-generated noise patterns per layer; each event draws one shifted
+  // pattern per layer instead of sampling pixels. Zero samples pixels in every event.
+  std::size_t noise_library_size = 0;
+
+  // Optional pattern library file. It is read when it exists, and otherwise written
+  // after generating noise_library_size patterns at initialization. A file generated
+  // with another noise rate, library size or random seed is rejected.
+  std::string noise_library_file = "";
 };
 
 } // namespace eicrecon
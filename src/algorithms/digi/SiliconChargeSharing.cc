@@ -11,6 +11,7 @@
 #include <DD4hep/Shapes.h>
 #include <DD4hep/VolumeManager.h>
 #include <DD4hep/detail/SegmentationsInterna.h>
+#include <DD4hep/detail/VolumeManagerInterna.h>
 #include <DDSegmentation/MultiSegmentation.h>
 #include <DDSegmentation/Segmentation.h>
 #include <Evaluator/DD4hepUnits.h>
@@ -21,13 +22,17 @@
 #include <TGeoMatrix.h>
 #include <algorithms/geo.h>
 #include <edm4hep/Vector3d.h>
+#include <fmt/format.h>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <gsl/pointers>
 #include <numbers>
-#include <set>
 #include <stdexcept>
 #include <tuple>
 #include <typeinfo>
+#include <unordered_set>
 #include <utility>
 
 #include "DD4hep/Detector.h"
@@ -36,9 +41,102 @@
 
 namespace eicrecon {
 
+namespace {
+  // bin conventions of DDSegmentation::Segmentation
+  int positionToBin(double position, double cellSize, double offset) {
+    return static_cast<int>(std::floor((position + 0.5 * cellSize - offset) / cellSize));
+  }
+  double binToPosition(int bin, double cellSize, double offset) { return bin * cellSize + offset; }
+} // namespace
+
 void SiliconChargeSharing::init() {
-  m_converter = algorithms::GeoSvc::instance().cellIDPositionConverter();
-  m_seg       = algorithms::GeoSvc::instance().detector()->readout(m_cfg.readout).segmentation();
+  m_seg = algorithms::GeoSvc::instance().detector()->readout(m_cfg.readout).segmentation();
+
+  // tabulate erf, linear interpolation is accurate to ~1e-7
+  m_erf_table.resize(static_cast<std::size_t>(erf_table_max * erf_table_scale) + 2);
+  for (std::size_t i = 0; i < m_erf_table.size(); ++i) {
+    m_erf_table[i] = std::erf(i / erf_table_scale);
+  }
+
+  // volume IDs are cellIDs without the x and y fields of the (sub)segmentations
+  dd4hep::rec::CellID segmentation_mask = 0;
+  std::function<void(const dd4hep::DDSegmentation::Segmentation*)> add_fields =
+      [&](const dd4hep::DDSegmentation::Segmentation* segmentation) {
+        if (const auto* multi =
+                dynamic_cast<const dd4hep::DDSegmentation::MultiSegmentation*>(segmentation)) {
+          for (const auto& entry : multi->subSegmentations()) {
+            add_fields(entry.segmentation);
+          }
+        } else if (const auto* grid =
+                       dynamic_cast<const dd4hep::DDSegmentation::CartesianGridXY*>(
+                           segmentation)) {
+          const auto& decoder = *grid->decoder();
+          segmentation_mask |= decoder[grid->fieldNameX()].mask();
+          segmentation_mask |= decoder[grid->fieldNameY()].mask();
+        }
+      };
+  add_fields(m_seg.segmentation());
+  m_volume_mask = ~segmentation_mask;
+
+  // cache every sensitive volume context of the detectors with this readout, i.e. every
+  // context that a cellID of this readout can resolve to
+  const auto* detector = algorithms::GeoSvc::instance().detector();
+  std::unordered_set<const dd4hep::DetElement::Object*> subdetectors;
+  for (const auto& [name, subdetector] : detector->detectors()) {
+    const auto sensitive = detector->sensitiveDetector(name);
+    if (sensitive.isValid() && sensitive.readout().isValid() &&
+        sensitive.readout().name() == m_cfg.readout) {
+      subdetectors.insert(subdetector.ptr());
+    }
+  }
+  cacheSensors(detector->volumeManager(), subdetectors);
+  debug("Cached {} sensors for readout {}", m_sensors.size(), m_cfg.readout);
+}
+
+// Recursively cache the volume contexts of a volume manager and its subdetector managers
+// that belong to one of the subdetectors
+void SiliconChargeSharing::cacheSensors(
+    const dd4hep::VolumeManager& manager,
+    const std::unordered_set<const dd4hep::DetElement::Object*>& subdetectors) {
+  if (!manager.isValid()) {
+    return;
+  }
+  for (const auto& [volumeID, context] : manager->volumes) {
+    for (auto element = context->element; element.isValid(); element = element.parent()) {
+      if (subdetectors.contains(element.ptr())) {
+        m_sensors.try_emplace(volumeID & m_volume_mask, makeSensorInfo(*context, volumeID));
+        break;
+      }
+    }
+  }
+  for (const auto& [systemID, subdetector_manager] : manager->subdetectors) {
+    cacheSensors(subdetector_manager, subdetectors);
+  }
+}
+
+SiliconChargeSharing::SensorInfo
+SiliconChargeSharing::makeSensorInfo(const dd4hep::VolumeManagerContext& context,
+                                     const dd4hep::rec::CellID& cellID) const {
+  const auto& element = context.element;
+
+  SensorInfo sensor;
+  sensor.transform    = &element.nominal().worldTransformation();
+  sensor.cellToGlobal = element.nominal().worldTransformation();
+  sensor.cellToGlobal.Multiply(context.toElement());
+  sensor.segmentation = getLocalSegmentation(cellID);
+  const auto& decoder = *sensor.segmentation->decoder();
+  sensor.xFieldIndex  = decoder.index(sensor.segmentation->fieldNameX());
+  sensor.yFieldIndex  = decoder.index(sensor.segmentation->fieldNameY());
+
+  // Try and get a box of the detectorElement solid requiring segmentation
+  // to be a CartesianGridXY, throwing exception in getLocalSegmentation
+  try {
+    dd4hep::Box box = element.solid();
+    sensor.xy_range = {box->GetDX(), box->GetDY()};
+  } catch (const std::bad_cast& e) {
+    error("Failed to cast solid to Box: {}", e.what());
+  }
+  return sensor;
 }
 
 void SiliconChargeSharing::process(const SiliconChargeSharing::Input& input,
@@ -46,120 +144,164 @@ void SiliconChargeSharing::process(const SiliconChargeSharing::Input& input,
   const auto [simhits] = input;
   auto [sharedHits]    = output;
 
+  thread_local std::vector<float> x_fractions;
+  thread_local std::vector<float> y_fractions;
+
   for (const auto& hit : *simhits) {
 
     auto cellID = hit.getCellID();
 
-    const auto* element = &m_converter->findContext(cellID)->element; // volume context
-    // ToDo: Move this to init() and set it once for every detelement associated with the readout
-    // Set transformation map if it hasn't already been set
-    auto [transformIt, transformInserted] =
-        m_transform_map.try_emplace(element, &element->nominal().worldTransformation());
-    auto [segmentationIt, segmentationInserted] =
-        m_segmentation_map.try_emplace(element, getLocalSegmentation(cellID));
-
-    // Try and get a box of the detectorElement solid requiring segmentation
-    // to be a CartesianGridXY, throwing exception in getLocalSegmentation
-    try {
-      dd4hep::Box box = element->solid();
-      m_xy_range_map.try_emplace(element, box->GetDX(), box->GetDY());
-    } catch (const std::bad_cast& e) {
-      error("Failed to cast solid to Box: {}", e.what());
+    // All sensors are cached at init, a miss is a cellID the volume manager cannot resolve
+    auto sensorIt = m_sensors.find(cellID & m_volume_mask);
+    if (sensorIt == m_sensors.end()) {
+      throw std::runtime_error(
+          fmt::format("SiliconChargeSharing: no sensor of readout {} for cellID 0x{:016x}",
+                      m_cfg.readout, cellID));
     }
+    const SensorInfo* sensor = &sensorIt->second;
+    const auto& segmentation = *sensor->segmentation;
+    const auto& decoder      = *segmentation.decoder();
+    const double xDimension  = segmentation.gridSizeX();
+    const double yDimension  = segmentation.gridSizeY();
+    const double xOffset     = segmentation.offsetX();
+    const double yOffset     = segmentation.offsetY();
 
     auto edep         = hit.getEDep();
     auto globalHitPos = hit.getPosition();
     auto hitPos =
         global2Local(dd4hep::Position(globalHitPos.x * dd4hep::mm, globalHitPos.y * dd4hep::mm,
                                       globalHitPos.z * dd4hep::mm),
-                     transformIt->second);
+                     sensor->transform);
 
+    // The cellID of the hit does not always contain its position,
     // therefore, we search neighbors within the segmentation of the same volume
     // to find the cell ID that correspond to globalHitPos.
     // Precise reason unknown, but we suspect it's cause by steps in Geant4
     // Perhaps position is the average of all steps in volume while cellID is just the first cell the track hits
     // They disagree when there are multiple step and scattering inside the volume
-    const dd4hep::Position dummy;
-    cellID = segmentationIt->second->cellID(hitPos, dummy, cellID);
+    const int xHitBin = positionToBin(hitPos.x(), xDimension, xOffset);
+    const int yHitBin = positionToBin(hitPos.y(), yDimension, yOffset);
+
+    // Charge is shared with the cells inside the sensor boundaries...
+    const auto in_range = [&](int bin, double size, double offset, double range) {
+      return std::abs(binToPosition(bin, size, offset)) <= range;
+    };
+    if (!in_range(xHitBin, xDimension, xOffset, sensor->xy_range.first) ||
+        !in_range(yHitBin, yDimension, yOffset, sensor->xy_range.second)) {
+      continue;
+    }
 
-    std::unordered_set<dd4hep::rec::CellID> tested_cells;
-    std::unordered_map<dd4hep::rec::CellID, float> cell_charge;
+    // ...that are close enough to the hit to possibly receive more than min_edep
+    auto sigma_sharingx = m_cfg.sigma_sharingx;
+    auto sigma_sharingy = m_cfg.sigma_sharingy;
+    if (m_cfg.sigma_mode == SiliconChargeSharingConfig::ESigmaMode::rel) {
+      sigma_sharingx *= xDimension;
+      sigma_sharingy *= yDimension;
+    }
+    const double xHalfWidth = sharingHalfWidth(sigma_sharingx, edep);
+    const double yHalfWidth = sharingHalfWidth(sigma_sharingy, edep);
+    int xBinMin = positionToBin(hitPos.x() - xHalfWidth, xDimension, xOffset);
+    int xBinMax = positionToBin(hitPos.x() + xHalfWidth, xDimension, xOffset);
+    int yBinMin = positionToBin(hitPos.y() - yHalfWidth, yDimension, yOffset);
+    int yBinMax = positionToBin(hitPos.y() + yHalfWidth, yDimension, yOffset);
+    while (!in_range(xBinMin, xDimension, xOffset, sensor->xy_range.first)) {
+      ++xBinMin;
+    }
+    while (!in_range(xBinMax, xDimension, xOffset, sensor->xy_range.first)) {
+      --xBinMax;
+    }
+    while (!in_range(yBinMin, yDimension, yOffset, sensor->xy_range.second)) {
+      ++yBinMin;
+    }
+    while (!in_range(yBinMax, yDimension, yOffset, sensor->xy_range.second)) {
+      --yBinMax;
+    }
 
-    // Warning: This function is recursive, it stops shen it finds the edge of a detector element
-    // or when the energy deposited in a cell is below the configured threshold
-    findAllNeighborsInSensor(cellID, tested_cells, edep, hitPos, segmentationIt->second,
-                             m_xy_range_map[element], hit, sharedHits);
+    cellFractions(hitPos.x(), sigma_sharingx, xDimension, xOffset, xBinMin, xBinMax, x_fractions);
+    cellFractions(hitPos.y(), sigma_sharingy, yDimension, yOffset, yBinMin, yBinMax, y_fractions);
+
+    // Create a new simhit for each cell with deposited energy above threshold
+    for (int yBin = yBinMin; yBin <= yBinMax; ++yBin) {
+      for (int xBin = xBinMin; xBin <= xBinMax; ++xBin) {
+        const float edepCell = edep * x_fractions[xBin - xBinMin] * y_fractions[yBin - yBinMin];
+        if (edepCell <= m_cfg.min_edep) {
+          continue;
+        }
+
+        auto sharedCellID = cellID;
+        decoder[sensor->xFieldIndex].set(sharedCellID, xBin);
+        decoder[sensor->yFieldIndex].set(sharedCellID, yBin);
+        const double localCellPos[3] = {binToPosition(xBin, xDimension, xOffset),
+                                        binToPosition(yBin, yDimension, yOffset), 0.};
+        double globalCellPos[3];
+        sensor->cellToGlobal.LocalToMaster(static_cast<const Double_t*>(localCellPos),
+                                           static_cast<Double_t*>(globalCellPos));
+
+        edm4hep::MutableSimTrackerHit shared_hit = hit.clone();
+        shared_hit.setCellID(sharedCellID);
+        shared_hit.setEDep(edepCell);
+        shared_hit.setPosition({globalCellPos[0] / dd4hep::mm, globalCellPos[1] / dd4hep::mm,
+                                globalCellPos[2] / dd4hep::mm});
+        shared_hit.setParticle(hit.getParticle());
+        sharedHits->push_back(shared_hit);
+      }
+    }
 
   } // for simhits
 } // SiliconChargeSharing:process
 
-// Recursively find neighbors where a charge is deposited
-void SiliconChargeSharing::findAllNeighborsInSensor(
-    const dd4hep::rec::CellID testCellID, std::unordered_set<dd4hep::rec::CellID>& tested_cells,
-    const float edep, const dd4hep::Position hitPos,
-    const dd4hep::DDSegmentation::CartesianGridXY* segmentation,
-    const std::pair<double, double>& xy_range, const edm4hep::SimTrackerHit& hit,
-    edm4hep::SimTrackerHitCollection* sharedHits) const {
-
-  // Tag cell as tested
-  tested_cells.insert(testCellID);
-
-  auto localPos = cell2LocalPosition(testCellID);
-
-  // Check if the cell is within the sensor boundaries
-  if (std::abs(localPos.x()) > xy_range.first || std::abs(localPos.y()) > xy_range.second) {
+// Charge fractions of a range of cells along one axis; neighbouring cells share the
+// cumulative integral at their common edge
+void SiliconChargeSharing::cellFractions(double mean, double sigma, double gridSize,
+                                         double offset, int binMin, int binMax,
+                                         std::vector<float>& fractions) const {
+  fractions.clear();
+  if (binMax < binMin) {
     return;
   }
-
-  // cout the local position and hit position
-  auto xDimension = segmentation->gridSizeX();
-  auto yDimension = segmentation->gridSizeY();
-  // Calculate deposited energy in cell
-  float edepCell = energyAtCell(xDimension, yDimension, localPos, hitPos, edep);
-  if (edepCell <= m_cfg.min_edep) {
-    return;
+  fractions.reserve(binMax - binMin + 1);
+  float low = cumulativeGaus(mean, sigma, binToPosition(binMin, gridSize, offset) - 0.5 * gridSize);
+  for (int bin = binMin; bin <= binMax; ++bin) {
+    const float up =
+        cumulativeGaus(mean, sigma, binToPosition(bin, gridSize, offset) + 0.5 * gridSize);
+    fractions.push_back(up - low);
+    low = up;
   }
+}
 
-  // Create a new simhit for cell with deposited energy
-  auto globalCellPos = m_converter->position(testCellID);
-
-  edm4hep::MutableSimTrackerHit shared_hit = hit.clone();
-  shared_hit.setCellID(testCellID);
-  shared_hit.setEDep(edepCell);
-  shared_hit.setPosition({globalCellPos.x() / dd4hep::mm, globalCellPos.y() / dd4hep::mm,
-                          globalCellPos.z() / dd4hep::mm});
-  shared_hit.setParticle(hit.getParticle());
-  sharedHits->push_back(shared_hit);
-
-  // As there is charge in the cell, test the neighbors too
-  std::set<dd4hep::rec::CellID> testCellNeighbours;
-  segmentation->neighbours(testCellID, testCellNeighbours);
-
-  for (const auto& neighbourCell : testCellNeighbours) {
-    if (tested_cells.find(neighbourCell) == tested_cells.end()) {
-      findAllNeighborsInSensor(neighbourCell, tested_cells, edep, hitPos, segmentation, xy_range,
-                               hit, sharedHits);
-    }
+// The charge profile has a standard deviation of sigma / 2, so a cell whose nearest edge
+// is a distance d from the hit receives at most edep / 2 * exp(-2 d^2 / sigma^2)
+double SiliconChargeSharing::sharingHalfWidth(double sigma, float edep) const {
+  // beyond erf_table_max the tabulated cumulative integral is constant
+  double scaled_width = erf_table_max;
+  if (m_cfg.min_edep > 0) {
+    const double ratio = edep / (2. * m_cfg.min_edep);
+    scaled_width =
+        ratio > 1. ? std::min<double>(std::sqrt(std::log(ratio)), erf_table_max) : 0.;
   }
+  return scaled_width * sigma / std::numbers::sqrt2;
 }
 
 // Calculate integral of Gaussian distribution
-float SiliconChargeSharing::integralGaus(float mean, float sd, float low_lim, float up_lim) {
-  // return integral Gauss(mean, sd) dx from x = low_lim to x = up_lim
+float SiliconChargeSharing::cumulativeGaus(float mean, float sd, float lim) const {
+  // return integral Gauss(mean, sd) dx from x = mean to x = lim
   // default value is set when sd = 0
-  float up  = mean > up_lim ? -0.5 : 0.5;
-  float low = mean > low_lim ? -0.5 : 0.5;
   if (sd > 0) {
-    up  = -0.5 * std::erf(std::numbers::sqrt2 * (mean - up_lim) / sd);
-    low = -0.5 * std::erf(std::numbers::sqrt2 * (mean - low_lim) / sd);
+    return -0.5 * tabulatedErf(std::numbers::sqrt2 * (mean - lim) / sd);
   }
-  return up - low;
+  return mean > lim ? -0.5 : 0.5;
 }
 
-// Convert cellID to local position
-dd4hep::Position SiliconChargeSharing::cell2LocalPosition(const dd4hep::rec::CellID& cell) const {
-  auto position = m_seg->position(cell); // local position
-  return position;
+// Interpolate erf in the table filled in init()
+float SiliconChargeSharing::tabulatedErf(float x) const {
+  const float scaled = std::abs(x) * erf_table_scale;
+  if (!(scaled < erf_table_max * erf_table_scale)) {
+    return std::copysign(1.F, x);
+  }
+  const auto i       = static_cast<std::size_t>(scaled);
+  const float weight = scaled - i;
+  const float value  = m_erf_table[i] + weight * (m_erf_table[i + 1] - m_erf_table[i]);
+  return std::copysign(value, x);
 }
 
 // Convert global position to local position
@@ -176,24 +318,6 @@ dd4hep::Position SiliconChargeSharing::global2Local(const dd4hep::Position& glob
   return localPosition;
 }
 
-// Calculate energy deposition in a cell relative to the hit position
-float SiliconChargeSharing::energyAtCell(const double xDimension, const double yDimension,
-                                         const dd4hep::Position localPos,
-                                         const dd4hep::Position hitPos, const float edep) const {
-  auto sigma_sharingx = m_cfg.sigma_sharingx;
-  auto sigma_sharingy = m_cfg.sigma_sharingy;
-  if (m_cfg.sigma_mode == SiliconChargeSharingConfig::ESigmaMode::rel) {
-    sigma_sharingx *= xDimension;
-    sigma_sharingy *= yDimension;
-  }
-  float energy = edep *
-                 integralGaus(hitPos.x(), sigma_sharingx, localPos.x() - 0.5 * xDimension,
-                              localPos.x() + 0.5 * xDimension) *
-                 integralGaus(hitPos.y(), sigma_sharingy, localPos.y() - 0.5 * yDimension,
-                              localPos.y() + 0.5 * yDimension);
-  return energy;
-}
-
 // Get the segmentation relevant to a cellID
 const dd4hep::DDSegmentation::CartesianGridXY*
 SiliconChargeSharing::getLocalSegmentation(const dd4hep::rec::CellID& cellID) const {
@@ -8,16 +8,19 @@
 #include <DD4hep/DetElement.h>
 #include <DD4hep/Objects.h>
 #include <DD4hep/Segmentations.h>
+#include <DD4hep/VolumeManager.h>
 #include <DDRec/CellIDPositionConverter.h>
 #include <DDSegmentation/CartesianGridXY.h>
 #include <TGeoMatrix.h>
 #include <algorithms/algorithm.h>
 #include <edm4hep/SimTrackerHitCollection.h>
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "algorithms/digi/SiliconChargeSharingConfig.h"
 #include "algorithms/interfaces/WithPodConfig.h"
@@ -39,30 +42,41 @@ public:
   void process(const Input&, const Output&) const final;
 
 private:
-  void findAllNeighborsInSensor(const dd4hep::rec::CellID testCellID,
-                                std::unordered_set<dd4hep::rec::CellID>& tested_cells,
-                                const float edep, const dd4hep::Position hitPos,
-                                const dd4hep::DDSegmentation::CartesianGridXY* segmentation,
-                                const std::pair<double, double>& xy_range,
-                                const edm4hep::SimTrackerHit& hit,
-                                edm4hep::SimTrackerHitCollection* sharedHits) const;
-  float energyAtCell(const double xDimension, const double yDimension,
-                     const dd4hep::Position localPos, const dd4hep::Position hitPos,
-                     const float edep) const;
-  static float integralGaus(float mean, float sd, float low_lim, float up_lim);
-  dd4hep::Position cell2LocalPosition(const dd4hep::rec::CellID& cell) const;
+  // Geometry of one sensor, cached at init
+  struct SensorInfo {
+    // sensor world transformation, for local hit positions
+    const TGeoHMatrix* transform = nullptr;
+    // cell local position to global position, as CellIDPositionConverter::position
+    TGeoHMatrix cellToGlobal;
+    const dd4hep::DDSegmentation::CartesianGridXY* segmentation = nullptr;
+    std::size_t xFieldIndex = 0;
+    std::size_t yFieldIndex = 0;
+    std::pair<double, double> xy_range{0., 0.};
+  };
+
+  void cacheSensors(const dd4hep::VolumeManager& manager,
+                    const std::unordered_set<const dd4hep::DetElement::Object*>& subdetectors);
+  SensorInfo makeSensorInfo(const dd4hep::VolumeManagerContext& context,
+                            const dd4hep::rec::CellID& cellID) const;
+  // charge fractions of the cells [binMin, binMax] along one axis
+  void cellFractions(double mean, double sigma, double gridSize, double offset, int binMin,
+                     int binMax, std::vector<float>& fractions) const;
+  // half width around the hit outside of which no cell can receive more than min_edep
+  double sharingHalfWidth(double sigma, float edep) const;
+  float cumulativeGaus(float mean, float sd, float lim) const;
+  float tabulatedErf(float x) const;
   static dd4hep::Position global2Local(const dd4hep::Position& globalPosition,
                                        const TGeoHMatrix* transform);
   const dd4hep::DDSegmentation::CartesianGridXY*
   getLocalSegmentation(const dd4hep::rec::CellID& cellID) const;
 
-  mutable std::unordered_map<const dd4hep::DetElement*, const TGeoHMatrix*> m_transform_map;
-  mutable std::unordered_map<const dd4hep::DetElement*,
-                             const dd4hep::DDSegmentation::CartesianGridXY*>
-      m_segmentation_map;
-  mutable std::unordered_map<const dd4hep::DetElement*, const std::pair<double, double>>
-      m_xy_range_map;
-  const dd4hep::rec::CellIDPositionConverter* m_converter = nullptr;
+  // all sensors of the readout by volume ID, i.e. the cellID without the segmentation fields
+  std::unordered_map<dd4hep::rec::CellID, SensorInfo> m_sensors;
+  dd4hep::rec::CellID m_volume_mask = ~dd4hep::rec::CellID{0};
+  // erf on [0, erf_table_max] in steps of 1 / erf_table_scale
+  static constexpr float erf_table_max   = 6.F;
+  static constexpr float erf_table_scale = 1024.F;
+  std::vector<float> m_erf_table;
   dd4hep::Segmentation m_seg;
 };
 
@@ -6,14 +6,19 @@
 
 #include <DDRec/CellIDPositionConverter.h>
 #include <podio/RelationRange.h>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <gsl/pointers>
 #include <iterator>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "SiliconPulseDiscretization.h"
+#include "algorithms/digi/WaveformKernels.h"
 // use TGraph for interpolation
 #include "TGraph.h"
 
@@ -93,10 +98,28 @@ void SiliconPulseDiscretization::process(const SiliconPulseDiscretization::Input
       outPulse.setTime(startTime);
 
       // stop at the next cycle
+      thread_local std::vector<double> sampleTimes;
+      sampleTimes.clear();
       // NOLINTNEXTLINE(clang-analyzer-security.FloatLoopCounter, security.FloatLoopCounter)
       for (double currTime = startTime; currTime < startTime + m_cfg.EICROC_period;
            currTime += m_cfg.local_period) {
-        outPulse.addToAdcCounts(this->_interpolateOrZero(graph, currTime, tMin, tMax));
+        sampleTimes.push_back(currTime);
+      }
+
+      // only sample times within the pulse need interpolation, the others are zero
+      const std::span<const double> times{sampleTimes};
+      const std::size_t first =
+          std::min(waveform::find_first_not_below(times, tMin), times.size());
+      const std::size_t last =
+          std::min(waveform::find_first_above(times, tMax, first), times.size());
+      for (std::size_t i = 0; i < first; ++i) {
+        outPulse.addToAdcCounts(0);
+      }
+      for (std::size_t i = first; i < last; ++i) {
+        outPulse.addToAdcCounts(this->_interpolateOrZero(graph, times[i], tMin, tMax));
+      }
+      for (std::size_t i = last; i < times.size(); ++i) {
+        outPulse.addToAdcCounts(0);
       }
     }
   }
@@ -9,15 +9,17 @@
 #include <podio/detail/LinkCollectionImpl.h>
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <random>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "SiliconTrackerDigi.h"
 #include "algorithms/digi/SiliconTrackerDigiConfig.h"
+#include "algorithms/interfaces/CounterRNG.h"
 
 namespace eicrecon {
 
@@ -28,19 +30,25 @@ void SiliconTrackerDigi::process(const SiliconTrackerDigi::Input& input,
 
   const auto [headers, sim_hits]       = input;
   auto [raw_hits, links, associations] = output;
+  const bool data_only                 = m_data_mode.dataOnly();
 
-  // local random generator
-  auto seed = m_uid.getUniqueID(*headers, name());
-  std::default_random_engine generator(seed);
-  std::normal_distribution<double> gaussian;
+  // random streams per sim hit, independent of the order in which hits are processed
+  const auto stream_key = m_uid.getStreamKey(*headers, name());
 
   // A map of unique cellIDs with temporary structure RawHit
   std::unordered_map<std::uint64_t, edm4eic::MutableRawTrackerHit> cell_hit_map;
+  // Positions of all sim hits per cellID, used to build links without rescanning the input
+  std::unordered_map<std::uint64_t, std::vector<std::size_t>> cell_sim_hits;
 
-  for (const auto& sim_hit : *sim_hits) {
+  for (std::size_t sim_hit_index = 0; const auto& sim_hit : *sim_hits) {
+    if (!data_only) {
+      cell_sim_hits[sim_hit.getCellID()].push_back(sim_hit_index);
+    }
+    sim_hit_index++;
 
     // time smearing
-    double time_smearing = gaussian(generator) * m_cfg.timeResolution;
+    CounterRNG generator(stream_key, sim_hit.getObjectID().index);
+    double time_smearing = generator.gaussian() * m_cfg.timeResolution;
     double result_time   = sim_hit.getTime() + time_smearing;
     auto hit_time_stamp  = (std::int32_t)(result_time * 1e3);
 
@@ -85,21 +93,23 @@ void SiliconTrackerDigi::process(const SiliconTrackerDigi::Input& input,
 
   for (auto item : cell_hit_map) {
     raw_hits->push_back(item.second);
+    if (data_only) {
+      continue;
+    }
     auto raw_hit = raw_hits->at(raw_hits->size() - 1);
 
-    for (const auto& sim_hit : *sim_hits) {
-      if (item.first == sim_hit.getCellID()) {
-        // create link
-        auto link = links->create();
-        link.setFrom(item.second);
-        link.setTo(sim_hit);
-        link.setWeight(1.0);
-        // set association
-        auto hitassoc = associations->create();
-        hitassoc.setWeight(1.0);
-        hitassoc.setRawHit(raw_hit);
-        hitassoc.setSimHit(sim_hit);
-      }
+    for (std::size_t sim_hit_index : cell_sim_hits[item.first]) {
+      const auto sim_hit = (*sim_hits)[sim_hit_index];
+      // create link
+      auto link = links->create();
+      link.setFrom(item.second);
+      link.setTo(sim_hit);
+      link.setWeight(1.0);
+      // set association
+      auto hitassoc = associations->create();
+      hitassoc.setWeight(1.0);
+      hitassoc.setRawHit(raw_hit);
+      hitassoc.setSimHit(sim_hit);
     }
   }
 }
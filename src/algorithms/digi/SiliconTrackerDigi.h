@@ -13,6 +13,7 @@
 #include <string_view>
 
 #include "SiliconTrackerDigiConfig.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/UniqueIDGenSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
@@ -39,7 +40,8 @@ public:
   void process(const Input&, const Output&) const final;
 
 private:
-  const algorithms::UniqueIDGenSvc& m_uid = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::UniqueIDGenSvc& m_uid    = algorithms::UniqueIDGenSvc::instance();
+  const algorithms::DataModeSvc& m_data_mode = algorithms::DataModeSvc::instance();
 };
 
 } // namespace eicrecon
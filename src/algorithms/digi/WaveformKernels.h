@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+//
+// Waveform kernels shared by the ROC digitizers
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <span>
+#include <vector>
+
+namespace eicrecon::waveform {
+
+/*! Kernels scanning contiguous waveform samples for the ROC digitizers
+ *  (CALOROC, EICROC, CFDROC) and the pulse discretization.
+ *
+ *  Searches first evaluate their predicate over whole blocks of
+ *  `block_size` samples without early exit, which the compiler turns
+ *  into vector compares and a mask reduction, and only then locate the
+ *  sample inside the first matching block. Every kernel returns the
+ *  same sample, with the same floating point operations, as the
+ *  straightforward scalar loop it replaces.
+ */
+inline constexpr std::size_t block_size = 16;
+
+/// Returned by the searches if no sample matches
+inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+namespace detail {
+
+  /// First index in [begin, end) satisfying `pred(i)`, or `npos`
+  template <typename Pred>
+  std::size_t find_first(std::size_t begin, std::size_t end, Pred&& pred) {
+    std::size_t i = begin;
+    for (; i + block_size <= end; i += block_size) {
+      bool any = false;
+      for (std::size_t j = 0; j < block_size; ++j) {
+        any |= pred(i + j);
+      }
+      if (any) {
+        break;
+      }
+    }
+    for (; i < end; ++i) {
+      if (pred(i)) {
+        return i;
+      }
+    }
+    return npos;
+  }
+
+  /// Last index in [begin, end) satisfying `pred(i)`, or `npos`
+  template <typename Pred>
+  std::size_t find_last(std::size_t begin, std::size_t end, Pred&& pred) {
+    std::size_t i = end;
+    for (; i >= begin + block_size; i -= block_size) {
+      bool any = false;
+      for (std::size_t j = 1; j <= block_size; ++j) {
+        any |= pred(i - j);
+      }
+      if (any) {
+        break;
+      }
+    }
+    for (; i > begin; --i) {
+      if (pred(i - 1)) {
+        return i - 1;
+      }
+    }
+    return npos;
+  }
+
+} // namespace detail
+
+/// First sample in [from, size) above `thres`, or `npos`
+template <typename T>
+std::size_t find_first_above(std::span<const T> samples, double thres, std::size_t from = 0) {
+  return detail::find_first(from, samples.size(),
+                            [&](std::size_t i) { return samples[i] > thres; });
+}
+
+/// First sample in [from, size) at or above `thres`, or `npos`
+template <typename T>
+std::size_t find_first_not_below(std::span<const T> samples, double thres, std::size_t from = 0) {
+  return detail::find_first(from, samples.size(),
+                            [&](std::size_t i) { return samples[i] >= thres; });
+}
+
+/// First sample in [from, size) below `thres`, or `npos`
+template <typename T>
+std::size_t find_first_below(std::span<const T> samples, double thres, std::size_t from = 0) {
+  return detail::find_first(from, samples.size(),
+                            [&](std::size_t i) { return samples[i] < thres; });
+}
+
+/// Last falling crossing of `thres`, i.e. the last sample at or below `thres` whose
+/// predecessor is at or above it. The sample before the first one is taken to be `before`.
+template <typename T>
+std::size_t find_last_falling_crossing(std::span<const T> samples, double thres, double before) {
+  const std::size_t last = detail::find_last(1, samples.size(), [&](std::size_t i) {
+    return samples[i - 1] >= thres && samples[i] <= thres;
+  });
+  if (last != npos) {
+    return last;
+  }
+  if (!samples.empty() && before >= thres && samples[0] <= thres) {
+    return 0;
+  }
+  return npos;
+}
+
+/// Constant fraction crossing: the last sample before `end` whose magnitude is at or
+/// below |`target`| while the magnitude of the following sample is at or above it
+template <typename T>
+std::size_t find_cfd_crossing(std::span<const T> samples, std::size_t end, T target) {
+  if (samples.empty()) {
+    return npos;
+  }
+  const auto abs_target = std::abs(target);
+  return detail::find_last(0, std::min(end, samples.size() - 1), [&](std::size_t i) {
+    return std::abs(samples[i]) <= abs_target && abs_target <= std::abs(samples[i + 1]);
+  });
+}
+
+/// Sample of largest magnitude (the first one on ties), or zero for an empty or all-zero
+/// waveform
+template <typename T> T abs_peak(std::span<const T> samples) {
+  T max_abs = 0;
+  for (const T sample : samples) {
+    max_abs = std::max<T>(max_abs, std::abs(sample));
+  }
+  if (max_abs == 0) {
+    return 0;
+  }
+  const std::size_t peak = detail::find_first(
+      0, samples.size(), [&](std::size_t i) { return std::abs(samples[i]) == max_abs; });
+  return samples[peak];
+}
+
+/// Local maxima in magnitude: samples larger than their predecessor and at least as large
+/// as their successor, excluding the first and last sample
+template <typename T>
+void find_local_peaks(std::span<const T> samples, std::vector<std::size_t>& peaks) {
+  peaks.clear();
+  if (samples.size() < 3) {
+    return;
+  }
+  const auto is_peak = [&](std::size_t i) {
+    return std::abs(samples[i - 1]) < std::abs(samples[i]) &&
+           std::abs(samples[i]) >= std::abs(samples[i + 1]);
+  };
+  for (std::size_t peak = detail::find_first(1, samples.size() - 1, is_peak); peak != npos;
+       peak = detail::find_first(peak + 1, samples.size() - 1, is_peak)) {
+    peaks.push_back(peak);
+  }
+}
+
+/// Time at which the line through (`t` - `dt`, `amp_prev`) and (`t`, `amp`) crosses `thres`
+inline double crossing_time(double thres, double dt, double t, double amp, double amp_prev) {
+  double numerator   = (amp - thres) * dt;
+  double denominator = amp_prev - amp;
+  double added       = t;
+  return (numerator / denominator) + added;
+}
+
+/// Gather `out.size()` samples starting at `first` every `stride` (> 0) samples, stopping
+/// at the end of the waveform; the remaining outputs are left untouched
+template <typename T, typename U>
+void strided_gather(std::span<const T> samples, std::size_t first, std::size_t stride,
+                    std::span<U> out) {
+  const std::size_t n =
+      first < samples.size() ? std::min(out.size(), (samples.size() - first - 1) / stride + 1) : 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    out[i] = samples[first + i * stride];
+  }
+}
+
+/// Quantize `value` with `cap` counts over `range`, clamped to [0, cap - 1]
+inline long long clamp_quantize(double value, double range, unsigned int cap) {
+  return std::clamp(std::llround(value / range * cap), 0LL, static_cast<long long>(cap) - 1);
+}
+
+} // namespace eicrecon::waveform
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <span>
+
+namespace eicrecon {
+
+/// SplitMix64 finalizer: a cheap, well-mixing bijection of 64-bit integers
+constexpr std::uint64_t mix64(std::uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+/// Combine `value` into the running hash `h`
+constexpr std::uint64_t mix64(std::uint64_t h, std::uint64_t value) {
+  return mix64(h ^ mix64(value + 0x9e3779b97f4a7c15ULL));
+}
+
+/// Philox4x32-10 block function (Salmon et al., SC'11): 4x32 bits of output per counter
+constexpr std::array<std::uint32_t, 4> philox4x32(std::array<std::uint32_t, 4> ctr,
+                                                  std::array<std::uint32_t, 2> key) {
+  constexpr std::uint64_t M0 = 0xD2511F53;
+  constexpr std::uint64_t M1 = 0xCD9E8D57;
+  constexpr std::uint32_t W0 = 0x9E3779B9;
+  constexpr std::uint32_t W1 = 0xBB67AE85;
+  for (int round = 0; round < 10; ++round) {
+    if (round > 0) {
+      key[0] += W0;
+      key[1] += W1;
+    }
+    const std::uint64_t p0 = M0 * ctr[0];
+    const std::uint64_t p1 = M1 * ctr[2];
+    ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(p1),
+           static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(p0)};
+  }
+  return ctr;
+}
+
+/**
+ * Counter-based random stream: the n-th number of the stream is the Philox block
+ * function of (stream, n) under a 64-bit key, so it does not depend on how many numbers
+ * other streams have drawn. With the key derived from the seed, run, event and algorithm
+ * (see `UniqueIDGenSvc::getStreamKey`) and one stream per hit or cell (e.g. its cellID),
+ * results are independent of the order in which hits are processed and of threading.
+ *
+ * Models UniformRandomBitGenerator, so standard distributions can draw from it, and
+ * provides bulk uniform, Gaussian and Poisson draws.
+ */
+class CounterRNG {
+public:
+  using result_type = std::uint64_t;
+
+  CounterRNG(std::uint64_t key, std::uint64_t stream)
+      : m_key{static_cast<std::uint32_t>(key), static_cast<std::uint32_t>(key >> 32)}
+      , m_stream(stream) {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()() {
+    if (m_next == m_block.size()) {
+      refill();
+    }
+    return m_block[m_next++];
+  }
+
+  /// Skip `n` numbers
+  void discard(std::uint64_t n) {
+    for (; n > 0 && m_next < m_block.size(); --n) {
+      ++m_next;
+    }
+    m_counter += n / m_block.size();
+    for (n %= m_block.size(); n > 0; --n) {
+      (*this)();
+    }
+  }
+
+  /// Uniform in [0, 1)
+  double uniform() { return static_cast<double>((*this)() >> 11) * 0x1.0p-53; }
+
+  /// Standard normal (Box-Muller, one pair of uniforms per number)
+  double gaussian() {
+    const double radius = std::sqrt(-2. * std::log(1. - uniform()));
+    return radius * std::cos(2. * std::numbers::pi * uniform());
+  }
+
+  void fill_uniform(std::span<double> out) {
+    for (auto& value : out) {
+      value = uniform();
+    }
+  }
+
+  /// Normal with `mean` and `sigma`, using both outputs of each Box-Muller pair
+  void fill_gaussian(std::span<double> out, double mean = 0., double sigma = 1.) {
+    std::size_t i = 0;
+    for (; i + 1 < out.size(); i += 2) {
+      const double radius = std::sqrt(-2. * std::log(1. - uniform()));
+      const double phi    = 2. * std::numbers::pi * uniform();
+      out[i]              = mean + sigma * radius * std::cos(phi);
+      out[i + 1]          = mean + sigma * radius * std::sin(phi);
+    }
+    if (i < out.size()) {
+      out[i] = mean + sigma * gaussian();
+    }
+  }
+
+  void fill_poisson(std::span<long long> out, double mean) {
+    std::poisson_distribution<long long> poisson(mean);
+    for (auto& value : out) {
+      value = poisson(*this);
+    }
+  }
+
+private:
+  void refill() {
+    const auto block = philox4x32({static_cast<std::uint32_t>(m_counter),
+                                   static_cast<std::uint32_t>(m_counter >> 32),
+                                   static_cast<std::uint32_t>(m_stream),
+                                   static_cast<std::uint32_t>(m_stream >> 32)},
+                                  m_key);
+    m_block = {(static_cast<std::uint64_t>(block[1]) << 32) | block[0],
+               (static_cast<std::uint64_t>(block[3]) << 32) | block[2]};
+    m_next  = 0;
+    ++m_counter;
+  }
+
+  std::array<std::uint32_t, 2> m_key;
+  std::uint64_t m_stream;
+  std::uint64_t m_counter{0};
+  std::array<std::uint64_t, 2> m_block{};
+  std::size_t m_next{m_block.size()};
+};
+
+} // namespace eicrecon
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <algorithms/logger.h>
+#include <algorithms/service.h>
+
+namespace algorithms {
+
+/**
+ * Global switch for data-only reconstruction: when set, algorithms skip the MC truth
+ * bookkeeping, i.e. they neither fill link and association collections (which are still
+ * produced, empty, so the output schema does not change) nor run truth-matching passes.
+ * Meant for throughput tests, real-data-like workflows and trigger studies.
+ */
+class DataModeSvc : public LoggedService<DataModeSvc> {
+public:
+  virtual void init() {}
+
+  /// Whether MC truth links, associations and truth matching are skipped
+  bool dataOnly() const { return m_dataOnly.value(); }
+
+protected:
+  ALGORITHMS_DEFINE_LOGGED_SERVICE(DataModeSvc)
+
+private:
+  Property<bool> m_dataOnly{
+      this, "data_only", false,
+      "Skip MC truth links, associations and truth matching (empty association collections)"};
+};
+
+} // namespace algorithms
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <podio/ObjectID.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eicrecon {
+
+/*! One-to-many index from the podio::ObjectID of a related object
+ *  to the elements of a collection that refer to it, e.g. from a
+ *  RawTrackerHit to all MCRecoTrackerHitAssociations pointing at it.
+ *
+ *  The index is built in two linear passes over the collection and
+ *  stores element positions contiguously per key (in collection
+ *  order), so that a lookup costs one hash probe instead of a scan
+ *  over the whole collection. It holds a non-owning pointer to the
+ *  collection and is meant to live no longer than the event.
+ */
+template <typename CollectionT> class ObjectIDIndex {
+public:
+  using value_type = typename CollectionT::value_type;
+
+  ObjectIDIndex() = default;
+
+  /*! Build the index: `key_fn(element)` returns the related object
+   *  to index the element under. Elements whose related object is
+   *  not available (e.g. unset relations) are skipped.
+   */
+  template <typename KeyFn> ObjectIDIndex(const CollectionT& collection, KeyFn&& key_fn) {
+    build(collection, std::forward<KeyFn>(key_fn));
+  }
+
+  template <typename KeyFn> void build(const CollectionT& collection, KeyFn&& key_fn) {
+    m_collection = &collection;
+    m_slots.clear();
+    m_offsets.clear();
+    m_positions.clear();
+
+    // first pass: assign a slot per distinct key and count entries
+    std::vector<std::uint32_t> element_slot(collection.size(), s_no_slot);
+    std::vector<std::uint32_t> counts;
+    m_slots.reserve(collection.size());
+    for (std::size_t i = 0; i < collection.size(); ++i) {
+      const auto key = std::invoke(key_fn, collection[i]);
+      if (!key.isAvailable()) {
+        continue;
+      }
+      auto [it, inserted] =
+          m_slots.try_emplace(key.getObjectID(), static_cast<std::uint32_t>(counts.size()));
+      if (inserted) {
+        counts.push_back(0);
+      }
+      element_slot[i] = it->second;
+      ++counts[it->second];
+    }
+
+    // prefix sum into offsets, then scatter positions in collection order
+    m_offsets.resize(counts.size() + 1, 0);
+    for (std::size_t s = 0; s < counts.size(); ++s) {
+      m_offsets[s + 1] = m_offsets[s] + counts[s];
+    }
+    m_positions.resize(m_offsets.back());
+    std::vector<std::uint32_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+    for (std::size_t i = 0; i < element_slot.size(); ++i) {
+      if (element_slot[i] != s_no_slot) {
+        m_positions[fill[element_slot[i]]++] = static_cast<std::uint32_t>(i);
+      }
+    }
+  }
+
+  /// Positions in the indexed collection of the elements related to `id`
+  std::span<const std::uint32_t> positions(const podio::ObjectID& id) const {
+    const auto it = m_slots.find(id);
+    if (it == m_slots.end()) {
+      return {};
+    }
+    return std::span<const std::uint32_t>{m_positions}.subspan(
+        m_offsets[it->second], m_offsets[it->second + 1] - m_offsets[it->second]);
+  }
+
+  /// Elements of the indexed collection related to `key`
+  template <typename KeyT> auto find(const KeyT& key) const {
+    return positions(key.getObjectID()) |
+           std::views::transform([coll = m_collection](std::uint32_t i) { return (*coll)[i]; });
+  }
+
+  bool contains(const podio::ObjectID& id) const { return m_slots.contains(id); }
+  std::size_t keys() const { return m_slots.size(); }
+
+private:
+  static constexpr std::uint32_t s_no_slot = static_cast<std::uint32_t>(-1);
+
+  const CollectionT* m_collection{nullptr};
+  std::unordered_map<podio::ObjectID, std::uint32_t> m_slots;
+  std::vector<std::uint32_t> m_offsets;
+  std::vector<std::uint32_t> m_positions;
+};
+
+} // namespace eicrecon
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace eicrecon {
+
+/*! Groups element indices by key by sorting, as a replacement for
+ *  map-of-vectors constructs such as
+ *  `std::unordered_map<uint64_t, std::vector<std::size_t>>`.
+ *
+ *  Keys are added in element order, then `sort()` orders them by
+ *  (key, insertion index) and records the boundaries of runs of equal
+ *  keys. Groups are therefore visited in ascending key order and the
+ *  indices of each group keep their insertion order, which makes the
+ *  result independent of hashing and allocation details. Buffers are
+ *  kept across `clear()`, so an instance reused from event to event
+ *  (e.g. a `thread_local` one) stops allocating once warmed up.
+ */
+template <typename KeyT = std::uint64_t> class SortedGrouping {
+public:
+  struct Group {
+    const KeyT& key;
+    std::span<const std::uint32_t> indices;
+  };
+
+  void clear() {
+    m_entries.clear();
+    m_indices.clear();
+    m_run_starts.clear();
+  }
+
+  void reserve(std::size_t n) {
+    m_entries.reserve(n);
+    m_indices.reserve(n);
+  }
+
+  /// Add the next element (its index is the number of elements added so far)
+  void add(const KeyT& key) {
+    m_entries.emplace_back(key, static_cast<std::uint32_t>(m_entries.size()));
+  }
+
+  /// Add an element with an explicit index
+  void add(const KeyT& key, std::uint32_t index) { m_entries.emplace_back(key, index); }
+
+  /// Sort the added elements into groups of equal keys
+  void sort() {
+    std::ranges::sort(m_entries);
+    m_indices.resize(m_entries.size());
+    m_run_starts.clear();
+    for (std::size_t i = 0; i < m_entries.size(); ++i) {
+      m_indices[i] = m_entries[i].second;
+      if (i == 0 || m_entries[i - 1].first < m_entries[i].first) {
+        m_run_starts.push_back(static_cast<std::uint32_t>(i));
+      }
+    }
+    m_run_starts.push_back(static_cast<std::uint32_t>(m_entries.size()));
+  }
+
+  /// Number of groups (valid after `sort()`)
+  std::size_t size() const { return m_run_starts.empty() ? 0 : m_run_starts.size() - 1; }
+  bool empty() const { return size() == 0; }
+
+  Group operator[](std::size_t group) const {
+    const std::uint32_t begin = m_run_starts[group];
+    const std::uint32_t end   = m_run_starts[group + 1];
+    return {m_entries[begin].first,
+            std::span<const std::uint32_t>{m_indices}.subspan(begin, end - begin)};
+  }
+
+  /// Range over all groups in ascending key order
+  auto groups() const {
+    return std::views::iota(std::size_t{0}, size()) |
+           std::views::transform([this](std::size_t group) { return (*this)[group]; });
+  }
+
+private:
+  std::vector<std::pair<KeyT, std::uint32_t>> m_entries;
+  std::vector<std::uint32_t> m_indices;
+  std::vector<std::uint32_t> m_run_starts;
+};
+
+} // namespace eicrecon
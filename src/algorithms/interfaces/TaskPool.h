@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eicrecon {
+
+/*! Fixed set of worker threads for parallel loops within one algorithm call.
+ *
+ *  The workers are started once and live as long as the pool, so a parallel
+ *  loop costs no thread creation. The thread calling `parallel_for()` runs
+ *  iterations of its own loop too, and only waits for iterations already
+ *  started elsewhere: a loop completes even when all workers are busy with
+ *  the loops of other event threads, and a pool without workers runs loops
+ *  serially. Algorithms obtain pools from `shared()`, so that all their
+ *  instances, one per event thread, share the same workers.
+ */
+class TaskPool {
+public:
+  explicit TaskPool(std::size_t num_workers) {
+    m_workers.reserve(num_workers);
+    for (std::size_t worker = 0; worker < num_workers; ++worker) {
+      m_workers.emplace_back([this] { work(); });
+    }
+  }
+
+  ~TaskPool() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  TaskPool(const TaskPool&)            = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+
+  std::size_t num_workers() const { return m_workers.size(); }
+
+  /// Call `task(i)` for all i in [0, n) and return when all calls are done. The first
+  /// exception thrown by a call is rethrown.
+  void parallel_for(std::size_t n, const std::function<void(std::size_t)>& task) {
+    auto loop = std::make_shared<Loop>(n, task);
+    if (n > 1 && !m_workers.empty()) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_loops.push_back(loop);
+      }
+      m_wake.notify_all();
+    }
+    loop->run();
+    loop->wait();
+    if (loop->error) {
+      std::rethrow_exception(loop->error);
+    }
+  }
+
+  /// Pool with `num_workers` workers, shared by all callers asking for that many
+  static std::shared_ptr<TaskPool> shared(std::size_t num_workers) {
+    static std::mutex mutex;
+    static std::map<std::size_t, std::weak_ptr<TaskPool>> pools;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& weak_pool = pools[num_workers];
+    auto pool       = weak_pool.lock();
+    if (!pool) {
+      pool      = std::make_shared<TaskPool>(num_workers);
+      weak_pool = pool;
+    }
+    return pool;
+  }
+
+private:
+  struct Loop {
+    Loop(std::size_t n, const std::function<void(std::size_t)>& t) : size(n), task(t) {}
+
+    // Run the iterations that are not claimed yet
+    void run() {
+      for (std::size_t i = next++; i < size; i = next++) {
+        std::exception_ptr task_error;
+        try {
+          task(i);
+        } catch (...) {
+          task_error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (task_error && !error) {
+          error = task_error;
+        }
+        if (++done == size) {
+          finished.notify_all();
+        }
+      }
+    }
+
+    bool claimed() const { return next >= size; }
+
+    void wait() {
+      std::unique_lock<std::mutex> lock(mutex);
+      finished.wait(lock, [this] { return done == size; });
+    }
+
+    const std::size_t size;
+    // only called while the caller of parallel_for() waits
+    const std::function<void(std::size_t)>& task;
+    std::atomic<std::size_t> next{0};
+    std::size_t done = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+
+  void work() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_wake.wait(lock, [this] { return m_stop || !m_loops.empty(); });
+      if (m_stop) {
+        return;
+      }
+      auto loop = m_loops.front();
+      if (loop->claimed()) {
+        m_loops.pop_front();
+        continue;
+      }
+      lock.unlock();
+      loop->run();
+      lock.lock();
+    }
+  }
+
+  std::vector<std::thread> m_workers;
+  std::deque<std::shared_ptr<Loop>> m_loops;
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  bool m_stop = false;
+};
+
+} // namespace eicrecon
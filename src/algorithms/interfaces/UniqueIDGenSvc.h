@@ -18,6 +18,8 @@
 #include <string>
 #include <unordered_map>
 
+#include "algorithms/interfaces/CounterRNG.h"
+
 namespace algorithms {
 
 class UniqueIDGenSvc : public LoggedService<UniqueIDGenSvc> {
@@ -90,6 +92,23 @@ public:
     return hash;
   };
 
+  // calculate a key for counter-based random streams (eicrecon::CounterRNG) from name and the
+  // event header, with an integer mixer instead of a bitset hash and without duplicate checks
+  seed_t getStreamKey(const edm4hep::EventHeaderCollection& evt_headers,
+                      const std::string_view& name) const {
+    const auto& evt_header = evt_headers.at(0);
+    seed_t key             = eicrecon::mix64(m_seed.value());
+    key = eicrecon::mix64(key, static_cast<std::uint64_t>(evt_header.getRunNumber()));
+    key = eicrecon::mix64(key, static_cast<std::uint64_t>(evt_header.getEventNumber()));
+    return eicrecon::mix64(key, std::hash<std::string_view>{}(name));
+  }
+
+  // calculate an event-independent key from name only, for random streams drawn at
+  // initialization (e.g. pre-generated noise)
+  seed_t getStreamKey(const std::string_view& name) const {
+    return eicrecon::mix64(eicrecon::mix64(m_seed.value()), std::hash<std::string_view>{}(name));
+  }
+
 protected:
   ALGORITHMS_DEFINE_LOGGED_SERVICE(UniqueIDGenSvc)
 
@@ -13,6 +13,7 @@
 #include <gsl/pointers>
 
 #include "CalorimeterParticleIDPreML.h"
+#include "algorithms/interfaces/ObjectIDIndex.h"
 
 namespace eicrecon {
 
@@ -39,18 +40,26 @@ void CalorimeterParticleIDPreML::process(const CalorimeterParticleIDPreML::Input
     target_tensor.setElementType(7); // 7 - int64
   }
 
+  // Index cluster associations by cluster once per event
+  ObjectIDIndex<edm4eic::MCRecoClusterParticleAssociationCollection> cluster_assoc_index;
+  if (cluster_assocs != nullptr) {
+    cluster_assoc_index.build(*cluster_assocs, [](const auto& assoc) { return assoc.getRec(); });
+  }
+  auto find_best_assoc = [&cluster_assoc_index](const edm4eic::Cluster& cluster) {
+    edm4eic::MCRecoClusterParticleAssociation best_assoc;
+    for (auto assoc : cluster_assoc_index.find(cluster)) {
+      if ((not best_assoc.isAvailable()) || (assoc.getWeight() > best_assoc.getWeight())) {
+        best_assoc = assoc;
+      }
+    }
+    return best_assoc;
+  };
+
   for (edm4eic::Cluster cluster : *clusters) {
     double momentum = NAN;
     {
       // FIXME: use track momentum once matching to tracks becomes available
-      edm4eic::MCRecoClusterParticleAssociation best_assoc;
-      for (auto assoc : *cluster_assocs) {
-        if (assoc.getRec() == cluster) {
-          if ((not best_assoc.isAvailable()) || (assoc.getWeight() > best_assoc.getWeight())) {
-            best_assoc = assoc;
-          }
-        }
-      }
+      edm4eic::MCRecoClusterParticleAssociation best_assoc = find_best_assoc(cluster);
       if (best_assoc.isAvailable()) {
         momentum = edm4hep::utils::magnitude(best_assoc.getSim().getMomentum());
       } else {
@@ -69,14 +78,7 @@ void CalorimeterParticleIDPreML::process(const CalorimeterParticleIDPreML::Input
     }
 
     if (cluster_assocs != nullptr) {
-      edm4eic::MCRecoClusterParticleAssociation best_assoc;
-      for (auto assoc : *cluster_assocs) {
-        if (assoc.getRec() == cluster) {
-          if ((not best_assoc.isAvailable()) || (assoc.getWeight() > best_assoc.getWeight())) {
-            best_assoc = assoc;
-          }
-        }
-      }
+      edm4eic::MCRecoClusterParticleAssociation best_assoc = find_best_assoc(cluster);
       int64_t is_electron = 0;
       int64_t is_pion     = 0;
       if (best_assoc.isAvailable()) {
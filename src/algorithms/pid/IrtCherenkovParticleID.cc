@@ -33,6 +33,7 @@
 #include <utility>
 #include <vector>
 
+#include "algorithms/interfaces/ObjectIDIndex.h"
 #include "algorithms/pid/IrtCherenkovParticleIDConfig.h"
 #include "algorithms/pid/Tools.h"
 
@@ -168,6 +169,13 @@ void IrtCherenkovParticleID::process(const IrtCherenkovParticleID::Input& input,
     return;
   }
 
+  // index hit associations by raw hit, used by the cheat modes
+  ObjectIDIndex<edm4eic::MCRecoTrackerHitAssociationCollection> hit_assoc_index;
+  if (m_cfg.cheatPhotonVertex || m_cfg.cheatTrueRadiator) {
+    hit_assoc_index.build(*in_hit_assocs,
+                          [](const auto& hit_assoc) { return hit_assoc.getRawHit(); });
+  }
+
   // loop over charged particles ********************************************
   trace("{:#<70}", "### CHARGED PARTICLES ");
   std::size_t num_charged_particles = in_charged_particle_size_distribution.begin()->first;
@@ -227,17 +235,13 @@ void IrtCherenkovParticleID::process(const IrtCherenkovParticleID::Input& input,
         edm4hep::MCParticle mc_photon;
         bool mc_photon_found = false;
         if (m_cfg.cheatPhotonVertex || m_cfg.cheatTrueRadiator) {
-          for (const auto& hit_assoc : *in_hit_assocs) {
-            if (hit_assoc.getRawHit().isAvailable()) {
-              if (hit_assoc.getRawHit().id() == raw_hit.id()) {
-                mc_photon       = hit_assoc.getSimHit().getParticle();
-                mc_photon_found = true;
-                if (mc_photon.getPDG() != -22) {
-                  warning("non-opticalphoton hit: PDG = {}", mc_photon.getPDG());
-                }
-                break;
-              }
+          for (const auto& hit_assoc : hit_assoc_index.find(raw_hit)) {
+            mc_photon       = hit_assoc.getSimHit().getParticle();
+            mc_photon_found = true;
+            if (mc_photon.getPDG() != -22) {
+              warning("non-opticalphoton hit: PDG = {}", mc_photon.getPDG());
             }
+            break;
           }
         }
 
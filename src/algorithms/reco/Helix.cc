@@ -512,6 +512,67 @@ std::pair<double, double> Helix::pathLengths(const Helix& h, double minStepSize,
   }
 }
 
+std::pair<double, double> Helix::refinePathLengths(const Helix& h, double s1, double s2) const {
+  //
+  //  Newton's method on the squared distance between the two helices
+  //  as a function of both path lengths, starting from s1 and s2, e.g.
+  //  the intersection of the two circles in the xy-plane. Where the
+  //  Hessian is not positive definite the Gauss-Newton step is taken,
+  //  and steps are limited to a fraction of a turn.
+  //
+  if (mSingularity != h.mSingularity)
+    return std::pair<double, double>(NoSolution, NoSolution);
+
+  const double MaxPrecisionNeeded = edm4eic::unit::um;
+  const int MaxIterations         = 20;
+
+  // second derivative of the position along a helix, normal to it
+  auto bend = [](const Helix& helix, double s) {
+    if (helix.mSingularity)
+      return edm4hep::Vector3f(0, 0, 0);
+    double a = helix.mPhase + s * helix.mH * helix.mCurvature * helix.mCosDipAngle;
+    double k = helix.mCurvature * helix.mCosDipAngle * helix.mCosDipAngle;
+    return edm4hep::Vector3f(-k * cos(a), -k * sin(a), 0);
+  };
+
+  //          (cos(angMax)-1)/angMax = 0.1
+  const double angMax = 0.21;
+  double maxStep      = std::numeric_limits<double>::max();
+  if (!mSingularity)
+    maxStep = std::min(fabs(angMax / (mCurvature * mCosDipAngle)),
+                       fabs(angMax / (h.mCurvature * h.mCosDipAngle)));
+
+  for (int i = 0; i < MaxIterations; i++) {
+    edm4hep::Vector3f dv = at(s1) - h.at(s2);
+    edm4hep::Vector3f t1 = cat(s1);
+    edm4hep::Vector3f t2 = h.cat(s2);
+    double g1            = dv * t1;
+    double g2            = -(dv * t2);
+    double h11           = 1 + dv * bend(*this, s1);
+    double h22           = 1 - dv * bend(h, s2);
+    double h12           = -(t1 * t2);
+    if (h11 <= 0 || h22 <= 0 || h11 * h22 - h12 * h12 <= 0) {
+      h11 = 1;
+      h22 = 1;
+    }
+    double det = h11 * h22 - h12 * h12;
+    if (det <= std::numeric_limits<double>::epsilon())
+      break; // parallel lines
+    double ds1   = (h22 * g1 - h12 * g2) / det;
+    double ds2   = (h11 * g2 - h12 * g1) / det;
+    double scale = std::max(fabs(ds1), fabs(ds2)) / maxStep;
+    if (scale > 1) {
+      ds1 /= scale;
+      ds2 /= scale;
+    }
+    s1 -= ds1;
+    s2 -= ds2;
+    if (fabs(ds1) < MaxPrecisionNeeded && fabs(ds2) < MaxPrecisionNeeded)
+      break;
+  }
+  return std::pair<double, double>(s1, s2);
+}
+
 void Helix::moveOrigin(double s) {
   if (mSingularity)
     mOrigin = at(s);
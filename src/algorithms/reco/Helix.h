@@ -93,6 +93,9 @@ public:
   std::pair<double, double> pathLengths(const Helix&, double minStepSize = 10 * edm4eic::unit::um,
                                         double minRange = 10 * edm4eic::unit::cm) const;
 
+  /// path lengths at dca between two helices, refined from start values s1, s2 (this, other)
+  std::pair<double, double> refinePathLengths(const Helix&, double s1, double s2) const;
+
   /// minimal distance between point and helix
   double distance(const edm4hep::Vector3f& p, bool scanPeriods = true) const;
 
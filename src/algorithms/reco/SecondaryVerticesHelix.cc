@@ -5,12 +5,17 @@
 #include <Evaluator/DD4hepUnits.h>
 #include <Math/GenVector/Cartesian3D.h>
 #include <Math/GenVector/DisplacementVector3D.h>
+#include <edm4eic/ReconstructedParticleCollection.h>
 #include <edm4eic/VertexCollection.h>
 #include <edm4eic/unit_system.h>
 #include <edm4hep/Vector3f.h>
 #include <edm4hep/Vector4f.h>
 #include <edm4hep/utils/vector_utils.h>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -22,6 +27,66 @@
 
 namespace eicrecon {
 
+namespace {
+
+  /// Per-track quantities of a V0 daughter candidate, in cm
+  struct V0Daughter {
+    edm4eic::ReconstructedParticle particle;
+    Helix helix;
+    // circle of the helix in the xy-plane, radius 0 for a straight line
+    double xcenter;
+    double ycenter;
+    double radius;
+  };
+
+  /// Smallest distance between the circles of two helices in the xy-plane
+  double transverseGap(const V0Daughter& d1, const V0Daughter& d2) {
+    if (d1.radius == 0. || d2.radius == 0.)
+      return 0.;
+    const double dd = std::hypot(d2.xcenter - d1.xcenter, d2.ycenter - d1.ycenter);
+    return std::max({dd - d1.radius - d2.radius, std::abs(d1.radius - d2.radius) - dd, 0.});
+  }
+
+  /**
+   * Path lengths at the dca between two helices. The start values are the intersections of
+   * their circles in the xy-plane, or the points of closest approach of the circles if they
+   * do not intersect, which are then refined in 3D. Straight lines are solved analytically.
+   */
+  std::pair<double, double> pathLengthsAtDca(const V0Daughter& d1, const V0Daughter& d2) {
+    if (d1.radius == 0. || d2.radius == 0.)
+      return d1.helix.pathLengths(d2.helix);
+
+    const double dx = d2.xcenter - d1.xcenter;
+    const double dy = d2.ycenter - d1.ycenter;
+    const double dd = std::hypot(dx, dy);
+    if (dd == 0.) // concentric circles
+      return {Helix::NoSolution, Helix::NoSolution};
+
+    // point on the first circle at angle alpha from the line of the centers
+    auto refineFrom = [&](double cosAlpha, double sinAlpha) {
+      const double x = d1.xcenter + d1.radius * (cosAlpha * dx - sinAlpha * dy) / dd;
+      const double y = d1.ycenter + d1.radius * (sinAlpha * dx + cosAlpha * dy) / dd;
+      return d1.helix.refinePathLengths(d2.helix, d1.helix.pathLength(x, y),
+                                        d2.helix.pathLength(x, y));
+    };
+    auto distance = [&](const std::pair<double, double>& ss) {
+      return edm4hep::utils::magnitude(d1.helix.at(ss.first) - d2.helix.at(ss.second));
+    };
+
+    const double cosAlpha =
+        (d1.radius * d1.radius + dd * dd - d2.radius * d2.radius) / (2 * d1.radius * dd);
+    if (std::abs(cosAlpha) < 1) { // two intersections
+      const double sinAlpha = std::sqrt(1 - cosAlpha * cosAlpha);
+      const auto ss1        = refineFrom(cosAlpha, sinAlpha);
+      const auto ss2        = refineFrom(cosAlpha, -sinAlpha);
+      return distance(ss2) < distance(ss1) ? ss2 : ss1;
+    }
+    // no intersection (or exactly one), toward the second center unless inside it
+    return refineFrom(cosAlpha > 0 ? 1. : -1., 0.);
+  }
+
+} // namespace
+
 /**
    * @brief Initialize the SecondaryVerticesHelix Algorithm
    *
@@ -60,93 +125,103 @@ void SecondaryVerticesHelix::process(const SecondaryVerticesHelix::Input& input,
   debug("Primary vertex = ({},{},{})cm \t b field = {} tesla", pVtxPos.x, pVtxPos.y, pVtxPos.z,
         b_field / dd4hep::tesla);
 
-  std::vector<Helix> hVec;
-  hVec.clear();
-  std::vector<unsigned int> indexVec;
-  indexVec.clear();
-  for (unsigned int i = 0; const auto& p : *rcparts) {
+  // Per-track quantities, computed once and split by charge
+  std::vector<V0Daughter> positives;
+  std::vector<V0Daughter> negatives;
+  for (const auto& p : *rcparts) {
     if (p.getCharge() == 0)
       continue;
     Helix h(p, b_field);
+    // Helix function uses cm unit
     double dca = h.distance(pVtxPos) * edm4eic::unit::cm;
     if (dca < m_cfg.minDca)
       continue;
 
-    hVec.push_back(h);
-    indexVec.push_back(i);
-    ++i;
+    const double radius = h.curvature() > std::numeric_limits<double>::epsilon()
+                              ? 1. / h.curvature()
+                              : 0.; // straight line
+    auto& daughters = (p.getCharge() > 0) ? positives : negatives;
+    daughters.push_back({p, h, h.xcenter(), h.ycenter(), radius});
   }
 
-  if (hVec.size() != indexVec.size())
-    return;
-
-  debug("\tVector size {}, {}", hVec.size(), indexVec.size());
-
-  for (unsigned int i1 = 0; i1 < hVec.size(); ++i1) {
-    for (unsigned int i2 = i1 + 1; i2 < hVec.size(); ++i2) {
-      const auto& p1 = (*rcparts)[indexVec[i1]];
-      const auto& p2 = (*rcparts)[indexVec[i2]];
-
-      if (!(m_cfg.unlikesign && p1.getCharge() + p2.getCharge() == 0))
-        continue;
-
-      const auto& h1 = hVec[i1];
-      const auto& h2 = hVec[i2];
-
-      // Helix function uses cm unit
-      double dca1 = h1.distance(pVtxPos) * edm4eic::unit::cm;
-      double dca2 = h2.distance(pVtxPos) * edm4eic::unit::cm;
-      if (dca1 < m_cfg.minDca || dca2 < m_cfg.minDca)
-        continue;
-
-      std::pair<double, double> const ss = h1.pathLengths(h2);
-      edm4hep::Vector3f h1AtDcaTo2       = h1.at(ss.first);
-      edm4hep::Vector3f h2AtDcaTo1       = h2.at(ss.second);
-
-      double dca12 = edm4hep::utils::magnitude(h1AtDcaTo2 - h2AtDcaTo1) * edm4eic::unit::cm;
-      if (std::isnan(dca12))
-        continue;
-      if (dca12 > m_cfg.maxDca12)
-        continue;
-      edm4hep::Vector3f pairPos = 0.5 * (h1AtDcaTo2 + h2AtDcaTo1);
-
-      edm4hep::Vector3f h1MomAtDca = h1.momentumAt(ss.first, b_field);
-      edm4hep::Vector3f h2MomAtDca = h2.momentumAt(ss.second, b_field);
-      edm4hep::Vector3f pairMom    = h1MomAtDca + h2MomAtDca;
-
-      double e1 =
-          std::hypot(edm4hep::utils::magnitude(h1MomAtDca), particleSvc.particle(p1.getPDG()).mass);
-      double e2 =
-          std::hypot(edm4hep::utils::magnitude(h2MomAtDca), particleSvc.particle(p2.getPDG()).mass);
-      double pairE = e1 + e2;
-      double angle = edm4hep::utils::angleBetween(pairMom, pairPos - pVtxPos);
-      if (cos(angle) < m_cfg.minCostheta)
-        continue;
-
-      double beta = edm4hep::utils::magnitude(pairMom) / pairE;
-      double time = edm4hep::utils::magnitude(pairPos - pVtxPos) / (beta * dd4hep::c_light);
-      edm4hep::Vector3f dL = pairPos - pVtxPos; // in cm
-      edm4hep::Vector3f decayL(dL.x * edm4eic::unit::cm, dL.y * edm4eic::unit::cm,
-                               dL.z * edm4eic::unit::cm);
-      double dca2pv = edm4hep::utils::magnitude(decayL) * sin(angle);
-      if (dca2pv > m_cfg.maxDca)
-        continue;
-
-      auto v0 = out_secondary_vertices->create();
-      v0.setType(2); // 2 for secondary
-      v0.setPosition({(float)(pairPos.x * edm4eic::unit::cm / edm4eic::unit::mm),
-                      (float)(pairPos.y * edm4eic::unit::cm / edm4eic::unit::mm),
-                      (float)(pairPos.z * edm4eic::unit::cm / edm4eic::unit::mm), (float)time});
-      v0.addToAssociatedParticles(p1);
-      v0.addToAssociatedParticles(p2);
-
-      debug("One secondary vertex found at (x,y,z) = ({}, {}, {}) mm.",
-            pairPos.x * edm4eic::unit::cm / edm4eic::unit::mm,
-            pairPos.y * edm4eic::unit::cm / edm4eic::unit::mm,
-            pairPos.z * edm4eic::unit::cm / edm4eic::unit::mm);
-
-    } // end i2
-  } // end i1
+  debug("\tVector size {}, {}", positives.size(), negatives.size());
+
+  auto makeV0 = [&](const V0Daughter& d1, const V0Daughter& d2) {
+    const auto& p1 = d1.particle;
+    const auto& p2 = d2.particle;
+    const auto& h1 = d1.helix;
+    const auto& h2 = d2.helix;
+
+    // circles in the xy-plane further apart than maxDca12 cannot come closer in 3D; this
+    // only rejects pairs with a daughter far from the primary vertex, since circles passing
+    // close to it come close to each other there
+    if (transverseGap(d1, d2) * edm4eic::unit::cm > m_cfg.maxDca12)
+      return;
+
+    std::pair<double, double> const ss = pathLengthsAtDca(d1, d2);
+    edm4hep::Vector3f h1AtDcaTo2       = h1.at(ss.first);
+    edm4hep::Vector3f h2AtDcaTo1       = h2.at(ss.second);
+
+    double dca12 = edm4hep::utils::magnitude(h1AtDcaTo2 - h2AtDcaTo1) * edm4eic::unit::cm;
+    if (std::isnan(dca12))
+      return;
+    if (dca12 > m_cfg.maxDca12)
+      return;
+    edm4hep::Vector3f pairPos = 0.5 * (h1AtDcaTo2 + h2AtDcaTo1);
+
+    edm4hep::Vector3f h1MomAtDca = h1.momentumAt(ss.first, b_field);
+    edm4hep::Vector3f h2MomAtDca = h2.momentumAt(ss.second, b_field);
+    edm4hep::Vector3f pairMom    = h1MomAtDca + h2MomAtDca;
+
+    double e1 =
+        std::hypot(edm4hep::utils::magnitude(h1MomAtDca), particleSvc.particle(p1.getPDG()).mass);
+    double e2 =
+        std::hypot(edm4hep::utils::magnitude(h2MomAtDca), particleSvc.particle(p2.getPDG()).mass);
+    double pairE = e1 + e2;
+    double angle = edm4hep::utils::angleBetween(pairMom, pairPos - pVtxPos);
+    if (cos(angle) < m_cfg.minCostheta)
+      return;
+
+    double beta          = edm4hep::utils::magnitude(pairMom) / pairE;
+    double time          = edm4hep::utils::magnitude(pairPos - pVtxPos) / (beta * dd4hep::c_light);
+    edm4hep::Vector3f dL = pairPos - pVtxPos; // in cm
+    edm4hep::Vector3f decayL(dL.x * edm4eic::unit::cm, dL.y * edm4eic::unit::cm,
+                             dL.z * edm4eic::unit::cm);
+    double dca2pv = edm4hep::utils::magnitude(decayL) * sin(angle);
+    if (dca2pv > m_cfg.maxDca)
+      return;
+
+    auto v0 = out_secondary_vertices->create();
+    v0.setType(2); // 2 for secondary
+    v0.setPosition({(float)(pairPos.x * edm4eic::unit::cm / edm4eic::unit::mm),
+                    (float)(pairPos.y * edm4eic::unit::cm / edm4eic::unit::mm),
+                    (float)(pairPos.z * edm4eic::unit::cm / edm4eic::unit::mm), (float)time});
+    v0.addToAssociatedParticles(p1);
+    v0.addToAssociatedParticles(p2);
+
+    debug("One secondary vertex found at (x,y,z) = ({}, {}, {}) mm.",
+          pairPos.x * edm4eic::unit::cm / edm4eic::unit::mm,
+          pairPos.y * edm4eic::unit::cm / edm4eic::unit::mm,
+          pairPos.z * edm4eic::unit::cm / edm4eic::unit::mm);
+  };
+
+  // All pairs are tried: the circles of daughters from near the primary vertex all meet
+  // close to it, so binning in phi or dca gives no exact pair rejection. Each pair is cheap.
+  if (m_cfg.unlikesign) {
+    for (const auto& d1 : positives) {
+      for (const auto& d2 : negatives) {
+        makeV0(d1, d2);
+      }
+    }
+  } else {
+    for (const auto* daughters : {&positives, &negatives}) {
+      for (std::size_t i1 = 0; i1 < daughters->size(); ++i1) {
+        for (std::size_t i2 = i1 + 1; i2 < daughters->size(); ++i2) {
+          makeV0((*daughters)[i1], (*daughters)[i2]);
+        }
+      }
+    }
+  }
 
 } // end process
 
@@ -11,6 +11,8 @@ namespace eicrecon {
 
 struct SecondaryVerticesHelixConfig {
 
+  // pair opposite charges, or otherwise like charges (++ and --); before, no pairs at
+  // all were formed without unlikesign
   bool unlikesign   = true;
   float minDca      = 0.03 * edm4eic::unit::mm; // mm, daughter to pVtx
   float maxDca12    = 1. * edm4eic::unit::mm;   // mm, dca between daughter 1 and 2
@@ -24,6 +24,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace dd4hep::rec {
 class Surface;
@@ -47,6 +48,13 @@ public:
                           std::shared_ptr<spdlog::logger> log,
                           std::shared_ptr<spdlog::logger> init_log) final;
 
+  /// Use a tracking geometry and magnetic field built without DD4hep, e.g. in tests
+  void initialize(std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+                  std::shared_ptr<const Acts::MagneticFieldProvider> magneticField) {
+    m_trackingGeo   = std::move(trackingGeometry);
+    m_magneticField = std::move(magneticField);
+  }
+
   const dd4hep::Detector* dd4hepDetector() const { return m_dd4hepDetector; }
 
   /** Gets the ACTS tracking geometry.
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <Acts/MagneticField/MagneticFieldProvider.hpp>
+#include <Acts/Propagator/AtlasStepper.hpp>
+#include <Acts/Propagator/EigenStepper.hpp>
+#include <Acts/Propagator/StraightLineStepper.hpp>
+#include <Acts/Propagator/SympyStepper.hpp>
+#include <memory>
+#include <utility>
+
+#include "algorithms/tracking/StepperType.h"
+
+namespace eicrecon {
+
+/**
+ * Calls `f` with an Acts stepper of the given type, in the magnetic field `field`, and
+ * returns its result. `f` is instantiated for all stepper types, and has to return the
+ * same type for all of them, e.g. a type-erased propagator or track finder.
+ */
+template <typename Function>
+auto withStepper(StepperType type, std::shared_ptr<const Acts::MagneticFieldProvider> field,
+                 Function&& f) {
+  switch (type) {
+  case StepperType::sympy:
+    return std::forward<Function>(f)(Acts::SympyStepper(std::move(field)));
+  case StepperType::atlas:
+    return std::forward<Function>(f)(Acts::AtlasStepper(std::move(field)));
+  case StepperType::straight_line:
+    return std::forward<Function>(f)(Acts::StraightLineStepper());
+  case StepperType::eigen:
+  default:
+    return std::forward<Function>(f)(Acts::EigenStepper<>(std::move(field)));
+  }
+}
+
+} // namespace eicrecon
@@ -39,6 +39,7 @@
 #include <vector>
 
 #include "ActsToTracks.h"
+#include "algorithms/tracking/ConstTrackContainerView.h"
 #include "extensions/edm4eic/EDM4eicToActs.h"
 
 namespace eicrecon {
@@ -62,16 +63,17 @@ namespace {
 void ActsToTracks::init() {}
 
 void ActsToTracks::process(const Input& input, const Output& output) const {
-  const auto [meas2Ds, track_seeds, acts_track_states, acts_tracks, raw_hit_assocs] = input;
-  auto [trajectories, track_parameters, tracks, tracks_links, tracks_assoc]         = output;
+  const auto [meas2Ds, track_seeds, acts_track_states, acts_tracks, raw_hit_assoc_index] = input;
+  auto [trajectories, track_parameters, tracks, tracks_links, tracks_assoc]              = output;
+
+  // Truth matching needs hit associations, and is skipped in data-only mode
+  const bool do_assoc = !m_data_mode.dataOnly() && raw_hit_assoc_index != nullptr;
 
   // Create accessor for seed number dynamic column
   Acts::ConstProxyAccessor<unsigned int> seedNumber("seed");
 
-  // Construct ActsExamples::ConstTrackContainer from underlying containers
-  auto trackStateContainer = std::make_shared<Acts::ConstVectorMultiTrajectory>(*acts_track_states);
-  auto trackContainer      = std::make_shared<Acts::ConstVectorTrackContainer>(*acts_tracks);
-  ActsExamples::ConstTrackContainer acts_track_container(trackContainer, trackStateContainer);
+  // View the underlying containers as an ActsExamples::ConstTrackContainer, without copying them
+  auto acts_track_container = makeConstTrackContainerView(*acts_tracks, *acts_track_states);
 
   // Loop over tracks
   for (const auto& track : acts_track_container) {
@@ -231,19 +233,15 @@ void ActsToTracks::process(const Input& input, const Output& output) const {
                   meas2D.getLoc().a, meas2D.getLoc().b);
 
             // Determine track associations if hit associations provided
-            // FIXME: not able to check whether optional inputs were provided
-            //if (raw_hit_assocs->has_value()) {
-            for (const auto& hit : meas2D.getHits()) {
-              auto raw_hit = hit.getRawHit();
-              for (const auto raw_hit_assoc : *raw_hit_assocs) {
-                if (raw_hit_assoc.getRawHit() == raw_hit) {
+            if (do_assoc) {
+              for (const auto& hit : meas2D.getHits()) {
+                for (const auto raw_hit_assoc : raw_hit_assoc_index->find(hit.getRawHit())) {
                   auto sim_hit     = raw_hit_assoc.getSimHit();
                   auto mc_particle = sim_hit.getParticle();
                   mcparticle_weight_by_hit_count[mc_particle]++;
                 }
               }
             }
-            //}
           }
         }
       }
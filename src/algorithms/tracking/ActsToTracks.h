@@ -8,7 +8,6 @@
 #include <algorithms/algorithm.h>
 #include <edm4eic/MCRecoTrackParticleAssociationCollection.h>
 #include <edm4eic/MCRecoTrackParticleLinkCollection.h>
-#include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
 #include <edm4eic/Measurement2DCollection.h>
 #include <edm4eic/TrackCollection.h>
 #include <edm4eic/TrackParametersCollection.h>
@@ -18,6 +17,8 @@
 #include <string>
 #include <string_view>
 
+#include "TrackerHitAssociationIndex.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -25,7 +26,7 @@ namespace eicrecon {
 using ActsToTracksAlgorithm = algorithms::Algorithm<
     algorithms::Input<edm4eic::Measurement2DCollection, edm4eic::TrackSeedCollection,
                       Acts::ConstVectorMultiTrajectory, Acts::ConstVectorTrackContainer,
-                      std::optional<edm4eic::MCRecoTrackerHitAssociationCollection>>,
+                      std::optional<TrackerHitAssociationIndex>>,
     algorithms::Output<edm4eic::TrajectoryCollection, edm4eic::TrackParametersCollection,
                        edm4eic::TrackCollection,
                        std::optional<edm4eic::MCRecoTrackParticleLinkCollection>,
@@ -40,7 +41,7 @@ public:
                                   "inputTrackSeeds",
                                   "inputActsTrackStates",
                                   "inputActsTracks",
-                                  "inputRawTrackerHitAssociations",
+                                  "inputRawTrackerHitAssociationIndex",
                               },
                               {
                                   "outputTrajectories",
@@ -53,6 +54,9 @@ public:
 
   void init() final;
   void process(const Input&, const Output&) const final;
+
+private:
+  const algorithms::DataModeSvc& m_data_mode = algorithms::DataModeSvc::instance();
 };
 
 } // namespace eicrecon
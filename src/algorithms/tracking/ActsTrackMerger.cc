@@ -17,6 +17,8 @@
 #include <utility>
 #include <vector>
 
+#include "ConstTrackContainerView.h"
+
 namespace eicrecon {
 
 void ActsTrackMerger::process(const Input& input, const Output& output) const {
@@ -27,16 +29,10 @@ void ActsTrackMerger::process(const Input& input, const Output& output) const {
   std::vector<ActsExamples::ConstTrackContainer> input_containers;
 
   // Process first input set
-  auto trackStateContainer1 =
-      std::make_shared<Acts::ConstVectorMultiTrajectory>(*input_track_states1);
-  auto trackContainer1 = std::make_shared<Acts::ConstVectorTrackContainer>(*input_tracks1);
-  input_containers.emplace_back(trackContainer1, trackStateContainer1);
+  input_containers.push_back(makeConstTrackContainerView(*input_tracks1, *input_track_states1));
 
   // Process second input set
-  auto trackStateContainer2 =
-      std::make_shared<Acts::ConstVectorMultiTrajectory>(*input_track_states2);
-  auto trackContainer2 = std::make_shared<Acts::ConstVectorTrackContainer>(*input_tracks2);
-  input_containers.emplace_back(trackContainer2, trackStateContainer2);
+  input_containers.push_back(makeConstTrackContainerView(*input_tracks2, *input_track_states2));
 
   // Create new mutable containers for merging
   auto mergedTrackContainer      = std::make_shared<Acts::VectorTrackContainer>();
@@ -23,6 +23,7 @@
 
 #include "Acts/Utilities/Logger.hpp"
 #include "AmbiguitySolverConfig.h"
+#include "ConstTrackContainerView.h"
 #include "extensions/spdlog/SpdlogFormatters.h" // IWYU pragma: keep
 #include "extensions/spdlog/SpdlogToActs.h"
 
@@ -61,11 +62,8 @@ void AmbiguitySolver::process(const Input& input, const Output& output) const {
   const auto [input_track_states, input_tracks] = input;
   auto [output_track_states, output_tracks]     = output;
 
-  // Construct ConstTrackContainer from underlying containers
-  auto trackStateContainer =
-      std::make_shared<Acts::ConstVectorMultiTrajectory>(*input_track_states);
-  auto trackContainer = std::make_shared<Acts::ConstVectorTrackContainer>(*input_tracks);
-  ActsExamples::ConstTrackContainer input_trks(trackContainer, trackStateContainer);
+  // View the underlying containers as a ConstTrackContainer, without copying them
+  auto input_trks = makeConstTrackContainerView(*input_tracks, *input_track_states);
 
   Acts::GreedyAmbiguityResolution::State state;
   m_core->computeInitialState(input_trks, state, &sourceLinkHash, &sourceLinkEquality);
@@ -24,10 +24,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <system_error>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <Acts/EventData/ParticleHypothesis.hpp>
 #include <Acts/EventData/ProxyAccessor.hpp>
 #include <Acts/EventData/SourceLink.hpp>
@@ -67,60 +69,36 @@
 // IWYU pragma: no_include <Acts/Utilities/detail/ContainerIterator.hpp>
 
 #include "ActsGeometryProvider.h"
+#include "MeasurementSourceLinkIndex.h"
+#include "algorithms/interfaces/TaskPool.h"
 #include "extensions/edm4eic/EDM4eicToActs.h"
 #include "extensions/spdlog/SpdlogFormatters.h" // IWYU pragma: keep
 #include "extensions/spdlog/SpdlogToActs.h"
 
 namespace {
 
-/// Calibrator that reads directly from edm4eic::Measurement2DCollection.
-/// Also owns the geometry-ordered IndexSourceLink multiset built from the same collection.
+/// Calibrator that reads the calibrated measurements of the shared source link index
 class EDM4eicMeasurementSourceLinkCalibrator {
 public:
-  explicit EDM4eicMeasurementSourceLinkCalibrator(const edm4eic::Measurement2DCollection* meas2Ds)
-      : m_meas2Ds(meas2Ds) {
-    for (std::size_t index = 0; index < meas2Ds->size(); ++index) {
-      m_orderedSourceLinks.emplace(Acts::GeometryIdentifier{(*meas2Ds)[index].getSurface()}, index);
-    }
-  }
-
-  const ActsExamples::GeometryIdMultiset<ActsExamples::IndexSourceLink>&
-  orderedSourceLinks() const {
-    return m_orderedSourceLinks;
-  }
+  explicit EDM4eicMeasurementSourceLinkCalibrator(
+      const eicrecon::MeasurementSourceLinkIndex* sourceLinkIndex)
+      : m_sourceLinkIndex(sourceLinkIndex) {}
 
   void calibrate(const Acts::GeometryContext& /*gctx*/, const Acts::CalibrationContext& /*cctx*/,
                  const Acts::SourceLink& sourceLink,
                  Acts::VectorMultiTrajectory::TrackStateProxy trackState) const {
     trackState.setUncalibratedSourceLink(Acts::SourceLink{sourceLink});
     const auto& idxSourceLink = sourceLink.get<ActsExamples::IndexSourceLink>();
-    const auto& meas2D        = (*m_meas2Ds)[idxSourceLink.index()];
 
-#if Acts_VERSION_MAJOR > 45 || (Acts_VERSION_MAJOR == 45 && Acts_VERSION_MINOR >= 2)
-    Acts::Vector<2> loc       = Acts::Vector2::Zero();
-    Acts::SquareMatrix<2> cov = Acts::SquareMatrix<2>::Zero();
-#else
-    Acts::ActsVector<2> loc       = Acts::Vector2::Zero();
-    Acts::ActsSquareMatrix<2> cov = Acts::ActsSquareMatrix<2>::Zero();
-#endif
-    constexpr auto mm                       = Acts::UnitConstants::mm / edm4eic::unit::mm;
-    constexpr auto mm2                      = mm * mm;
-    loc[Acts::eBoundLoc0]                   = meas2D.getLoc().a * mm;
-    loc[Acts::eBoundLoc1]                   = meas2D.getLoc().b * mm;
-    cov(Acts::eBoundLoc0, Acts::eBoundLoc0) = meas2D.getCovariance().xx * mm2;
-    cov(Acts::eBoundLoc1, Acts::eBoundLoc1) = meas2D.getCovariance().yy * mm2;
-    cov(Acts::eBoundLoc0, Acts::eBoundLoc1) = meas2D.getCovariance().xy * mm2;
-    cov(Acts::eBoundLoc1, Acts::eBoundLoc0) = meas2D.getCovariance().xy * mm2;
-
-    trackState.allocateCalibrated(loc, cov);
+    trackState.allocateCalibrated(m_sourceLinkIndex->local(idxSourceLink.index()),
+                                  m_sourceLinkIndex->covariance(idxSourceLink.index()));
     std::array<uint8_t, 2> indices{static_cast<uint8_t>(Acts::eBoundLoc0),
                                    static_cast<uint8_t>(Acts::eBoundLoc1)};
     trackState.setProjectorSubspaceIndices(indices);
   }
 
 private:
-  const edm4eic::Measurement2DCollection* m_meas2Ds;
-  ActsExamples::GeometryIdMultiset<ActsExamples::IndexSourceLink> m_orderedSourceLinks;
+  const eicrecon::MeasurementSourceLinkIndex* m_sourceLinkIndex;
 };
 
 } // anonymous namespace
@@ -141,64 +119,77 @@ void CKFTracking::init() {
         .numMeasurementsCutOff = {m_cfg.numMeasurementsCutOff.begin(),
                                   m_cfg.numMeasurementsCutOff.end()}}},
   };
-  m_trackFinderFunc = CKFTracking::makeCKFTrackingFunction(
-      m_geoSvc->trackingGeometry(), m_geoSvc->getFieldProvider(), acts_logger());
-}
+  m_measurementSelector =
+      std::make_unique<const Acts::MeasurementSelector>(m_sourcelinkSelectorCfg);
 
-void CKFTracking::process(const Input& input, const Output& output) const {
-  const auto [init_trk_seeds, meas2Ds]      = input;
-  auto [output_track_states, output_tracks] = output;
-
-  // If measurements or initial track parameters are empty, create empty output containers
-  if (meas2Ds->empty() || init_trk_seeds->empty()) {
-    debug("No seeds or measurements, creating empty output containers");
-    *output_track_states = new Acts::ConstVectorMultiTrajectory();
-    *output_tracks       = new Acts::ConstVectorTrackContainer();
-    return;
+  m_trackFinderFunc = CKFTracking::makeCKFTrackingFunction(
+      m_geoSvc->trackingGeometry(), m_geoSvc->getFieldProvider(), m_cfg.stepper, acts_logger());
+
+  // Perigee surface, target of the initial parameters and of the extrapolation
+  m_perigeeSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3{0., 0., 0.});
+  m_extrapolator   = std::make_unique<const Extrapolator>(
+      Acts::EigenStepper<>(m_BField),
+      Acts::Navigator({.trackingGeometry = m_geoSvc->trackingGeometry()},
+                      acts_logger().cloneWithSuffix("Navigator")),
+      acts_logger().cloneWithSuffix("Propagator"));
+
+  // Workers sharing the seeds of one event with the calling thread
+  m_taskPool = TaskPool::shared(std::max<std::size_t>(m_cfg.numThreads, 1) - 1);
+
+  // Seed covariance unit conversion factors
+  for (const auto& [a, x] : edm4eic_indexed_units) {
+    for (const auto& [b, y] : edm4eic_indexed_units) {
+      m_covarianceUnits(a, b) = x * y;
+    }
   }
+}
 
-  ActsExamples::TrackParametersContainer acts_init_trk_params;
-  for (const auto& track_seed : *init_trk_seeds) {
-
+void CKFTracking::convertSeeds(const edm4eic::TrackSeedCollection& seeds,
+                               ActsExamples::TrackParametersContainer& params) const {
+  params.reserve(params.size() + seeds.size());
+  for (const auto& track_seed : seeds) {
     const auto& track_parameter = track_seed.getParams();
 
-    Acts::BoundVector params;
-    params(Acts::eBoundLoc0) =
-        track_parameter.getLoc().a * Acts::UnitConstants::mm; // cylinder radius
-    params(Acts::eBoundLoc1) =
-        track_parameter.getLoc().b * Acts::UnitConstants::mm; // cylinder length
-    params(Acts::eBoundPhi)    = track_parameter.getPhi();
-    params(Acts::eBoundTheta)  = track_parameter.getTheta();
-    params(Acts::eBoundQOverP) = track_parameter.getQOverP() / Acts::UnitConstants::GeV;
-    params(Acts::eBoundTime)   = track_parameter.getTime() * Acts::UnitConstants::ns;
+    Acts::BoundVector param;
+    param(Acts::eBoundLoc0)   = track_parameter.getLoc().a * Acts::UnitConstants::mm;
+    param(Acts::eBoundLoc1)   = track_parameter.getLoc().b * Acts::UnitConstants::mm;
+    param(Acts::eBoundPhi)    = track_parameter.getPhi();
+    param(Acts::eBoundTheta)  = track_parameter.getTheta();
+    param(Acts::eBoundQOverP) = track_parameter.getQOverP() / Acts::UnitConstants::GeV;
+    param(Acts::eBoundTime)   = track_parameter.getTime() * Acts::UnitConstants::ns;
 
 #if Acts_VERSION_MAJOR > 45 || (Acts_VERSION_MAJOR == 45 && Acts_VERSION_MINOR >= 1)
-    Acts::BoundMatrix cov = Acts::BoundMatrix::Zero();
+    Acts::BoundMatrix cov;
 #else
-    Acts::BoundSquareMatrix cov = Acts::BoundSquareMatrix::Zero();
+    Acts::BoundSquareMatrix cov;
 #endif
+    const auto& covariance = track_parameter.getCovariance();
     for (std::size_t i = 0; const auto& [a, x] : edm4eic_indexed_units) {
       for (std::size_t j = 0; const auto& [b, y] : edm4eic_indexed_units) {
-        cov(a, b) = track_parameter.getCovariance()(i, j) * x * y;
+        cov(a, b) = covariance(i, j) * m_covarianceUnits(a, b);
         ++j;
       }
       ++i;
     }
 
-    // Construct a perigee surface as the target surface
-    auto pSurface = Acts::Surface::makeShared<const Acts::PerigeeSurface>(Acts::Vector3(0, 0, 0));
-
-    // Create parameters
-    acts_init_trk_params.emplace_back(pSurface, params, cov, Acts::ParticleHypothesis::pion());
+    params.emplace_back(m_perigeeSurface, param, cov, Acts::ParticleHypothesis::pion());
   }
+}
+
+void CKFTracking::process(const Input& input, const Output& output) const {
+  const auto [init_trk_seeds, meas2Ds, sourceLinkIndex] = input;
+  auto [output_track_states, output_tracks]             = output;
 
-  //// Construct a perigee surface as the target surface
-  auto pSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3{0., 0., 0.});
+  // If measurements or initial track parameters are empty, create empty output containers
+  if (meas2Ds->empty() || init_trk_seeds->empty()) {
+    debug("No seeds or measurements, creating empty output containers");
+    *output_track_states = new Acts::ConstVectorMultiTrajectory();
+    *output_tracks       = new Acts::ConstVectorTrackContainer();
+    return;
+  }
 
-  // Convert algorithm log level to Acts log level for local logger
-  const auto spdlog_level = static_cast<spdlog::level::level_enum>(this->level());
-  const auto acts_level   = eicrecon::SpdlogToActsLevel(spdlog_level);
-  ACTS_LOCAL_LOGGER(Acts::getDefaultLogger("CKF", acts_level));
+  ActsExamples::TrackParametersContainer acts_init_trk_params;
+  convertSeeds(*init_trk_seeds, acts_init_trk_params);
 
   // Get run-scoped contexts from service
   const auto& gctx = m_geoSvc->getActsGeometryContext();
@@ -208,16 +199,14 @@ void CKFTracking::process(const Input& input, const Output& output) const {
   Acts::PropagatorPlainOptions pOptions(gctx, mctx);
   pOptions.maxSteps = 10000;
 
-  EDM4eicMeasurementSourceLinkCalibrator calibratorImpl{meas2Ds};
-  Acts::GainMatrixUpdater kfUpdater;
-  Acts::MeasurementSelector measSel{m_sourcelinkSelectorCfg};
+  EDM4eicMeasurementSourceLinkCalibrator calibratorImpl{sourceLinkIndex};
 
   Acts::CombinatorialKalmanFilterExtensions<ActsExamples::TrackContainer> extensions;
   extensions.updater.connect<&Acts::GainMatrixUpdater::operator()<
-      typename ActsExamples::TrackContainer::TrackStateContainerBackend>>(&kfUpdater);
+      typename ActsExamples::TrackContainer::TrackStateContainerBackend>>(&m_kfUpdater);
 
   ActsExamples::IndexSourceLinkAccessor slAccessor;
-  slAccessor.container = &calibratorImpl.orderedSourceLinks();
+  slAccessor.container = &sourceLinkIndex->orderedSourceLinks();
   using TrackStateCreatorType =
       Acts::TrackStateCreator<ActsExamples::IndexSourceLinkAccessor::Iterator,
                               ActsExamples::TrackContainer>;
@@ -227,7 +216,8 @@ void CKFTracking::process(const Input& input, const Output& output) const {
   trackStateCreator.calibrator.template connect<&EDM4eicMeasurementSourceLinkCalibrator::calibrate>(
       &calibratorImpl);
   trackStateCreator.measurementSelector
-      .template connect<&Acts::MeasurementSelector::select<Acts::VectorMultiTrajectory>>(&measSel);
+      .template connect<&Acts::MeasurementSelector::select<Acts::VectorMultiTrajectory>>(
+          m_measurementSelector.get());
 
   extensions.createTrackStates.template connect<&TrackStateCreatorType::createTrackStates>(
       &trackStateCreator);
@@ -235,83 +225,119 @@ void CKFTracking::process(const Input& input, const Output& output) const {
   // Set the CombinatorialKalmanFilter options
   CKFTracking::TrackFinderOptions options(gctx, mctx, cctx, extensions, pOptions);
 
-  using Extrapolator        = Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator>;
   using ExtrapolatorOptions = Extrapolator::template Options<
       Acts::ActorList<Acts::MaterialInteractor, Acts::EndOfWorldReached>>;
-  Extrapolator extrapolator(Acts::EigenStepper<>(m_BField),
-                            Acts::Navigator({.trackingGeometry = m_geoSvc->trackingGeometry()},
-                                            acts_logger().cloneWithSuffix("Navigator")),
-                            acts_logger().cloneWithSuffix("Propagator"));
   ExtrapolatorOptions extrapolationOptions(gctx, mctx);
 
-  // Create track container
-  auto trackContainer      = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
-  ActsExamples::TrackContainer acts_tracks(trackContainer, trackStateContainer);
-
-  // Create temporary track container
-  auto trackContainerTemp      = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainerTemp = std::make_shared<Acts::VectorMultiTrajectory>();
-  ActsExamples::TrackContainer acts_tracks_temp(trackContainerTemp, trackStateContainerTemp);
-
-  // Add seed number column
-  acts_tracks.addColumn<unsigned int>("seed");
-  acts_tracks_temp.addColumn<unsigned int>("seed");
+  // Seed number column, added to all track containers
   Acts::ProxyAccessor<unsigned int> seedNumber("seed");
+  auto makeTrackContainer = []() {
+    ActsExamples::TrackContainer tracks(std::make_shared<Acts::VectorTrackContainer>(),
+                                        std::make_shared<Acts::VectorMultiTrajectory>());
+    tracks.addColumn<unsigned int>("seed");
+    return tracks;
+  };
 
-  // Loop over seeds
-  for (std::size_t iseed = 0; iseed < acts_init_trk_params.size(); ++iseed) {
+  using TrackProxy = ActsExamples::TrackContainer::TrackProxy;
 
-    // Clear trackContainerTemp and trackStateContainerTemp
-    acts_tracks_temp.clear();
+  // Find, smooth and extrapolate the tracks of seeds [begin, end) in `found`, and call `accept`
+  // on the accepted ones in seed order. With `clear_per_seed`, `found` only holds the tracks of
+  // the current seed, so `accept` must copy them. Only reads shared state, so that disjoint
+  // seed ranges can be processed concurrently.
+  auto findTracks = [&](std::size_t begin, std::size_t end, ActsExamples::TrackContainer& found,
+                        bool clear_per_seed, const std::function<void(const TrackProxy&)>& accept) {
+    // Loop over seeds
+    for (std::size_t iseed = begin; iseed < end; ++iseed) {
 
-    // Run track finding for this seed
-    auto result = (*m_trackFinderFunc)(acts_init_trk_params.at(iseed), options, acts_tracks_temp);
+      // Clear temporary track container
+      if (clear_per_seed) {
+        found.clear();
+      }
 
-    if (!result.ok()) {
-      debug("Track finding failed for seed {} with error {}", iseed, result.error().message());
-      continue;
-    }
+      // Run track finding for this seed
+      auto result = (*m_trackFinderFunc)(acts_init_trk_params.at(iseed), options, found);
 
-    // Set seed number for all found tracks
-    auto& tracksForSeed = result.value();
-    for (auto& track : tracksForSeed) {
-      // Check if track has at least one valid (non-outlier) measurement
-      // (this check avoids errors inside smoothing and extrapolation)
-      auto lastMeasurement = Acts::findLastMeasurementState(track);
-      if (!lastMeasurement.ok()) {
-        debug("Track {} for seed {} has no valid measurements, skipping", track.index(), iseed);
+      if (!result.ok()) {
+        debug("Track finding failed for seed {} with error {}", iseed, result.error().message());
         continue;
       }
 
-      if (track.nMeasurements() < m_cfg.numMeasurementsMin) {
-        trace("Track {} for seed {} has fewer measurements than minimum of {}, skipping",
-              track.index(), iseed, m_cfg.numMeasurementsMin);
-        continue;
+      // Set seed number for all found tracks
+      auto& tracksForSeed = result.value();
+      for (auto& track : tracksForSeed) {
+        // Check if track has at least one valid (non-outlier) measurement
+        // (this check avoids errors inside smoothing and extrapolation)
+        auto lastMeasurement = Acts::findLastMeasurementState(track);
+        if (!lastMeasurement.ok()) {
+          debug("Track {} for seed {} has no valid measurements, skipping", track.index(), iseed);
+          continue;
+        }
+
+        if (track.nMeasurements() < m_cfg.numMeasurementsMin) {
+          trace("Track {} for seed {} has fewer measurements than minimum of {}, skipping",
+                track.index(), iseed, m_cfg.numMeasurementsMin);
+          continue;
+        }
+
+        auto smoothingResult = Acts::smoothTrack(gctx, track, acts_logger());
+        if (!smoothingResult.ok()) {
+          debug("Smoothing for seed {} and track {} failed with error {}", iseed, track.index(),
+                smoothingResult.error().message());
+          continue;
+        }
+
+        auto extrapolationResult = Acts::extrapolateTrackToReferenceSurface(
+            track, *m_perigeeSurface, *m_extrapolator, extrapolationOptions,
+            Acts::TrackExtrapolationStrategy::firstOrLast, acts_logger());
+
+        if (!extrapolationResult.ok()) {
+          debug("Extrapolation for seed {} and track {} failed with error {}", iseed,
+                track.index(), extrapolationResult.error().message());
+          continue;
+        }
+
+        seedNumber(track) = iseed;
+        accept(track);
       }
+    }
+  };
 
-      auto smoothingResult = Acts::smoothTrack(gctx, track, acts_logger());
-      if (!smoothingResult.ok()) {
-        debug("Smoothing for seed {} and track {} failed with error {}", iseed, track.index(),
-              smoothingResult.error().message());
-        continue;
-      }
+  // Create track container
+  auto trackContainer      = std::make_shared<Acts::VectorTrackContainer>();
+  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  ActsExamples::TrackContainer acts_tracks(trackContainer, trackStateContainer);
+  acts_tracks.addColumn<unsigned int>("seed");
 
-      auto extrapolationResult = Acts::extrapolateTrackToReferenceSurface(
-          track, *pSurface, extrapolator, extrapolationOptions,
-          Acts::TrackExtrapolationStrategy::firstOrLast, acts_logger());
+  // Copy an accepted track into the main track container
+  auto copyTrack = [&](const TrackProxy& track) {
+    auto acts_tracks_proxy = acts_tracks.makeTrack();
+    acts_tracks_proxy.copyFrom(track);
+  };
 
-      if (!extrapolationResult.ok()) {
-        debug("Extrapolation for seed {} and track {} failed with error {}", iseed, track.index(),
-              extrapolationResult.error().message());
-        continue;
+  const std::size_t num_seeds = acts_init_trk_params.size();
+  const std::size_t num_tasks = std::min(m_taskPool->num_workers() + 1, num_seeds);
+  if (num_tasks == 1) {
+    auto acts_tracks_temp = makeTrackContainer();
+    findTracks(0, num_seeds, acts_tracks_temp, true, copyTrack);
+  } else {
+    // Contiguous seed ranges, each finding tracks into its own container, which keeps all
+    // found tracks of the range so that the accepted ones are copied only once, when merging
+    // in range order. This reproduces the serial output.
+    std::vector<ActsExamples::TrackContainer> task_tracks;
+    std::vector<std::vector<ActsExamples::TrackContainer::IndexType>> task_accepted(num_tasks);
+    task_tracks.reserve(num_tasks);
+    for (std::size_t task = 0; task < num_tasks; ++task) {
+      task_tracks.push_back(makeTrackContainer());
+    }
+    m_taskPool->parallel_for(num_tasks, [&](std::size_t task) {
+      findTracks(task * num_seeds / num_tasks, (task + 1) * num_seeds / num_tasks,
+                 task_tracks[task], false,
+                 [&](const TrackProxy& track) { task_accepted[task].push_back(track.index()); });
+    });
+    for (std::size_t task = 0; task < num_tasks; ++task) {
+      for (auto index : task_accepted[task]) {
+        copyTrack(task_tracks[task].getTrack(index));
       }
-
-      seedNumber(track) = iseed;
-
-      // Copy accepted track into main track container
-      auto acts_tracks_proxy = acts_tracks.makeTrack();
-      acts_tracks_proxy.copyFrom(track);
     }
   }
 
@@ -3,12 +3,18 @@
 
 #pragma once
 
+#include <Acts/Definitions/TrackParametrization.hpp>
 #include <Acts/EventData/VectorMultiTrajectory.hpp>
 #include <Acts/EventData/VectorTrackContainer.hpp>
 #include <Acts/Geometry/TrackingGeometry.hpp>
 #include <Acts/MagneticField/MagneticFieldProvider.hpp>
+#include <Acts/Propagator/EigenStepper.hpp>
+#include <Acts/Propagator/Navigator.hpp>
+#include <Acts/Propagator/Propagator.hpp>
+#include <Acts/Surfaces/PerigeeSurface.hpp>
 #include <Acts/TrackFinding/CombinatorialKalmanFilter.hpp>
 #include <Acts/TrackFinding/MeasurementSelector.hpp>
+#include <Acts/TrackFitting/GainMatrixUpdater.hpp>
 #include <Acts/Utilities/Logger.hpp>
 #include <Acts/Utilities/Result.hpp>
 #include <ActsExamples/EventData/Track.hpp>
@@ -22,14 +28,18 @@
 #include <vector>
 
 #include "CKFTrackingConfig.h"
+#include "MeasurementSourceLinkIndex.h"
+#include "StepperType.h"
 #include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/interfaces/TaskPool.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 #include "algorithms/tracking/ActsGeometryProvider.h"
 
 namespace eicrecon {
 
 using CKFTrackingAlgorithm = algorithms::Algorithm<
-    algorithms::Input<edm4eic::TrackSeedCollection, edm4eic::Measurement2DCollection>,
+    algorithms::Input<edm4eic::TrackSeedCollection, edm4eic::Measurement2DCollection,
+                      MeasurementSourceLinkIndex>,
     algorithms::Output<Acts::ConstVectorMultiTrajectory*, Acts::ConstVectorTrackContainer*>>;
 
 /** Fitting algorithm implementation .
@@ -43,6 +53,8 @@ public:
   /// and track finder options and returns some track-finder-specific result.
   using TrackFinderOptions = Acts::CombinatorialKalmanFilterOptions<ActsExamples::TrackContainer>;
   using TrackFinderResult  = Acts::Result<std::vector<ActsExamples::TrackContainer::TrackProxy>>;
+  /// Propagator used to extrapolate found tracks to the perigee surface
+  using Extrapolator = Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator>;
 
   /// Find function that takes the above parameters
   /// @note This is separated into a virtual interface to keep compilation units
@@ -62,17 +74,22 @@ public:
   static std::shared_ptr<CKFTrackingFunction>
   makeCKFTrackingFunction(std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
                           std::shared_ptr<const Acts::MagneticFieldProvider> magneticField,
-                          const Acts::Logger& logger);
+                          StepperType stepperType, const Acts::Logger& logger);
 
   CKFTracking(std::string_view name)
       : CKFTrackingAlgorithm{name,
-                             {"inputTrackParameters", "inputMeasurements"},
+                             {"inputTrackParameters", "inputMeasurements",
+                              "inputMeasurementSourceLinkIndex"},
                              {"outputActsTrackStates", "outputActsTracks"},
                              "Combinatorial Kalman Filter track finding"} {}
 
   void init() final;
   void process(const Input&, const Output&) const final;
 
+  /// Convert all track seeds to initial track parameters on the perigee surface
+  void convertSeeds(const edm4eic::TrackSeedCollection& seeds,
+                    ActsExamples::TrackParametersContainer& params) const;
+
 private:
   std::shared_ptr<const Acts::Logger> m_acts_logger{nullptr};
   std::shared_ptr<CKFTrackingFunction> m_trackFinderFunc;
@@ -82,6 +99,16 @@ private:
 
   Acts::MeasurementSelector::Config m_sourcelinkSelectorCfg;
 
+  // Event-invariant objects, built once in init()
+  std::shared_ptr<const Acts::PerigeeSurface> m_perigeeSurface;
+  std::unique_ptr<const Extrapolator> m_extrapolator;
+  std::unique_ptr<const Acts::MeasurementSelector> m_measurementSelector;
+  Acts::GainMatrixUpdater m_kfUpdater;
+  // Unit conversion factors of the seed covariance, from EDM4eic into Acts units
+  Eigen::Matrix<double, Acts::eBoundSize, Acts::eBoundSize> m_covarianceUnits;
+  // Workers for track finding over seeds, shared by all instances with the same numThreads
+  std::shared_ptr<TaskPool> m_taskPool;
+
   /// Private access to the logging instance
   const Acts::Logger& acts_logger() const { return *m_acts_logger; }
 };
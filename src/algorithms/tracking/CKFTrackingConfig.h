@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
+#include "algorithms/tracking/StepperType.h"
+
 namespace eicrecon {
 struct CKFTrackingConfig {
   std::vector<double> etaBins                    = {};
@@ -13,5 +16,12 @@ struct CKFTrackingConfig {
   std::vector<std::size_t> numMeasurementsCutOff = {10};
 
   std::size_t numMeasurementsMin = 4;
+
+  // Stepper of the track finding propagation: eigen or sympy
+  StepperType stepper = StepperType::eigen;
+
+  // Number of threads sharing the seeds of one event (1: serial): the event thread and
+  // numThreads - 1 workers, shared by all event threads; the output does not depend on it
+  std::size_t numThreads = 1;
 };
 } // namespace eicrecon
@@ -8,6 +8,7 @@
 #include <Acts/Propagator/EigenStepper.hpp>
 #include <Acts/Propagator/Navigator.hpp>
 #include <Acts/Propagator/Propagator.hpp>
+#include <Acts/Propagator/SympyStepper.hpp>
 #include <Acts/TrackFinding/CombinatorialKalmanFilter.hpp>
 #include <Acts/Utilities/Logger.hpp>
 #include <Eigen/Core>
@@ -16,26 +17,28 @@
 #include <any>
 #include <cmath>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
 
 #include "ActsExamples/EventData/Track.hpp"
 #include "CKFTracking.h"
+#include "StepperType.h"
 
 namespace eicrecon {
 
-using Stepper    = Acts::EigenStepper<>;
-using Navigator  = Acts::Navigator;
-using Propagator = Acts::Propagator<Stepper, Navigator>;
-
-using CKF = Acts::CombinatorialKalmanFilter<Propagator, ActsExamples::TrackContainer>;
+using Navigator = Acts::Navigator;
 
 /** Finder implementation .
    *
    * \ingroup track
    */
+template <typename Stepper>
 struct CKFTrackingFunctionImpl : public eicrecon::CKFTracking::CKFTrackingFunction {
+  using Propagator = Acts::Propagator<Stepper, Navigator>;
+  using CKF        = Acts::CombinatorialKalmanFilter<Propagator, ActsExamples::TrackContainer>;
+
   CKF trackFinder;
 
   CKFTrackingFunctionImpl(CKF&& f) : trackFinder(std::move(f)) {}
@@ -54,19 +57,35 @@ namespace eicrecon {
 
 std::shared_ptr<CKFTracking::CKFTrackingFunction> CKFTracking::makeCKFTrackingFunction(
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
-    std::shared_ptr<const Acts::MagneticFieldProvider> magneticField, const Acts::Logger& logger) {
-  Stepper stepper(std::move(magneticField));
+    std::shared_ptr<const Acts::MagneticFieldProvider> magneticField, StepperType stepperType,
+    const Acts::Logger& logger) {
   Navigator::Config cfg{.trackingGeometry = trackingGeometry};
   cfg.resolvePassive   = false;
   cfg.resolveMaterial  = true;
   cfg.resolveSensitive = true;
-  Navigator navigator(cfg);
 
-  Propagator propagator(std::move(stepper), std::move(navigator));
-  CKF trackFinder(std::move(propagator), logger.cloneWithSuffix("CKF"));
+  auto makeImpl = [&](auto stepper) -> std::shared_ptr<CKFTracking::CKFTrackingFunction> {
+    using Impl = CKFTrackingFunctionImpl<decltype(stepper)>;
+
+    Navigator navigator(cfg);
+    typename Impl::Propagator propagator(std::move(stepper), std::move(navigator));
+    typename Impl::CKF trackFinder(std::move(propagator), logger.cloneWithSuffix("CKF"));
+
+    // build the track finder functions. owns the track finder object.
+    return std::make_shared<Impl>(std::move(trackFinder));
+  };
 
-  // build the track finder functions. owns the track finder object.
-  return std::make_shared<CKFTrackingFunctionImpl>(std::move(trackFinder));
+  // Every stepper instantiates the whole CKF, so only the steppers usable for track finding
+  // in the solenoid field are built: the straight line stepper ignores the field, and the
+  // atlas stepper gives no advantage over the others.
+  switch (stepperType) {
+  case StepperType::eigen:
+    return makeImpl(Acts::EigenStepper<>(std::move(magneticField)));
+  case StepperType::sympy:
+    return makeImpl(Acts::SympyStepper(std::move(magneticField)));
+  default:
+    throw std::invalid_argument("CKFTracking supports the eigen and sympy steppers only");
+  }
 }
 
 } // namespace eicrecon
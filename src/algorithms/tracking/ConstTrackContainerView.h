@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <Acts/EventData/VectorMultiTrajectory.hpp>
+#include <Acts/EventData/VectorTrackContainer.hpp>
+#include <ActsExamples/EventData/Track.hpp>
+#include <memory>
+
+namespace eicrecon {
+
+/**
+ * Non-owning ActsExamples::ConstTrackContainer over the track and track state containers
+ * of a factory output. The containers stay owned by their factory, which keeps them alive
+ * for the rest of the event, so the view must not outlive the process() call it is made in.
+ * The Const backends have no mutating interface, so sharing them this way is read-only
+ * even though the holder type is a shared_ptr to non-const.
+ */
+inline ActsExamples::ConstTrackContainer
+makeConstTrackContainerView(const Acts::ConstVectorTrackContainer& tracks,
+                            const Acts::ConstVectorMultiTrajectory& track_states) {
+  auto no_delete = [](const auto*) {};
+  return ActsExamples::ConstTrackContainer(
+      std::shared_ptr<Acts::ConstVectorTrackContainer>(
+          const_cast<Acts::ConstVectorTrackContainer*>(&tracks), no_delete),
+      std::shared_ptr<Acts::ConstVectorMultiTrajectory>(
+          const_cast<Acts::ConstVectorMultiTrajectory*>(&track_states), no_delete));
+}
+
+} // namespace eicrecon
@@ -12,7 +12,6 @@
 #include <Acts/EventData/TrackParameters.hpp>
 #endif
 #include <Acts/EventData/TrackProxy.hpp>
-#include <Acts/Propagator/EigenStepper.hpp>
 #include <Acts/Propagator/Propagator.hpp>
 #include <Acts/Propagator/VoidNavigator.hpp>
 #include <Acts/Surfaces/Surface.hpp>
@@ -40,70 +39,79 @@
 #include <podio/RelationRange.h>
 #include <spdlog/common.h>
 #include <cmath>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "ActsGeometryProvider.h"
+#include "ActsStepper.h"
+#include "ConstTrackContainerView.h"
+#include "ParticleTrackLocIndex.h"
 #include "algorithms/tracking/IterativeVertexFinderConfig.h"
 #include "extensions/spdlog/SpdlogToActs.h"
 
-void eicrecon::IterativeVertexFinder::process(const Input& input, const Output& output) const {
-  const auto [trackStates, tracks, reconParticles] = input;
-  auto [outputVertices]                            = output;
-
-  // Construct ConstTrackContainer from underlying containers
-  auto trackStateContainer = std::make_shared<Acts::ConstVectorMultiTrajectory>(*trackStates);
-  auto trackContainer      = std::make_shared<Acts::ConstVectorTrackContainer>(*tracks);
-  ActsExamples::ConstTrackContainer constTracks(trackContainer, trackStateContainer);
-
-  using Propagator           = Acts::Propagator<Acts::EigenStepper<>>;
+void eicrecon::IterativeVertexFinder::init() {
   using Linearizer           = Acts::HelicalTrackLinearizer;
   using VertexFitter         = Acts::FullBilloirVertexFitter;
   using ImpactPointEstimator = Acts::ImpactPointEstimator;
   using VertexSeeder         = Acts::ZScanVertexFinder;
   using VertexFinder         = Acts::IterativeVertexFinder;
-  using VertexFinderOptions  = Acts::VertexingOptions;
 
   // Convert algorithm log level to Acts log level
   const auto spdlog_level = static_cast<spdlog::level::level_enum>(this->level());
   const auto acts_level   = eicrecon::SpdlogToActsLevel(spdlog_level);
-  ACTS_LOCAL_LOGGER(Acts::getDefaultLogger("IVF", acts_level));
-
-  Acts::EigenStepper<> stepper(m_BField);
+  m_acts_logger           = Acts::getDefaultLogger("IVF", acts_level);
 
   // Set up propagator with void navigator
-  auto propagator = std::make_shared<Propagator>(stepper, Acts::VoidNavigator{},
-                                                 logger().cloneWithSuffix("Prop"));
+  m_propagator = withStepper(
+      m_cfg.stepper, m_BField,
+      [&](auto stepper) -> std::shared_ptr<const Acts::BasePropagator> {
+        return std::make_shared<Acts::Propagator<decltype(stepper)>>(
+            std::move(stepper), Acts::VoidNavigator{}, m_acts_logger->cloneWithSuffix("Prop"));
+      });
 
   // Setup the track linearizer
   Linearizer::Config linearizerCfg;
   linearizerCfg.bField     = m_BField;
-  linearizerCfg.propagator = propagator;
-  Linearizer linearizer(linearizerCfg, logger().cloneWithSuffix("HelLin"));
+  linearizerCfg.propagator = m_propagator;
+  m_linearizer =
+      std::make_unique<const Linearizer>(linearizerCfg, m_acts_logger->cloneWithSuffix("HelLin"));
 
   // Setup the vertex fitter
   VertexFitter::Config vertexFitterCfg;
   vertexFitterCfg.extractParameters.connect<&Acts::InputTrack::extractParameters>();
-  vertexFitterCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(&linearizer);
+  vertexFitterCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(m_linearizer.get());
   VertexFitter vertexFitter(vertexFitterCfg);
 
-  // Setup the seed finder
-  ImpactPointEstimator::Config ipEstCfg(m_BField, propagator);
-  ImpactPointEstimator ipEst(ipEstCfg);
-  VertexSeeder::Config seederCfg(ipEst);
+  // Setup the seed finder, which keeps a reference to the impact point estimator
+  ImpactPointEstimator::Config ipEstCfg(m_BField, m_propagator);
+  m_ipEstimator = std::make_unique<const ImpactPointEstimator>(ipEstCfg);
+  VertexSeeder::Config seederCfg(*m_ipEstimator);
   seederCfg.extractParameters.connect<&Acts::InputTrack::extractParameters>();
   auto seeder = std::make_shared<VertexSeeder>(seederCfg);
 
-  // Set up the actual vertex finder
-  VertexFinder::Config finderCfg(std::move(vertexFitter), std::move(seeder), std::move(ipEst));
+  // Set up the actual vertex finder, with its own impact point estimator
+  VertexFinder::Config finderCfg(std::move(vertexFitter), std::move(seeder),
+                                 ImpactPointEstimator(ipEstCfg));
   finderCfg.maxVertices                 = m_cfg.maxVertices;
   finderCfg.reassignTracksAfterFirstFit = m_cfg.reassignTracksAfterFirstFit;
   finderCfg.extractParameters.connect<&Acts::InputTrack::extractParameters>();
-  finderCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(&linearizer);
+  finderCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(m_linearizer.get());
   finderCfg.field = m_BField;
-  VertexFinder finder(std::move(finderCfg));
+  m_vertexFinder  = std::make_unique<const VertexFinder>(std::move(finderCfg));
+}
+
+void eicrecon::IterativeVertexFinder::process(const Input& input, const Output& output) const {
+  const auto [trackStates, tracks, reconParticles] = input;
+  auto [outputVertices]                            = output;
+
+  // View the underlying containers as a ConstTrackContainer, without copying them
+  auto constTracks = makeConstTrackContainerView(*tracks, *trackStates);
+
+  using VertexFinder        = Acts::IterativeVertexFinder;
+  using VertexFinderOptions = Acts::VertexingOptions;
 
   // Get run-scoped contexts from service
   const auto& gctx = m_geoSvc->getActsGeometryContext();
@@ -136,11 +144,14 @@ void eicrecon::IterativeVertexFinder::process(const Input& input, const Output&
   }
 
   std::vector<Acts::Vertex> vertices;
-  auto result = finder.find(inputTracks, finderOpts, state);
+  auto result = m_vertexFinder->find(inputTracks, finderOpts, state);
   if (result.ok()) {
     vertices = std::move(result.value());
   }
 
+  // Index reconstructed particles by track local position once per event
+  const ParticleTrackLocIndex particleIndex(*reconParticles);
+
   for (const auto& vtx : vertices) {
     edm4eic::Cov4f cov(vtx.fullCovariance()(0, 0), vtx.fullCovariance()(1, 1),
                        vtx.fullCovariance()(2, 2), vtx.fullCovariance()(3, 3),
@@ -167,24 +178,14 @@ void eicrecon::IterativeVertexFinder::process(const Input& input, const Output&
       float loc_a = par.localPosition().x();
       float loc_b = par.localPosition().y();
 
-      for (const auto& part : *reconParticles) {
-        const auto& tracks = part.getTracks();
-        for (const auto& trk : tracks) {
-          const auto& traj    = trk.getTrajectory();
-          const auto& trkPars = traj.getTrackParameters();
-          for (const auto& par : trkPars) {
-            const double EPSILON = 1.0e-4; // mm
-            if (std::abs((par.getLoc().a / edm4eic::unit::mm) - (loc_a / Acts::UnitConstants::mm)) <
-                    EPSILON &&
-                std::abs((par.getLoc().b / edm4eic::unit::mm) - (loc_b / Acts::UnitConstants::mm)) <
-                    EPSILON) {
-              trace("From ReconParticles, track local position [Loc a, Loc b] = {} mm, {} mm",
-                    par.getLoc().a / edm4eic::unit::mm, par.getLoc().b / edm4eic::unit::mm);
-              eicvertex.addToAssociatedParticles(part);
-            } // endif
-          } // end for par
-        } // end for trk
-      } // end for part
+      const double EPSILON = 1.0e-4; // mm
+      particleIndex.forEachMatch(
+          loc_a / Acts::UnitConstants::mm, loc_b / Acts::UnitConstants::mm, EPSILON,
+          [&](const auto& part, double part_loc_a, double part_loc_b) {
+            trace("From ReconParticles, track local position [Loc a, Loc b] = {} mm, {} mm",
+                  part_loc_a, part_loc_b);
+            eicvertex.addToAssociatedParticles(part);
+          });
     } // end for t
     debug("One vertex found at (x,y,z) = ({}, {}, {}) mm.",
           vtx.position().x() / Acts::UnitConstants::mm,
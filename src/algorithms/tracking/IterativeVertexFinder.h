@@ -7,6 +7,11 @@
 #include <Acts/EventData/VectorMultiTrajectory.hpp>
 #include <Acts/EventData/VectorTrackContainer.hpp>
 #include <Acts/MagneticField/MagneticFieldProvider.hpp>
+#include <Acts/Propagator/Propagator.hpp>
+#include <Acts/Utilities/Logger.hpp>
+#include <Acts/Vertexing/HelicalTrackLinearizer.hpp>
+#include <Acts/Vertexing/ImpactPointEstimator.hpp>
+#include <Acts/Vertexing/IterativeVertexFinder.hpp>
 #include <algorithms/algorithm.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
 #include <edm4eic/VertexCollection.h>
@@ -36,12 +41,20 @@ public:
             {"outputVertices"},
             "Iterative vertex finder"} {}
 
-  void init() final {};
+  void init() final;
   void process(const Input&, const Output&) const final;
 
 private:
   std::shared_ptr<const ActsGeometryProvider> m_geoSvc{
       algorithms::ActsSvc::instance().acts_geometry_provider()};
   std::shared_ptr<const Acts::MagneticFieldProvider> m_BField{m_geoSvc->getFieldProvider()};
+
+  // Vertexing engine, built once in init(): the event state is passed to every call
+  std::shared_ptr<const Acts::Logger> m_acts_logger{nullptr};
+  std::shared_ptr<const Acts::BasePropagator> m_propagator;
+  std::unique_ptr<const Acts::HelicalTrackLinearizer> m_linearizer;
+  // referenced, not copied, by the z-scan vertex seeder
+  std::unique_ptr<const Acts::ImpactPointEstimator> m_ipEstimator;
+  std::unique_ptr<const Acts::IterativeVertexFinder> m_vertexFinder;
 };
 } // namespace eicrecon
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "algorithms/tracking/StepperType.h"
+
 namespace eicrecon {
 
 struct IterativeVertexFinderConfig {
   int maxVertices                  = 10;
   bool reassignTracksAfterFirstFit = true;
   unsigned int minTrackHits        = 4;
+  // Stepper of the propagation to the vertex candidates
+  StepperType stepper = StepperType::eigen;
 };
 
 } // namespace eicrecon
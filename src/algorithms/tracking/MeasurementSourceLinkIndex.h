@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <Acts/Definitions/Units.hpp>
+#include <Acts/Geometry/GeometryIdentifier.hpp>
+#include <ActsExamples/EventData/GeometryContainers.hpp>
+#include <ActsExamples/EventData/IndexSourceLink.hpp>
+#include <edm4eic/Measurement2DCollection.h>
+#include <edm4eic/unit_system.h>
+#include <Eigen/Core>
+#include <cstddef>
+#include <vector>
+
+namespace eicrecon {
+
+/**
+ * Event-scoped view of a measurement collection for the Acts track finding: the
+ * geometry-ordered IndexSourceLink multiset and the calibrated local positions and
+ * covariances, in Acts units, indexed like the collection. It is built once per
+ * measurement collection and event and then shared, read-only, by all CKF passes over
+ * that collection.
+ */
+class MeasurementSourceLinkIndex {
+public:
+  using Local      = Eigen::Vector2d;
+  using Covariance = Eigen::Matrix2d;
+
+  explicit MeasurementSourceLinkIndex(const edm4eic::Measurement2DCollection& meas2Ds) {
+    constexpr auto mm  = Acts::UnitConstants::mm / edm4eic::unit::mm;
+    constexpr auto mm2 = mm * mm;
+
+    m_locals.reserve(meas2Ds.size());
+    m_covariances.reserve(meas2Ds.size());
+    for (std::size_t index = 0; index < meas2Ds.size(); ++index) {
+      const auto meas2D = meas2Ds[index];
+      m_orderedSourceLinks.emplace(Acts::GeometryIdentifier{meas2D.getSurface()}, index);
+
+      m_locals.emplace_back(meas2D.getLoc().a * mm, meas2D.getLoc().b * mm);
+      const auto& cov = meas2D.getCovariance();
+      Covariance covariance;
+      covariance << cov.xx * mm2, cov.xy * mm2, cov.xy * mm2, cov.yy * mm2;
+      m_covariances.push_back(covariance);
+    }
+  }
+
+  std::size_t size() const { return m_locals.size(); }
+
+  const ActsExamples::GeometryIdMultiset<ActsExamples::IndexSourceLink>&
+  orderedSourceLinks() const {
+    return m_orderedSourceLinks;
+  }
+
+  /// Local position (loc0, loc1) of measurement `index`
+  const Local& local(std::size_t index) const { return m_locals[index]; }
+  /// Covariance of the local position of measurement `index`
+  const Covariance& covariance(std::size_t index) const { return m_covariances[index]; }
+
+private:
+  ActsExamples::GeometryIdMultiset<ActsExamples::IndexSourceLink> m_orderedSourceLinks;
+  std::vector<Local> m_locals;
+  std::vector<Covariance> m_covariances;
+};
+
+} // namespace eicrecon
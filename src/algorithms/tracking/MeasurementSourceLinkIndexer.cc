@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include "MeasurementSourceLinkIndexer.h"
+
+#include <tuple>
+
+namespace eicrecon {
+
+void MeasurementSourceLinkIndexer::process(const Input& input, const Output& output) const {
+  const auto [meas2Ds] = input;
+  auto [index]         = output;
+
+  *index = new MeasurementSourceLinkIndex(*meas2Ds);
+  debug("Indexed {} measurements", (*index)->size());
+}
+
+} // namespace eicrecon
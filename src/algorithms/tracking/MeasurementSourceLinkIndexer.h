@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <algorithms/algorithm.h>
+#include <edm4eic/Measurement2DCollection.h>
+#include <string>
+#include <string_view>
+
+#include "MeasurementSourceLinkIndex.h"
+#include "algorithms/interfaces/WithPodConfig.h"
+
+namespace eicrecon {
+
+using MeasurementSourceLinkIndexerAlgorithm =
+    algorithms::Algorithm<algorithms::Input<edm4eic::Measurement2DCollection>,
+                          algorithms::Output<MeasurementSourceLinkIndex*>>;
+
+/// Builds the source link index of a measurement collection, shared by the CKF passes
+class MeasurementSourceLinkIndexer : public MeasurementSourceLinkIndexerAlgorithm,
+                                     public WithPodConfig<NoConfig> {
+public:
+  MeasurementSourceLinkIndexer(std::string_view name)
+      : MeasurementSourceLinkIndexerAlgorithm{name,
+                                              {"inputMeasurements"},
+                                              {"outputSourceLinkIndex"},
+                                              "Index and calibrate measurements for Acts"} {}
+
+  void init() final {};
+  void process(const Input&, const Output&) const final;
+};
+
+} // namespace eicrecon
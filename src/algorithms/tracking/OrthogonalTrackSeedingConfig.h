@@ -48,6 +48,16 @@ struct OrthogonalTrackSeedingConfig {
 
   float deltaPhiMax = 0.085; // Max difference in phi between middle and either top or bottom sp
 
+  //////////////////////////////////////////////////////////////////////////
+  /// PHI SECTORS
+  /// With more than one sector, the space points are split into phi sectors which overlap by
+  /// deltaPhiMax on each side, seeds are searched for in all sectors in parallel (by the event
+  /// thread and numThreads - 1 workers shared by all event threads), and each sector keeps the
+  /// seeds of the middle space points it owns.
+  /// The seeds are the same as without sectors.
+  std::size_t numPhiSectors = 1;
+  std::size_t numThreads    = 1;
+
   //////////////////////////////////////////////////////////////////////////
   /// SEED FILTER GENERAL PARAMETERS
   /// The parameters below control the process of filtering out seeds before
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <edm4eic/Track.h>
+#include <edm4eic/TrackParameters.h>
+#include <edm4eic/Trajectory.h>
+#include <edm4eic/unit_system.h>
+#include <edm4hep/Vector2f.h>
+#include <podio/RelationRange.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace eicrecon {
+
+/**
+ * Index of reconstructed particles by the local (perigee) position of
+ * the track parameters of their tracks, sorted by the first local
+ * coordinate. It replaces a scan over all particles, tracks and track
+ * parameters for every vertex track with a binary search.
+ */
+class ParticleTrackLocIndex {
+public:
+  explicit ParticleTrackLocIndex(const edm4eic::ReconstructedParticleCollection& particles) {
+    std::size_t order = 0;
+    for (const auto& part : particles) {
+      for (const auto& trk : part.getTracks()) {
+        for (const auto& par : trk.getTrajectory().getTrackParameters()) {
+          m_entries.push_back({par.getLoc().a / edm4eic::unit::mm,
+                               par.getLoc().b / edm4eic::unit::mm, order++, part});
+        }
+      }
+    }
+    std::ranges::sort(m_entries, {}, &Entry::loc_a);
+  }
+
+  /// Calls `fn(particle, loc_a, loc_b)` for every track parameter within
+  /// `epsilon` [mm] of (`loc_a`, `loc_b`) [mm], in the order of the
+  /// particle collection (a particle is reported once per matching parameter)
+  template <typename Fn>
+  void forEachMatch(double loc_a, double loc_b, double epsilon, Fn&& fn) const {
+    auto first = std::ranges::lower_bound(m_entries, loc_a - 2 * epsilon, {}, &Entry::loc_a);
+    auto last  = std::ranges::upper_bound(m_entries, loc_a + 2 * epsilon, {}, &Entry::loc_a);
+    std::vector<const Entry*> matches;
+    for (auto it = first; it != last; ++it) {
+      if (std::abs(it->loc_a - loc_a) < epsilon && std::abs(it->loc_b - loc_b) < epsilon) {
+        matches.push_back(&*it);
+      }
+    }
+    std::ranges::sort(matches, {}, &Entry::order);
+    for (const auto* entry : matches) {
+      fn(entry->particle, entry->loc_a, entry->loc_b);
+    }
+  }
+
+private:
+  struct Entry {
+    double loc_a;
+    double loc_b;
+    std::size_t order;
+    edm4eic::ReconstructedParticle particle;
+  };
+  std::vector<Entry> m_entries;
+};
+
+} // namespace eicrecon
@@ -13,7 +13,6 @@
 #include <Acts/EventData/TrackProxy.hpp>
 #include <Acts/EventData/VectorMultiTrajectory.hpp>
 #include <Acts/EventData/VectorTrackContainer.hpp>
-#include <Acts/Propagator/EigenStepper.hpp>
 #include <Acts/Propagator/Propagator.hpp>
 #include <Acts/Propagator/VoidNavigator.hpp>
 #include <Acts/Surfaces/Surface.hpp>
@@ -48,6 +47,8 @@
 #include <utility>
 
 #include "ActsGeometryProvider.h"
+#include "ActsStepper.h"
+#include "ConstTrackContainerView.h"
 #include "SecondaryVertexFinderConfig.h"
 #include "extensions/spdlog/SpdlogToActs.h"
 
@@ -63,8 +64,8 @@ using SeedFinder           = Acts::AdaptiveGridDensityVertexFinder;
 
 void SecondaryVertexFinder::storeVertices(
     const std::vector<Acts::Vertex>& vertices,
-    const edm4eic::ReconstructedParticleCollection& reconParticles,
-    edm4eic::VertexCollection& outputVertices, int vertexType) const {
+    const ParticleTrackLocIndex& particleIndex, edm4eic::VertexCollection& outputVertices,
+    int vertexType) const {
   for (const auto& vtx : vertices) {
     edm4eic::Cov4f cov(vtx.fullCovariance()(0, 0), vtx.fullCovariance()(1, 1),
                        vtx.fullCovariance()(2, 2), vtx.fullCovariance()(3, 3),
@@ -91,24 +92,14 @@ void SecondaryVertexFinder::storeVertices(
       float loc_a = par.localPosition().x();
       float loc_b = par.localPosition().y();
 
-      for (const auto& part : reconParticles) {
-        const auto& tracks = part.getTracks();
-        for (const auto& trk : tracks) {
-          const auto& traj    = trk.getTrajectory();
-          const auto& trkPars = traj.getTrackParameters();
-          for (const auto& trkPar : trkPars) {
-            double EPSILON = std::numeric_limits<double>::epsilon();
-            if (std::abs((trkPar.getLoc().a / edm4eic::unit::mm) -
-                         (loc_a / Acts::UnitConstants::mm)) < EPSILON &&
-                std::abs((trkPar.getLoc().b / edm4eic::unit::mm) -
-                         (loc_b / Acts::UnitConstants::mm)) < EPSILON) {
-              trace("From ReconParticles, track local position [Loc a, Loc b] = {} mm, {} mm",
-                    trkPar.getLoc().a / edm4eic::unit::mm, trkPar.getLoc().b / edm4eic::unit::mm);
-              eicvertex.addToAssociatedParticles(part);
-            }
-          }
-        }
-      }
+      double EPSILON = std::numeric_limits<double>::epsilon();
+      particleIndex.forEachMatch(
+          loc_a / Acts::UnitConstants::mm, loc_b / Acts::UnitConstants::mm, EPSILON,
+          [&](const auto& part, double part_loc_a, double part_loc_b) {
+            trace("From ReconParticles, track local position [Loc a, Loc b] = {} mm, {} mm",
+                  part_loc_a, part_loc_b);
+            eicvertex.addToAssociatedParticles(part);
+          });
     }
     debug("One AMVF vertex found at (x,y,z) = ({}, {}, {}) mm.",
           vtx.position().x() / Acts::UnitConstants::mm,
@@ -117,43 +108,31 @@ void SecondaryVertexFinder::storeVertices(
   }
 }
 
-void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
-                                    const SecondaryVertexFinder::Output& output) const {
-  auto [recotracks, trackStates, tracks] = input;
-  auto [outputVertices]                  = output;
-
-  if (tracks->size_impl() == 0) {
-    debug("No tracks in the container - skipping");
-    return;
-  }
-
+void SecondaryVertexFinder::init() {
   // Convert algorithm log level to Acts log level
   const auto spdlog_level = static_cast<spdlog::level::level_enum>(this->level());
   const auto acts_level   = eicrecon::SpdlogToActsLevel(spdlog_level);
-  ACTS_LOCAL_LOGGER(Acts::getDefaultLogger("AMVF", acts_level));
-
-  // Geometry and field contexts
-  const auto& gctx = m_geoSvc->getActsGeometryContext();
-  const auto& mctx = m_geoSvc->getActsMagneticFieldContext();
-
-  Acts::EigenStepper<> stepper(m_BField);
+  m_acts_logger           = Acts::getDefaultLogger("AMVF", acts_level);
 
   // Set up propagator with void navigator
-  using Propagator = Acts::Propagator<Acts::EigenStepper<>>;
-  auto propagator  = std::make_shared<Propagator>(stepper, Acts::VoidNavigator{},
-                                                  logger().cloneWithSuffix("Prop"));
+  m_propagator = withStepper(
+      m_cfg.stepper, m_BField,
+      [&](auto stepper) -> std::shared_ptr<const Acts::BasePropagator> {
+        return std::make_shared<Acts::Propagator<decltype(stepper)>>(
+            std::move(stepper), Acts::VoidNavigator{}, m_acts_logger->cloneWithSuffix("Prop"));
+      });
 
   // Set up track density used during vertex seeding
   Acts::AdaptiveGridTrackDensity::Config trkDensityConfig;
   trkDensityConfig.spatialBinExtent  = m_cfg.spatialBinExtent;
   trkDensityConfig.temporalBinExtent = m_cfg.temporalBinExtent;
   trkDensityConfig.useTime           = m_cfg.useTime;
-  Acts::AdaptiveGridTrackDensity trkDensity(trkDensityConfig);
+  m_trackDensity = std::make_unique<const Acts::AdaptiveGridTrackDensity>(trkDensityConfig);
 
   // Setup the track linearizer
-  Linearizer::Config linearizerConfig(m_BField, propagator);
-  std::unique_ptr<const Acts::Logger> linearizer_log = logger().cloneWithSuffix("Linearizer");
-  Linearizer linearizer(linearizerConfig, std::move(linearizer_log));
+  Linearizer::Config linearizerConfig(m_BField, m_propagator);
+  m_linearizer = std::make_unique<const Linearizer>(
+      linearizerConfig, m_acts_logger->cloneWithSuffix("Linearizer"));
 
   // Set up deterministic annealing with user-defined temperatures
   Acts::AnnealingUtility::Config annealingConfig;
@@ -161,9 +140,9 @@ void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
   Acts::AnnealingUtility annealingUtility(annealingConfig);
 
   // Setup the vertex fitter
-  ImpactPointEstimator::Config ipEstConfig(m_BField, propagator);
-  ImpactPointEstimator ipEst(ipEstConfig);
-  VertexFitter::Config vertexFitterConfig(ipEst);
+  ImpactPointEstimator::Config ipEstConfig(m_BField, m_propagator);
+  m_ipEstimator = std::make_unique<const ImpactPointEstimator>(ipEstConfig);
+  VertexFitter::Config vertexFitterConfig(*m_ipEstimator);
 
   vertexFitterConfig.annealingTool     = annealingUtility;
   vertexFitterConfig.minWeight         = m_cfg.minWeight;
@@ -171,16 +150,16 @@ void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
   vertexFitterConfig.doSmoothing       = m_cfg.doSmoothing;
   vertexFitterConfig.useTime           = m_cfg.useTime;
   vertexFitterConfig.extractParameters.connect<&Acts::InputTrack::extractParameters>();
-  vertexFitterConfig.trackLinearizer.connect<&Linearizer::linearizeTrack>(&linearizer);
+  vertexFitterConfig.trackLinearizer.connect<&Linearizer::linearizeTrack>(m_linearizer.get());
   VertexFitter vertexFitter(std::move(vertexFitterConfig));
 
   // Set up vertex seeder and finder
-  SeedFinder::Config seederConfig(trkDensity);
+  SeedFinder::Config seederConfig(*m_trackDensity);
   seederConfig.extractParameters.connect<&Acts::InputTrack::extractParameters>();
   auto seeder = std::make_shared<SeedFinder>(SeedFinder::Config{seederConfig});
 
   VertexFinder::Config vertexfinderConfig(std::move(vertexFitter), std::move(seeder),
-                                          std::move(ipEst), m_BField);
+                                          ImpactPointEstimator(ipEstConfig), m_BField);
 
   vertexfinderConfig.initialVariances           = m_cfg.initialVariances;
   vertexfinderConfig.useTime                    = m_cfg.useTime;
@@ -201,10 +180,25 @@ void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
   vertexfinderConfig.extractParameters.connect<&Acts::InputTrack::extractParameters>();
   vertexfinderConfig.bField = m_BField;
 
-  // Build the ACTS track container
-  auto trackStateContainer = std::make_shared<Acts::ConstVectorMultiTrajectory>(*trackStates);
-  auto trackContainer      = std::make_shared<Acts::ConstVectorTrackContainer>(*tracks);
-  ActsExamples::ConstTrackContainer constTracks(trackContainer, trackStateContainer);
+  m_vertexFinder = std::make_unique<const VertexFinder>(std::move(vertexfinderConfig));
+}
+
+void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
+                                    const SecondaryVertexFinder::Output& output) const {
+  auto [recotracks, trackStates, tracks] = input;
+  auto [outputVertices]                  = output;
+
+  if (tracks->size_impl() == 0) {
+    debug("No tracks in the container - skipping");
+    return;
+  }
+
+  // Geometry and field contexts
+  const auto& gctx = m_geoSvc->getActsGeometryContext();
+  const auto& mctx = m_geoSvc->getActsMagneticFieldContext();
+
+  // View the ACTS track container, without copying it
+  auto constTracks = makeConstTrackContainerView(*tracks, *trackStates);
 
   // Build BoundTrackParameters for all tracks upfront
   std::vector<Acts::BoundTrackParameters> allTrackParameters;
@@ -217,13 +211,15 @@ void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
           track.parameters()[Acts::eBoundLoc1] / Acts::UnitConstants::mm);
   }
 
+  // Index reconstructed particles by track local position once per event
+  const ParticleTrackLocIndex particleIndex(*recotracks);
+
   // Vertex type: 1 for primary, 0 for secondary
   const int vertexType = m_cfg.isPrimary ? 1 : 0;
 
   if (m_cfg.isPrimary) {
     // Primary vertex mode: run AMVF on all tracks at once
-    VertexFinder finder(std::move(vertexfinderConfig));
-    auto state = finder.makeState(mctx);
+    auto state = m_vertexFinder->makeState(mctx);
     VertexFinderOptions vfOptions(gctx, mctx);
 
     std::vector<Acts::InputTrack> inputTracks;
@@ -232,16 +228,15 @@ void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
     }
 
     std::vector<Acts::Vertex> vertices;
-    auto result = finder.find(inputTracks, vfOptions, state);
+    auto result = m_vertexFinder->find(inputTracks, vfOptions, state);
     if (result.ok()) {
       vertices = std::move(result.value());
     }
 
-    storeVertices(vertices, *recotracks, *outputVertices, vertexType);
+    storeVertices(vertices, particleIndex, *outputVertices, vertexType);
   } else {
     // Secondary vertex mode: run AMVF on all pairwise track combinations
-    VertexFinder finder(std::move(vertexfinderConfig));
-    auto state = finder.makeState(mctx);
+    auto state = m_vertexFinder->makeState(mctx);
     VertexFinderOptions vfOptions(gctx, mctx);
 
     std::vector<Acts::InputTrack> inputTracks;
@@ -251,12 +246,12 @@ void SecondaryVertexFinder::process(const SecondaryVertexFinder::Input& input,
         inputTracks.emplace_back(&allTrackParameters[j]);
 
         std::vector<Acts::Vertex> verticesSec;
-        auto resultSec = finder.find(inputTracks, vfOptions, state);
+        auto resultSec = m_vertexFinder->find(inputTracks, vfOptions, state);
         if (resultSec.ok()) {
           verticesSec = std::move(resultSec.value());
         }
 
-        storeVertices(verticesSec, *recotracks, *outputVertices, vertexType);
+        storeVertices(verticesSec, particleIndex, *outputVertices, vertexType);
 
         inputTracks.clear();
       }
@@ -6,6 +6,12 @@
 #include <Acts/EventData/VectorMultiTrajectory.hpp>
 #include <Acts/EventData/VectorTrackContainer.hpp>
 #include <Acts/MagneticField/MagneticFieldProvider.hpp>
+#include <Acts/Propagator/Propagator.hpp>
+#include <Acts/Utilities/Logger.hpp>
+#include <Acts/Vertexing/AdaptiveGridTrackDensity.hpp>
+#include <Acts/Vertexing/AdaptiveMultiVertexFinder.hpp>
+#include <Acts/Vertexing/HelicalTrackLinearizer.hpp>
+#include <Acts/Vertexing/ImpactPointEstimator.hpp>
 #include <Acts/Vertexing/Vertex.hpp>
 #include <algorithms/algorithm.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
@@ -18,6 +24,7 @@
 #include "algorithms/interfaces/ActsSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 #include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/ParticleTrackLocIndex.h"
 #include "algorithms/tracking/SecondaryVertexFinderConfig.h"
 
 namespace eicrecon {
@@ -37,19 +44,28 @@ public:
             {"outputVertices"},
             "Finds vertices using ACTS Adaptive Multi-Vertex Finder (AMVF)"} {}
 
-  void init() final {};
+  void init() final;
 
   void process(const Input&, const Output&) const final;
 
 private:
   /// Store found ACTS vertices into the EDM4eic vertex collection.
   void storeVertices(const std::vector<Acts::Vertex>& vertices,
-                     const edm4eic::ReconstructedParticleCollection& reconParticles,
+                     const ParticleTrackLocIndex& particleIndex,
                      edm4eic::VertexCollection& outputVertices, int vertexType) const;
 
   std::shared_ptr<const ActsGeometryProvider> m_geoSvc{
       algorithms::ActsSvc::instance().acts_geometry_provider()};
   std::shared_ptr<const Acts::MagneticFieldProvider> m_BField{m_geoSvc->getFieldProvider()};
+
+  // Vertexing engine, built once in init(): the event state is passed to every call
+  std::shared_ptr<const Acts::Logger> m_acts_logger{nullptr};
+  std::shared_ptr<const Acts::BasePropagator> m_propagator;
+  std::unique_ptr<const Acts::HelicalTrackLinearizer> m_linearizer;
+  // given by reference to the fitter and seeder configurations
+  std::unique_ptr<const Acts::ImpactPointEstimator> m_ipEstimator;
+  std::unique_ptr<const Acts::AdaptiveGridTrackDensity> m_trackDensity;
+  std::unique_ptr<const Acts::AdaptiveMultiVertexFinder> m_vertexFinder;
 };
 
 } // namespace eicrecon
@@ -5,6 +5,8 @@
 
 #include <Acts/Definitions/Units.hpp>
 
+#include "algorithms/tracking/StepperType.h"
+
 using namespace Acts::UnitLiterals;
 
 namespace eicrecon {
@@ -41,6 +43,8 @@ struct SecondaryVertexFinderConfig {
   bool useTime                     = false;
   // Use seed vertex as a constraint for the fit
   bool useSeedConstraint = false;
+  // Stepper of the propagation to the vertex candidates
+  StepperType stepper = StepperType::eigen;
 };
 
 } // namespace eicrecon
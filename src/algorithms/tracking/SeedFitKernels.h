@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+//
+// Batched circle and line fits of three-hit track seeds
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace eicrecon::seed_fit {
+
+/*! Fits of all seeds of an event at once, on structure-of-arrays inputs and
+ *  outputs. Seeds are processed in blocks of `block_size`, with every
+ *  step written as a loop over the seeds of the block without early exit,
+ *  so that the compiler can vectorize it. The iterative root finding of
+ *  the circle fit keeps running on a block until all of its seeds have
+ *  converged, freezing the converged ones. Each seed goes through the
+ *  same floating point operations as in the scalar fits of TrackSeeding
+ *  these kernels replace.
+ */
+inline constexpr std::size_t block_size = 16;
+
+/// Hit positions of three-hit seeds: hit `j` of seed `i` is at (x[j][i], y[j][i], z[j][i]),
+/// at transverse radius r[j][i] as given by the space point
+struct Triplets {
+  std::array<std::vector<float>, 3> x;
+  std::array<std::vector<float>, 3> y;
+  std::array<std::vector<float>, 3> z;
+  std::array<std::vector<float>, 3> r;
+
+  std::size_t size() const { return x[0].size(); }
+
+  void clear() {
+    for (std::size_t j = 0; j < 3; ++j) {
+      x[j].clear();
+      y[j].clear();
+      z[j].clear();
+      r[j].clear();
+    }
+  }
+
+  void reserve(std::size_t n) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      x[j].reserve(n);
+      y[j].reserve(n);
+      z[j].reserve(n);
+      r[j].reserve(n);
+    }
+  }
+
+  /// Append a seed, with its hits given as {x, y, z, r}
+  void push_back(const std::array<std::array<float, 4>, 3>& hits) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      x[j].push_back(hits[j][0]);
+      y[j].push_back(hits[j][1]);
+      z[j].push_back(hits[j][2]);
+      r[j].push_back(hits[j][3]);
+    }
+  }
+};
+
+/// Circles in the transverse plane: radius and center
+struct Circles {
+  std::vector<float> R;
+  std::vector<float> X0;
+  std::vector<float> Y0;
+};
+
+/// Lines in the r-z plane: z = slope * r + intercept
+struct Lines {
+  std::vector<float> slope;
+  std::vector<float> intercept;
+};
+
+/**
+ * Circle fit to the transverse hit positions of each seed.
+ * This is an algebraic fit, due to Taubin, based on the journal article
+ * G. Taubin, "Estimation Of Planar Curves, Surfaces And Nonplanar
+ * Space Curves Defined By Implicit Equations, With
+ * Applications To Edge And Range Image Segmentation",
+ * IEEE Trans. PAMI, Vol. 13, pages 1115-1138, (1991)
+ * It works well whether data points are sampled along an entire circle or along a small arc.
+ * It still has a small bias and its statistical accuracy is slightly lower than that of the
+ * geometric fit (minimizing geometric distances),
+ * It provides a very good initial guess for a subsequent geometric fit.
+ * Nikolai Chernov  (September 2012)
+ */
+inline void circle_fit(const Triplets& seeds, Circles& circles) {
+  const std::size_t n = seeds.size();
+  circles.R.resize(n);
+  circles.X0.resize(n);
+  circles.Y0.resize(n);
+
+  for (std::size_t begin = 0; begin < n; begin += block_size) {
+    const std::size_t m = std::min(block_size, n - begin);
+
+    std::array<double, block_size> meanX{};
+    std::array<double, block_size> meanY{};
+    std::array<double, block_size> Mxx{};
+    std::array<double, block_size> Myy{};
+    std::array<double, block_size> Mxy{};
+    std::array<double, block_size> Mxz{};
+    std::array<double, block_size> Myz{};
+    std::array<double, block_size> Mz{};
+    std::array<double, block_size> Cov_xy{};
+    std::array<double, block_size> A0{};
+    std::array<double, block_size> A1{};
+    std::array<double, block_size> A2{};
+    std::array<double, block_size> A3{};
+
+    // sample means and moments, then coefficients of the characteristic polynomial
+    for (std::size_t i = 0; i < m; ++i) {
+      double sumX = 0;
+      double sumY = 0;
+      for (std::size_t j = 0; j < 3; ++j) {
+        sumX += seeds.x[j][begin + i];
+        sumY += seeds.y[j][begin + i];
+      }
+      meanX[i] = sumX / 3.;
+      meanY[i] = sumY / 3.;
+
+      double mxx = 0;
+      double myy = 0;
+      double mxy = 0;
+      double mxz = 0;
+      double myz = 0;
+      double mzz = 0;
+      for (std::size_t j = 0; j < 3; ++j) {
+        const double Xi = seeds.x[j][begin + i] - meanX[i]; //  centered x-coordinates
+        const double Yi = seeds.y[j][begin + i] - meanY[i]; //  centered y-coordinates
+        const double Zi = Xi * Xi + Yi * Yi;
+        mxy += Xi * Yi;
+        mxx += Xi * Xi;
+        myy += Yi * Yi;
+        mxz += Xi * Zi;
+        myz += Yi * Zi;
+        mzz += Zi * Zi;
+      }
+      Mxx[i] = mxx / 3.;
+      Myy[i] = myy / 3.;
+      Mxy[i] = mxy / 3.;
+      Mxz[i] = mxz / 3.;
+      Myz[i] = myz / 3.;
+      mzz /= 3.;
+
+      Mz[i]              = Mxx[i] + Myy[i];
+      Cov_xy[i]          = Mxx[i] * Myy[i] - Mxy[i] * Mxy[i];
+      const double Var_z = mzz - Mz[i] * Mz[i];
+      A3[i]              = 4 * Mz[i];
+      A2[i]              = -3 * Mz[i] * Mz[i] - mzz;
+
+      A1[i] = Var_z * Mz[i] + 4 * Cov_xy[i] * Mz[i] - Mxz[i] * Mxz[i] - Myz[i] * Myz[i];
+      A0[i] = Mxz[i] * (Mxz[i] * Myy[i] - Myz[i] * Mxy[i]) +
+              Myz[i] * (Myz[i] * Mxx[i] - Mxz[i] * Mxy[i]) - Var_z * Cov_xy[i];
+    }
+
+    //    finding the root of the characteristic polynomial
+    //    using Newton's method starting at x=0
+    //    (it is guaranteed to converge to the right root)
+    static constexpr int iter_max = 99;
+    std::array<double, block_size> x{};
+    std::array<double, block_size> y{};
+    std::array<bool, block_size> done{};
+    for (std::size_t i = 0; i < m; ++i) {
+      y[i] = A0[i];
+    }
+
+    // usually, 4-6 iterations are enough
+    for (int iter = 0; iter < iter_max; ++iter) {
+      bool active = false;
+      for (std::size_t i = 0; i < m; ++i) {
+        const double Dy   = A1[i] + x[i] * (2 * A2[i] + 3 * A3[i] * x[i]);
+        const double xnew = x[i] - y[i] / Dy;
+        const double ynew = A0[i] + xnew * (A1[i] + xnew * (A2[i] + xnew * A3[i]));
+        const bool stop   = done[i] || (xnew == x[i]) || !std::isfinite(xnew) ||
+                            (std::abs(ynew) >= std::abs(y[i]));
+        x[i]    = stop ? x[i] : xnew;
+        y[i]    = stop ? y[i] : ynew;
+        done[i] = stop;
+        active |= !stop;
+      }
+      if (!active) {
+        break;
+      }
+    }
+
+    //  computing parameters of the fitting circle
+    for (std::size_t i = 0; i < m; ++i) {
+      const double DET     = x[i] * x[i] - x[i] * Mz[i] + Cov_xy[i];
+      const double Xcenter = (Mxz[i] * (Myy[i] - x[i]) - Myz[i] * Mxy[i]) / DET / 2;
+      const double Ycenter = (Myz[i] * (Mxx[i] - x[i]) - Mxz[i] * Mxy[i]) / DET / 2;
+
+      circles.X0[begin + i] = static_cast<float>(Xcenter + meanX[i]);
+      circles.Y0[begin + i] = static_cast<float>(Ycenter + meanY[i]);
+      circles.R[begin + i] =
+          static_cast<float>(std::sqrt(Xcenter * Xcenter + Ycenter * Ycenter + Mz[i]));
+    }
+  }
+}
+
+/// Least squares line fit to the (r, z) hit positions of each seed, with r from the space points
+inline void line_fit(const Triplets& seeds, Lines& lines) {
+  const std::size_t n = seeds.size();
+  lines.slope.resize(n);
+  lines.intercept.resize(n);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    double xsum  = 0;
+    double x2sum = 0;
+    double ysum  = 0;
+    double xysum = 0;
+    for (std::size_t j = 0; j < 3; ++j) {
+      const double r = seeds.r[j][i];
+      const double z = seeds.z[j][i];
+      xsum += r;
+      ysum += z;
+      x2sum += r * r;
+      xysum += r * z;
+    }
+    const double denominator = x2sum * 3. - xsum * xsum;
+    lines.slope[i]           = static_cast<float>((xysum * 3. - xsum * ysum) / denominator);
+    lines.intercept[i]       = static_cast<float>((x2sum * ysum - xsum * xysum) / denominator);
+  }
+}
+
+} // namespace eicrecon::seed_fit
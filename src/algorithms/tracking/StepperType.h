@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace eicrecon {
+
+/// Acts stepper used to propagate tracks: the Runge-Kutta-Nystrom steppers `eigen`, `sympy`
+/// (generated code) and `atlas`, or `straight_line` for field-free regions
+enum class StepperType { eigen = 0, sympy = 1, atlas = 2, straight_line = 3 };
+
+inline std::istream& operator>>(std::istream& in, StepperType& stepper) {
+  std::string s;
+  in >> s;
+  // stringifying the enums causes them to be converted to integers before conversion to strings
+  if (s == "eigen" or s == "0") {
+    stepper = StepperType::eigen;
+  } else if (s == "sympy" or s == "1") {
+    stepper = StepperType::sympy;
+  } else if (s == "atlas" or s == "2") {
+    stepper = StepperType::atlas;
+  } else if (s == "straight_line" or s == "3") {
+    stepper = StepperType::straight_line;
+  } else {
+    in.setstate(std::ios::failbit); // Set the fail bit if the input is not valid
+  }
+  return in;
+}
+
+inline std::ostream& operator<<(std::ostream& out, const StepperType& stepper) {
+  switch (stepper) {
+  case StepperType::eigen:
+    out << "eigen";
+    break;
+  case StepperType::sympy:
+    out << "sympy";
+    break;
+  case StepperType::atlas:
+    out << "atlas";
+    break;
+  case StepperType::straight_line:
+    out << "straight_line";
+    break;
+  default:
+    out.setstate(std::ios::failbit);
+  }
+  return out;
+}
+
+} // namespace eicrecon
@@ -31,6 +31,7 @@
 
 #include "TrackProjector.h"
 #include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/tracking/ConstTrackContainerView.h"
 #include "extensions/spdlog/SpdlogFormatters.h" // IWYU pragma: keep
 
 template <> struct fmt::formatter<Acts::GeometryIdentifier> : fmt::ostream_formatter {};
@@ -46,10 +47,8 @@ void TrackProjector::process(const Input& input, const Output& output) const {
   const auto [track_states, tracks_container, tracks] = input;
   auto [track_segments]                               = output;
 
-  // Construct ConstTrackContainer from underlying containers
-  auto trackStateContainer = std::make_shared<Acts::ConstVectorMultiTrajectory>(*track_states);
-  auto trackContainer      = std::make_shared<Acts::ConstVectorTrackContainer>(*tracks_container);
-  ActsExamples::ConstTrackContainer acts_tracks(trackContainer, trackStateContainer);
+  // View the underlying containers as a ConstTrackContainer, without copying them
+  auto acts_tracks = makeConstTrackContainerView(*tracks_container, *track_states);
 
   debug("Track projector event process. Num of input tracks: {}", acts_tracks.size());
 
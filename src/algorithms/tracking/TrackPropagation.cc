@@ -22,6 +22,7 @@
 #include <Acts/Propagator/Navigator.hpp>
 #include <Acts/Propagator/Propagator.hpp>
 #include <Acts/Propagator/PropagatorResult.hpp>
+#include <Acts/Surfaces/BoundaryTolerance.hpp>
 #include <Acts/Surfaces/CylinderBounds.hpp>
 #include <Acts/Surfaces/CylinderSurface.hpp>
 #include <Acts/Surfaces/DiscSurface.hpp>
@@ -39,19 +40,26 @@
 #include <algorithm>
 #include <any>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/ActsStepper.h"
+#include "algorithms/tracking/ConstTrackContainerView.h"
 #include "algorithms/tracking/TrackPropagation.h"
 #include "algorithms/tracking/TrackPropagationConfig.h"
 #include "extensions/spdlog/SpdlogToActs.h"
@@ -118,6 +126,19 @@ void TrackPropagation::init() {
   m_filter_surfaces.resize(m_cfg.filter_surfaces.size());
   std::ranges::transform(m_cfg.filter_surfaces, m_filter_surfaces.begin(), _toActsSurface);
 
+  // Convert algorithm log level to Acts log level
+  const auto spdlog_level = static_cast<spdlog::level::level_enum>(this->level());
+  m_acts_logger = Acts::getDefaultLogger("PROP", eicrecon::SpdlogToActsLevel(spdlog_level));
+
+  // The propagator is event-invariant, and shared by all propagations
+  m_propagator = withStepper(m_cfg.stepper, m_geoSvc->getFieldProvider(), [&](auto stepper) {
+    return std::make_unique<const Propagator>(
+        std::in_place_type<StepperPropagator<decltype(stepper)>>, std::move(stepper),
+        Acts::Navigator({.trackingGeometry = m_geoSvc->trackingGeometry()},
+                        m_acts_logger->cloneWithSuffix("Navigator")),
+        m_acts_logger->cloneWithSuffix("Propagator"));
+  });
+
   trace("Initialized");
 }
 
@@ -129,20 +150,20 @@ void TrackPropagation::propagateToSurfaceList(const Input& input, const Output&
   trace("Propagate tracks: --------------------");
   trace("number of tracks: {}", tracks->size());
 
-  // Construct ConstTrackContainer from underlying containers
-  auto trackStateContainer = std::make_shared<Acts::ConstVectorMultiTrajectory>(*track_states);
-  auto trackContainer      = std::make_shared<Acts::ConstVectorTrackContainer>(*tracks_acts);
-  ActsExamples::ConstTrackContainer constTracks(trackContainer, trackStateContainer);
+  // View the underlying containers as a ConstTrackContainer, without copying them
+  auto constTracks = makeConstTrackContainerView(*tracks_acts, *track_states);
 
   // loop over input tracks
   std::size_t i = 0;
   for (const auto& track : constTracks) {
 
+    // all propagations of this track start from its last measurement
+    const auto initial_state = initialState(track, constTracks);
+
     // check if this track can be propagated to any filter surface
     bool track_reaches_filter_surface{false};
     for (const auto& filter_surface : m_filter_surfaces) {
-      auto point = propagate(edm4eic::Track{}, track, constTracks, filter_surface);
-      if (point) {
+      if (propagateFrom(initial_state, *filter_surface)) {
         track_reaches_filter_surface = true;
         break;
       }
@@ -166,11 +187,11 @@ void TrackPropagation::propagateToSurfaceList(const Input& input, const Output&
     decltype(edm4eic::TrackSegmentData::length) length            = 0;
     decltype(edm4eic::TrackSegmentData::lengthError) length_error = 0;
 
-    // loop over projection-target surfaces
-    for (const auto& target_surface : m_target_surfaces) {
+    // project the track to all target surfaces
+    auto points = propagateToSurfaces(initial_state, m_target_surfaces);
 
-      // project the track to this surface
-      auto point = propagate(edm4eic::Track{}, track, constTracks, target_surface);
+    // loop over projection-target surfaces
+    for (auto& point : points) {
       if (!point) {
         trace("<> Failed to propagate track to this plane");
         continue;
@@ -218,6 +239,75 @@ TrackPropagation::propagate(const edm4eic::Track& /* track */,
                             const ActsExamples::ConstTrackProxy& acts_track,
                             const ActsExamples::ConstTrackContainer& trackContainer,
                             const std::shared_ptr<const Acts::Surface>& targetSurf) const {
+  auto state = propagateFrom(initialState(acts_track, trackContainer), *targetSurf);
+  if (!state) {
+    return nullptr;
+  }
+  return makeTrackPoint(*state, *targetSurf);
+}
+
+std::vector<std::unique_ptr<edm4eic::TrackPoint>> TrackPropagation::propagateToSurfaces(
+    const PropagationState& initial,
+    const std::vector<std::shared_ptr<Acts::Surface>>& surfaces) const {
+
+  std::vector<std::unique_ptr<edm4eic::TrackPoint>> points(surfaces.size());
+
+  if (!m_cfg.single_pass_propagation) {
+    for (std::size_t i = 0; i < surfaces.size(); ++i) {
+      if (auto state = propagateFrom(initial, *surfaces[i])) {
+        points[i] = makeTrackPoint(*state, *surfaces[i]);
+      }
+    }
+    return points;
+  }
+
+  // Order the surfaces along the track by the straight line distance of their intersection
+  // from the last measurement, separately for those ahead of and behind it (as in
+  // propagateFrom), with the surfaces without intersection within their bounds last.
+  const auto& gctx         = m_geoSvc->getActsGeometryContext();
+  const auto initPosition  = initial.parameters.position(gctx);
+  const auto initDirection = initial.parameters.direction();
+  std::vector<std::pair<double, std::size_t>> forward_surfaces;
+  std::vector<std::pair<double, std::size_t>> backward_surfaces;
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    auto intersection =
+        surfaces[i]
+            ->intersect(gctx, initPosition, initDirection, Acts::BoundaryTolerance::None())
+            .closestForward();
+    if (!intersection.isValid()) {
+      forward_surfaces.emplace_back(std::numeric_limits<double>::infinity(), i);
+      continue;
+    }
+    const double distance = (intersection.position() - initPosition).dot(initDirection);
+    if (distance < 0) {
+      backward_surfaces.emplace_back(-distance, i);
+    } else {
+      forward_surfaces.emplace_back(distance, i);
+    }
+  }
+  std::ranges::sort(forward_surfaces);
+  std::ranges::sort(backward_surfaces);
+
+  // Step through the surfaces in order, each propagation continuing from the last surface
+  // reached, so that every part of the track is stepped through only once
+  for (const auto* ordered_surfaces : {&forward_surfaces, &backward_surfaces}) {
+    std::optional<PropagationState> last_state;
+    for (const auto& [distance, i] : *ordered_surfaces) {
+      auto state = propagateFrom(last_state ? *last_state : initial, *surfaces[i]);
+      if (!state) {
+        continue;
+      }
+      points[i]  = makeTrackPoint(*state, *surfaces[i]);
+      last_state = std::move(state);
+    }
+  }
+
+  return points;
+}
+
+TrackPropagation::PropagationState
+TrackPropagation::initialState(const ActsExamples::ConstTrackProxy& acts_track,
+                               const ActsExamples::ConstTrackContainer& trackContainer) const {
 
   auto tipIndex = acts_track.tipIndex();
 
@@ -231,6 +321,7 @@ TrackPropagation::propagate(const edm4eic::Track& /* track */,
 
   trace("  Num measurement in trajectory: {}", m_nMeasurements);
   trace("  Num states in trajectory     : {}", m_nStates);
+  trace("  chi2                         : {:.4f}", trajState.chi2Sum);
 
   // Get track state at last measurement surface
   // For last measurement surface, filtered and smoothed results are equivalent
@@ -239,41 +330,31 @@ TrackPropagation::propagate(const edm4eic::Track& /* track */,
   const auto& initParams = trackState.filtered();
   const auto& initCov    = trackState.filteredCovariance();
 
-  Acts::BoundTrackParameters initBoundParams(initSurface, initParams, initCov,
-                                             acts_track.particleHypothesis());
-
-  // Get pathlength of last track state with respect to perigee surface
-  const auto initPathLength = trackState.pathLength();
-
-  trace("    TrackPropagation. Propagating to surface # {}", typeid(targetSurf->type()).name());
+  // Pathlength of last track state with respect to perigee surface
+  return {.parameters = Acts::BoundTrackParameters(initSurface, initParams, initCov,
+                                                   acts_track.particleHypothesis()),
+          .pathLength = trackState.pathLength()};
+}
 
-  std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry   = m_geoSvc->trackingGeometry();
-  std::shared_ptr<const Acts::MagneticFieldProvider> magneticField = m_geoSvc->getFieldProvider();
+std::optional<TrackPropagation::PropagationState>
+TrackPropagation::propagateFrom(const PropagationState& start,
+                                const Acts::Surface& targetSurf) const {
 
-  // Convert algorithm log level to Acts log level
-  const auto spdlog_level = static_cast<spdlog::level::level_enum>(this->level());
-  const auto acts_level   = eicrecon::SpdlogToActsLevel(spdlog_level);
-  ACTS_LOCAL_LOGGER(Acts::getDefaultLogger("PROP", acts_level));
+  trace("    TrackPropagation. Propagating to surface # {}", typeid(targetSurf.type()).name());
 
-  using Propagator        = Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator>;
-  using PropagatorOptions = Propagator::template Options<Acts::ActorList<Acts::MaterialInteractor>>;
-  Propagator propagator(Acts::EigenStepper<>(magneticField),
-                        Acts::Navigator({.trackingGeometry = m_geoSvc->trackingGeometry()},
-                                        logger().cloneWithSuffix("Navigator")),
-                        logger().cloneWithSuffix("Propagator"));
+  const auto& initBoundParams = start.parameters;
+  const auto& initSurface     = initBoundParams.referenceSurface();
 
   // Get run-scoped contexts from service
   const auto& gctx = m_geoSvc->getActsGeometryContext();
   const auto& mctx = m_geoSvc->getActsMagneticFieldContext();
 
-  PropagatorOptions propagationOptions(gctx, mctx);
-
   // Some target surfaces (e.g. DIRC) may be inside the last measurement surface (e.g. BIC),
   // so we use a straight line intersection from the last measurement surface to the target
   // surface to determine if we have to propagate backwards.
   auto initPosition  = initBoundParams.position(gctx);
   auto initDirection = initBoundParams.direction();
-  auto intersections = targetSurf->intersect(gctx, initPosition, initDirection);
+  auto intersections = targetSurf.intersect(gctx, initPosition, initDirection);
 
   // Determine closest forward intersection (positive pathlength from perigee)
   auto intersection = intersections.closestForward();
@@ -281,14 +362,14 @@ TrackPropagation::propagate(const edm4eic::Track& /* track */,
   auto dot          = difference.dot(initBoundParams.direction());
 
   // Propagate forwards by default
-  propagationOptions.direction = Acts::Direction::Forward();
+  auto direction = Acts::Direction::Forward();
 
   // but invert if the position difference is opposite to direction
   if (intersection.isValid() && dot < 0) {
 
     // The extra fields of the surface geometry ID contain the DD4hep system
-    auto initSurfaceExtra   = initSurface->geometryId().extra();
-    auto targetSurfaceExtra = targetSurf->geometryId().extra();
+    auto initSurfaceExtra   = initSurface.geometryId().extra();
+    auto targetSurfaceExtra = targetSurf.geometryId().extra();
     debug("    inverting direction for propagator from surface {} to {}", initSurfaceExtra,
           targetSurfaceExtra);
     auto p1 = initBoundParams.position(gctx);
@@ -297,25 +378,44 @@ TrackPropagation::propagate(const edm4eic::Track& /* track */,
     debug("      straight line intersection at {} {} {}", p2.x(), p2.y(), p2.z());
 
     // Propagate backwards
-    propagationOptions.direction = Acts::Direction::Backward();
+    direction = Acts::Direction::Backward();
   }
 
-  auto result = propagator.propagate(initBoundParams, *targetSurf, propagationOptions);
+  return std::visit(
+      [&](const auto& propagator) -> std::optional<PropagationState> {
+        using PropagatorOptions = typename std::decay_t<decltype(propagator)>::template Options<
+            Acts::ActorList<Acts::MaterialInteractor>>;
+        PropagatorOptions propagationOptions(gctx, mctx);
+        propagationOptions.direction = direction;
 
-  // check propagation result
-  if (!result.ok()) {
-    trace("    propagation failed (!result.ok())");
-    return nullptr;
-  }
-  trace("    propagation result is OK");
+        auto result = propagator.propagate(initBoundParams, targetSurf, propagationOptions);
+
+        // check propagation result
+        if (!result.ok()) {
+          trace("    propagation failed (!result.ok())");
+          return std::nullopt;
+        }
+        trace("    propagation result is OK");
+
+        return PropagationState{.parameters = *((*result).endParameters),
+                                .pathLength = start.pathLength + (*result).pathLength};
+      },
+      *m_propagator);
+}
+
+std::unique_ptr<edm4eic::TrackPoint>
+TrackPropagation::makeTrackPoint(const PropagationState& state,
+                                 const Acts::Surface& targetSurf) const {
+
+  const auto& gctx = m_geoSvc->getActsGeometryContext();
 
   // Pulling results to convenient variables
-  auto trackStateParams  = *((*result).endParameters);
-  const auto& parameter  = trackStateParams.parameters();
-  const auto& covariance = *trackStateParams.covariance();
+  const auto& trackStateParams = state.parameters;
+  const auto& parameter        = trackStateParams.parameters();
+  const auto& covariance       = *trackStateParams.covariance();
 
   // Path length
-  const float pathLength      = initPathLength + (*result).pathLength;
+  const float pathLength      = state.pathLength;
   const float pathLengthError = 0;
   trace("    path len = {}", pathLength);
 
@@ -364,12 +464,11 @@ TrackPropagation::propagate(const edm4eic::Track& /* track */,
   trace("    err phi = {:.4f}", sqrt(covariance(Acts::eBoundPhi, Acts::eBoundPhi)));
   trace("    err th  = {:.4f}", sqrt(covariance(Acts::eBoundTheta, Acts::eBoundTheta)));
   trace("    err q/p = {:.4f}", sqrt(covariance(Acts::eBoundQOverP, Acts::eBoundQOverP)));
-  trace("    chi2    = {:.4f}", trajState.chi2Sum);
   trace("    loc err = {:.4f}", static_cast<float>(covariance(Acts::eBoundLoc0, Acts::eBoundLoc0)));
   trace("    loc err = {:.4f}", static_cast<float>(covariance(Acts::eBoundLoc1, Acts::eBoundLoc1)));
   trace("    loc err = {:.4f}", static_cast<float>(covariance(Acts::eBoundLoc0, Acts::eBoundLoc1)));
 
-  uint64_t surface = targetSurf->geometryId().value();
+  uint64_t surface = targetSurf.geometryId().value();
   uint32_t system  = 0; // default value...will be set in TrackPropagation factory
 
   return std::make_unique<edm4eic::TrackPoint>(
@@ -12,7 +12,14 @@
 #include <Acts/EventData/VectorMultiTrajectory.hpp>
 #include <Acts/EventData/VectorTrackContainer.hpp>
 #include <Acts/Geometry/GeometryIdentifier.hpp>
+#include <Acts/Propagator/AtlasStepper.hpp>
+#include <Acts/Propagator/EigenStepper.hpp>
+#include <Acts/Propagator/Navigator.hpp>
+#include <Acts/Propagator/Propagator.hpp>
+#include <Acts/Propagator/StraightLineStepper.hpp>
+#include <Acts/Propagator/SympyStepper.hpp>
 #include <Acts/Surfaces/Surface.hpp>
+#include <Acts/Utilities/Logger.hpp>
 #include <Acts/Utilities/Result.hpp>
 #include <ActsExamples/EventData/Track.hpp>
 #include <DD4hep/Detector.h>
@@ -24,14 +31,17 @@
 #include <cstddef>
 #include <gsl/pointers>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <variant>
 #include <vector>
 
 #include "algorithms/interfaces/ActsSvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 #include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/ConstTrackContainerView.h"
 #include "algorithms/tracking/TrackPropagationConfig.h"
 
 namespace eicrecon {
@@ -64,10 +74,8 @@ public:
     const auto [tracks, track_states, tracks_acts] = input;
     auto [propagated_tracks]                       = output;
 
-    // Construct ConstTrackContainer from underlying containers
-    auto trackStateContainer = std::make_shared<Acts::ConstVectorMultiTrajectory>(*track_states);
-    auto trackContainer      = std::make_shared<Acts::ConstVectorTrackContainer>(*tracks_acts);
-    ActsExamples::ConstTrackContainer constTracks(trackContainer, trackStateContainer);
+    // View the underlying containers as a ConstTrackContainer, without copying them
+    auto constTracks = makeConstTrackContainerView(*tracks_acts, *track_states);
 
     std::size_t i = 0;
     for (const auto& track : constTracks) {
@@ -76,14 +84,13 @@ public:
         trace("track segment connected to track {}", i);
         this_propagated_track.setTrack((*tracks)[i]);
       }
-      for (auto& surf : m_target_surfaces) {
-        auto prop_point =
-            propagate(tracks->size() == constTracks.size() ? (*tracks)[i] : edm4eic::Track{}, track,
-                      constTracks, surf);
+      auto prop_points = propagateToSurfaces(initialState(track, constTracks), m_target_surfaces);
+      for (std::size_t j = 0; j < m_target_surfaces.size(); ++j) {
+        auto& prop_point = prop_points[j];
         if (!prop_point)
           continue;
-        prop_point->surface = surf->geometryId().layer();
-        prop_point->system  = surf->geometryId().extra();
+        prop_point->surface = m_target_surfaces[j]->geometryId().layer();
+        prop_point->system  = m_target_surfaces[j]->geometryId().extra();
         this_propagated_track.addToPoints(*prop_point);
       }
       ++i;
@@ -103,6 +110,39 @@ public:
   void propagateToSurfaceList(const Input& input, const Output& output) const;
 
 private:
+  /// Propagator with any of the configurable steppers
+  template <typename Stepper> using StepperPropagator = Acts::Propagator<Stepper, Acts::Navigator>;
+  using Propagator =
+      std::variant<StepperPropagator<Acts::EigenStepper<>>, StepperPropagator<Acts::SympyStepper>,
+                   StepperPropagator<Acts::AtlasStepper>,
+                   StepperPropagator<Acts::StraightLineStepper>>;
+
+  /// Track parameters on a surface, with the path length from the perigee
+  struct PropagationState {
+    Acts::BoundTrackParameters parameters;
+    double pathLength;
+  };
+
+  /** State at the last measurement of a track, where all propagations start */
+  PropagationState initialState(const ActsExamples::ConstTrackProxy&,
+                                const ActsExamples::ConstTrackContainer&) const;
+
+  /** Propagates from a state to a surface, returns nothing if the surface is not reached */
+  std::optional<PropagationState> propagateFrom(const PropagationState& start,
+                                                const Acts::Surface& targetSurf) const;
+
+  /** Propagates from the initial state of a track to each of the surfaces, and returns the
+   *  track points in the order of the surfaces, with nullptr for those not reached */
+  std::vector<std::unique_ptr<edm4eic::TrackPoint>>
+  propagateToSurfaces(const PropagationState& initial,
+                      const std::vector<std::shared_ptr<Acts::Surface>>& surfaces) const;
+
+  std::unique_ptr<edm4eic::TrackPoint> makeTrackPoint(const PropagationState& state,
+                                                      const Acts::Surface& targetSurf) const;
+
+  std::shared_ptr<const Acts::Logger> m_acts_logger{nullptr};
+  std::unique_ptr<const Propagator> m_propagator;
+
   std::shared_ptr<const ActsGeometryProvider> m_geoSvc{
       algorithms::ActsSvc::instance().acts_geometry_provider()};
   const dd4hep::Detector* m_detector{algorithms::GeoSvc::instance().detector()};
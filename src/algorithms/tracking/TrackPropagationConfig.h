@@ -8,6 +8,8 @@
 #include <vector>
 #include <edm4eic/TrackPoint.h>
 
+#include "algorithms/tracking/StepperType.h"
+
 namespace eicrecon {
 
 struct CylinderSurfaceConfig {
@@ -33,6 +35,14 @@ struct TrackPropagationConfig {
   std::function<bool(edm4eic::TrackPoint)> track_point_cut{
       [](const edm4eic::TrackPoint&) { return true; }};
   bool skip_track_on_track_point_cut_failure{false};
+
+  // Step each track once through the target surfaces, ordered by their straight line
+  // distance from the last measurement, continuing from one surface to the next instead
+  // of propagating from the last measurement to each surface. Off in the production
+  // configurations; tracking_TrackPropagation compares it to per-surface propagation.
+  bool single_pass_propagation{false};
+
+  StepperType stepper{StepperType::eigen};
 };
 
 } // namespace eicrecon
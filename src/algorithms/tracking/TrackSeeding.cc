@@ -24,10 +24,17 @@
 #include <edm4hep/Vector3f.h>
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <tuple>
+#include <utility>
+#include <vector>
+
+#include "SeedFitKernels.h"
 
 namespace eicrecon {
 
@@ -92,6 +99,13 @@ void TrackSeeding::init() {
 
   m_seedFinderConfig  = m_seedFinderConfig.calculateDerivedQuantities();
   m_seedFinderOptions = m_seedFinderOptions.calculateDerivedQuantities(m_seedFinderConfig);
+
+  m_seedFinder =
+      std::make_unique<const Acts::SeedFinderOrthogonal<proxy_type>>(m_seedFinderConfig);
+  m_perigeeSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3(0, 0, 0));
+
+  // Workers searching phi sectors with the calling thread
+  m_taskPool = TaskPool::shared(std::max<std::size_t>(m_cfg.numThreads, 1) - 1);
 }
 
 void TrackSeeding::process(const Input& input, const Output& output) const {
@@ -99,35 +113,35 @@ void TrackSeeding::process(const Input& input, const Output& output) const {
   const auto [trk_hits]        = input;
   auto [trk_seeds, trk_params] = output;
 
-  std::vector<const eicrecon::SpacePoint*> spacePoints = getSpacePoints(*trk_hits);
-
-  Acts::SeedFinderOrthogonal<proxy_type> finder(m_seedFinderConfig); // FIXME move into class scope
-
-  // Config
-  Acts::SpacePointContainerConfig spConfig;
-
-  // Options
-  Acts::SpacePointContainerOptions spOptions;
-  spOptions.beamPos = {0., 0.};
-
-  SpacePointContainerType container(spacePoints);
-  Acts::SpacePointContainer<decltype(container), Acts::detail::RefHolder> spContainer(
-      spConfig, spOptions, container);
+  std::vector<eicrecon::SpacePoint> spacePoints;
+  std::vector<const eicrecon::SpacePoint*> spacePointPtrs;
+  getSpacePoints(*trk_hits, spacePoints, spacePointPtrs);
 
-  std::vector<Acts::Seed<proxy_type>> seeds = finder.createSeeds(m_seedFinderOptions, spContainer);
+  const std::vector<Acts::Seed<eicrecon::SpacePoint>> seeds =
+      (m_cfg.numPhiSectors > 1) ? findSeedsInPhiSectors(spacePointPtrs)
+                                : findSeeds(spacePointPtrs);
 
-  // need to convert here from seed of proxies to seed of sps
+  // Fit all seeds at once
+  seed_fit::Triplets triplets;
+  triplets.reserve(seeds.size());
   for (const auto& seed : seeds) {
     const auto& sps = seed.sp();
+    triplets.push_back({{{sps[0]->x(), sps[0]->y(), sps[0]->z(), sps[0]->r()},
+                         {sps[1]->x(), sps[1]->y(), sps[1]->z(), sps[1]->r()},
+                         {sps[2]->x(), sps[2]->y(), sps[2]->z(), sps[2]->r()}}});
+  }
+  seed_fit::Circles circles;
+  seed_fit::Lines lines;
+  seed_fit::circle_fit(triplets, circles);
+  seed_fit::line_fit(triplets, lines);
 
-    auto seedToAdd = Acts::Seed<eicrecon::SpacePoint>(*sps[0]->externalSpacePoint(),
-                                                      *sps[1]->externalSpacePoint(),
-                                                      *sps[2]->externalSpacePoint());
-    seedToAdd.setVertexZ(seed.z());
-    seedToAdd.setQuality(seed.seedQuality());
+  for (std::size_t iseed = 0; iseed < seeds.size(); ++iseed) {
+    const auto& seedToAdd = seeds[iseed];
+    const auto& sps       = seedToAdd.sp();
 
     // Estimate track parameters
-    auto trackParams = estimateTrackParamsFromSeed(seedToAdd);
+    auto trackParams = estimateTrackParamsFromSeed(
+        seedToAdd, {circles.R[iseed], circles.X0[iseed], circles.Y0[iseed]}, lines.slope[iseed]);
     if (!trackParams.has_value()) {
       debug("Failed to estimate track parameters from seed");
       continue;
@@ -141,38 +155,113 @@ void TrackSeeding::process(const Input& input, const Output& output) const {
     trk_seed.setQuality(seedToAdd.seedQuality());
 #endif
     trk_seed.setParams(trackParams.value());
-    trk_seed.addToHits(*sps[0]->externalSpacePoint());
-    trk_seed.addToHits(*sps[1]->externalSpacePoint());
-    trk_seed.addToHits(*sps[2]->externalSpacePoint());
+    trk_seed.addToHits(*sps[0]);
+    trk_seed.addToHits(*sps[1]);
+    trk_seed.addToHits(*sps[2]);
   }
+}
+
+std::vector<Acts::Seed<eicrecon::SpacePoint>>
+TrackSeeding::findSeeds(std::vector<const eicrecon::SpacePoint*>& spacePointPtrs) const {
+  // Config
+  Acts::SpacePointContainerConfig spConfig;
+
+  // Options
+  Acts::SpacePointContainerOptions spOptions;
+  spOptions.beamPos = {0., 0.};
+
+  SpacePointContainerType container(spacePointPtrs);
+  Acts::SpacePointContainer<decltype(container), Acts::detail::RefHolder> spContainer(
+      spConfig, spOptions, container);
+
+  std::vector<Acts::Seed<proxy_type>> seeds =
+      m_seedFinder->createSeeds(m_seedFinderOptions, spContainer);
+
+  // need to convert here from seed of proxies to seed of sps
+  std::vector<Acts::Seed<eicrecon::SpacePoint>> spSeeds;
+  spSeeds.reserve(seeds.size());
+  for (const auto& seed : seeds) {
+    const auto& sps = seed.sp();
 
-  for (auto& sp : spacePoints) {
-    delete sp;
+    auto& seedToAdd = spSeeds.emplace_back(*sps[0]->externalSpacePoint(),
+                                           *sps[1]->externalSpacePoint(),
+                                           *sps[2]->externalSpacePoint());
+    seedToAdd.setVertexZ(seed.z());
+    seedToAdd.setQuality(seed.seedQuality());
   }
+  return spSeeds;
 }
 
-std::vector<const eicrecon::SpacePoint*>
-TrackSeeding::getSpacePoints(const edm4eic::TrackerHitCollection& trk_hits) {
-  std::vector<const eicrecon::SpacePoint*> spacepoints;
+std::vector<Acts::Seed<eicrecon::SpacePoint>> TrackSeeding::findSeedsInPhiSectors(
+    const std::vector<const eicrecon::SpacePoint*>& spacePointPtrs) const {
+  const std::size_t num_sectors = m_cfg.numPhiSectors;
+  const double width            = 2. * M_PI / num_sectors;
+
+  auto sector_of = [&](double phi) {
+    return std::clamp(static_cast<long>(std::floor((phi + M_PI) / width)), 0L,
+                      static_cast<long>(num_sectors) - 1);
+  };
+
+  // Assumption: the Acts orthogonal seed finder combines a middle space point only with space
+  // points within deltaPhiMax of it, searching its k-d tree on the raw atan2(y, x) without
+  // wrap-around at phi = +-pi. Extending each sector by deltaPhiMax on both sides (plus a
+  // margin for the finder's single precision) then gives the sector's middle space points all
+  // their seeds, and the first and last sectors need not overlap across +-pi. Should the
+  // finder ever wrap around, they must, or the seeds straddling +-pi that it then finds
+  // without sectors are lost; the phi sector test checks such seeds.
+  const double overlap = m_cfg.deltaPhiMax + 1e-4;
+  std::vector<std::vector<const eicrecon::SpacePoint*>> sector_sps(num_sectors);
+  for (const auto* sp : spacePointPtrs) {
+    const double phi = std::atan2(sp->y(), sp->x());
+    for (long sector = sector_of(phi - overlap); sector <= sector_of(phi + overlap); ++sector) {
+      sector_sps[sector].push_back(sp);
+    }
+  }
+
+  // Seeds of a middle space point are found in its own sector and, possibly incomplete, in
+  // the overlapping neighbours, where they are dropped
+  std::vector<std::vector<Acts::Seed<eicrecon::SpacePoint>>> sector_seeds(num_sectors);
+  auto findSectorSeeds = [&](std::size_t sector) {
+    for (auto& seed : findSeeds(sector_sps[sector])) {
+      const auto* middle = seed.sp()[1];
+      if (sector_of(std::atan2(middle->y(), middle->x())) == static_cast<long>(sector)) {
+        sector_seeds[sector].push_back(std::move(seed));
+      }
+    }
+  };
+
+  m_taskPool->parallel_for(num_sectors, findSectorSeeds);
+
+  // Merge in sector order, independent of the number of threads
+  std::vector<Acts::Seed<eicrecon::SpacePoint>> seeds;
+  for (auto& seeds_in_sector : sector_seeds) {
+    seeds.insert(seeds.end(), std::make_move_iterator(seeds_in_sector.begin()),
+                 std::make_move_iterator(seeds_in_sector.end()));
+  }
+  return seeds;
+}
 
+void TrackSeeding::getSpacePoints(const edm4eic::TrackerHitCollection& trk_hits,
+                                  std::vector<eicrecon::SpacePoint>& spacePoints,
+                                  std::vector<const eicrecon::SpacePoint*>& spacePointPtrs) {
+  spacePoints.clear();
+  spacePoints.reserve(trk_hits.size());
   for (const auto hit : trk_hits) {
-    const eicrecon::SpacePoint* sp = new SpacePoint(hit);
-    spacepoints.push_back(sp);
+    spacePoints.emplace_back(hit);
   }
 
-  return spacepoints;
+  // addresses are stable, as spacePoints is not resized anymore
+  spacePointPtrs.clear();
+  spacePointPtrs.reserve(spacePoints.size());
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
 }
 
 std::optional<edm4eic::MutableTrackParameters>
-TrackSeeding::estimateTrackParamsFromSeed(const Acts::Seed<SpacePoint>& seed) const {
-  std::vector<std::pair<float, float>> xyHitPositions;
-  std::vector<std::pair<float, float>> rzHitPositions;
-  for (const auto& spptr : seed.sp()) {
-    xyHitPositions.emplace_back(spptr->x(), spptr->y());
-    rzHitPositions.emplace_back(spptr->r(), spptr->z());
-  }
-
-  auto RX0Y0 = circleFit(xyHitPositions);
+TrackSeeding::estimateTrackParamsFromSeed(const Acts::Seed<SpacePoint>& seed,
+                                          const std::tuple<float, float, float>& RX0Y0,
+                                          float slope) const {
   float R    = std::get<0>(RX0Y0);
   float X0   = std::get<1>(RX0Y0);
   float Y0   = std::get<2>(RX0Y0);
@@ -187,13 +276,13 @@ TrackSeeding::estimateTrackParamsFromSeed(const Acts::Seed<SpacePoint>& seed) co
     return {};
   }
 
-  auto slopeZ0     = lineFit(rzHitPositions);
   const auto xypos = findPCA(RX0Y0);
 
   //Determine charge
-  int charge = determineCharge(xyHitPositions, xypos, RX0Y0);
+  const auto* firstsp = seed.sp()[0];
+  int charge          = determineCharge({firstsp->x(), firstsp->y()}, xypos, RX0Y0);
 
-  float theta = atan(1. / std::get<0>(slopeZ0));
+  float theta = atan(1. / slope);
   // normalize to 0<theta<pi
   if (theta < 0) {
     theta += M_PI;
@@ -213,14 +302,14 @@ TrackSeeding::estimateTrackParamsFromSeed(const Acts::Seed<SpacePoint>& seed) co
   auto phi = atan2(vypos, vxpos);
 
   const float z0 = seed.z();
-  auto perigee   = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3(0, 0, 0));
   Acts::Vector3 global(xypos.first, xypos.second, z0);
 
   //Compute local position at PCA
   Acts::Vector2 localpos;
   Acts::Vector3 direction(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta));
 
-  auto local = perigee->globalToLocal(m_geoSvc->getActsGeometryContext(), global, direction);
+  auto local =
+      m_perigeeSurface->globalToLocal(m_geoSvc->getActsGeometryContext(), global, direction);
 
   if (!local.ok()) {
     return {};
@@ -248,7 +337,7 @@ TrackSeeding::estimateTrackParamsFromSeed(const Acts::Seed<SpacePoint>& seed) co
   return trackparam;
 }
 
-std::pair<float, float> TrackSeeding::findPCA(std::tuple<float, float, float>& circleParams) {
+std::pair<float, float> TrackSeeding::findPCA(const std::tuple<float, float, float>& circleParams) {
   const float R  = std::get<0>(circleParams);
   const float X0 = std::get<1>(circleParams);
   const float Y0 = std::get<2>(circleParams);
@@ -262,13 +351,12 @@ std::pair<float, float> TrackSeeding::findPCA(std::tuple<float, float, float>& c
   return std::make_pair(xmin, ymin);
 }
 
-int TrackSeeding::determineCharge(std::vector<std::pair<float, float>>& positions,
+int TrackSeeding::determineCharge(const std::pair<float, float>& firstpos,
                                   const std::pair<float, float>& PCA,
-                                  std::tuple<float, float, float>& RX0Y0) {
+                                  const std::tuple<float, float, float>& RX0Y0) {
 
-  const auto& firstpos = positions.at(0);
-  auto hit_x           = firstpos.first;
-  auto hit_y           = firstpos.second;
+  auto hit_x = firstpos.first;
+  auto hit_y = firstpos.second;
 
   auto xpos = PCA.first;
   auto ypos = PCA.second;
@@ -287,126 +375,4 @@ int TrackSeeding::determineCharge(std::vector<std::pair<float, float>>& position
   return copysign(1., -dot);
 }
 
-/**
-   * Circle fit to a given set of data points (in 2D)
-   * This is an algebraic fit, due to Taubin, based on the journal article
-   * G. Taubin, "Estimation Of Planar Curves, Surfaces And Nonplanar
-   * Space Curves Defined By Implicit Equations, With
-   * Applications To Edge And Range Image Segmentation",
-   * IEEE Trans. PAMI, Vol. 13, pages 1115-1138, (1991)
-   * It works well whether data points are sampled along an entire circle or along a small arc.
-   * It still has a small bias and its statistical accuracy is slightly lower than that of the geometric fit (minimizing geometric distances),
-   * It provides a very good initial guess for a subsequent geometric fit.
-   * Nikolai Chernov  (September 2012)
-   */
-std::tuple<float, float, float>
-TrackSeeding::circleFit(std::vector<std::pair<float, float>>& positions) {
-  // Compute x- and y- sample means
-  double meanX  = 0;
-  double meanY  = 0;
-  double weight = 0;
-
-  for (const auto& [x, y] : positions) {
-    meanX += x;
-    meanY += y;
-    ++weight;
-  }
-  meanX /= weight;
-  meanY /= weight;
-
-  //     computing moments
-
-  double Mxx = 0;
-  double Myy = 0;
-  double Mxy = 0;
-  double Mxz = 0;
-  double Myz = 0;
-  double Mzz = 0;
-
-  for (auto& [x, y] : positions) {
-    double Xi = x - meanX; //  centered x-coordinates
-    double Yi = y - meanY; //  centered y-coordinates
-    double Zi = std::pow(Xi, 2) + std::pow(Yi, 2);
-
-    Mxy += Xi * Yi;
-    Mxx += Xi * Xi;
-    Myy += Yi * Yi;
-    Mxz += Xi * Zi;
-    Myz += Yi * Zi;
-    Mzz += Zi * Zi;
-  }
-  Mxx /= weight;
-  Myy /= weight;
-  Mxy /= weight;
-  Mxz /= weight;
-  Myz /= weight;
-  Mzz /= weight;
-
-  //  computing coefficients of the characteristic polynomial
-
-  const double Mz     = Mxx + Myy;
-  const double Cov_xy = Mxx * Myy - Mxy * Mxy;
-  const double Var_z  = Mzz - Mz * Mz;
-  const double A3     = 4 * Mz;
-  const double A2     = -3 * Mz * Mz - Mzz;
-  const double A1     = Var_z * Mz + 4 * Cov_xy * Mz - Mxz * Mxz - Myz * Myz;
-  const double A0  = Mxz * (Mxz * Myy - Myz * Mxy) + Myz * (Myz * Mxx - Mxz * Mxy) - Var_z * Cov_xy;
-  const double A22 = A2 + A2;
-  const double A33 = A3 + A3 + A3;
-
-  //    finding the root of the characteristic polynomial
-  //    using Newton's method starting at x=0
-  //    (it is guaranteed to converge to the right root)
-  static constexpr int iter_max = 99;
-  double x                      = 0;
-  double y                      = A0;
-
-  // usually, 4-6 iterations are enough
-  for (int iter = 0; iter < iter_max; ++iter) {
-    const double Dy   = A1 + x * (A22 + A33 * x);
-    const double xnew = x - y / Dy;
-    if ((xnew == x) || (!std::isfinite(xnew))) {
-      break;
-    }
-
-    const double ynew = A0 + xnew * (A1 + xnew * (A2 + xnew * A3));
-    if (std::abs(ynew) >= std::abs(y)) {
-      break;
-    }
-
-    x = xnew;
-    y = ynew;
-  }
-
-  //  computing parameters of the fitting circle
-  const double DET     = std::pow(x, 2) - x * Mz + Cov_xy;
-  const double Xcenter = (Mxz * (Myy - x) - Myz * Mxy) / DET / 2;
-  const double Ycenter = (Myz * (Mxx - x) - Mxz * Mxy) / DET / 2;
-
-  //  assembling the output
-  float X0 = Xcenter + meanX;
-  float Y0 = Ycenter + meanY;
-  float R  = std::sqrt(std::pow(Xcenter, 2) + std::pow(Ycenter, 2) + Mz);
-  return std::make_tuple(R, X0, Y0);
-}
-
-std::tuple<float, float> TrackSeeding::lineFit(std::vector<std::pair<float, float>>& positions) {
-  double xsum  = 0;
-  double x2sum = 0;
-  double ysum  = 0;
-  double xysum = 0;
-  for (const auto& [r, z] : positions) {
-    xsum  = xsum + r;               //calculate sigma(xi)
-    ysum  = ysum + z;               //calculate sigma(yi)
-    x2sum = x2sum + std::pow(r, 2); //calculate sigma(x^2i)
-    xysum = xysum + r * z;          //calculate sigma(xi*yi)
-  }
-
-  const auto npts          = positions.size();
-  const double denominator = (x2sum * npts - std::pow(xsum, 2));
-  const float a            = (xysum * npts - xsum * ysum) / denominator;  //calculate slope
-  const float b            = (x2sum * ysum - xsum * xysum) / denominator; //calculate intercept
-  return std::make_tuple(a, b);
-}
-
 } // namespace eicrecon
@@ -7,7 +7,9 @@
 #include <Acts/EventData/SpacePointContainer.hpp>
 #include <Acts/Seeding/SeedFilterConfig.hpp>
 #include <Acts/Seeding/SeedFinderConfig.hpp>
+#include <Acts/Seeding/SeedFinderOrthogonal.hpp>
 #include <Acts/Seeding/SeedFinderOrthogonalConfig.hpp>
+#include <Acts/Surfaces/PerigeeSurface.hpp>
 #include <Acts/Utilities/HashedString.hpp>
 #include <Acts/Utilities/Holders.hpp>
 #if __has_include(<ActsExamples/EventData/SpacePointContainer.hpp>)
@@ -36,6 +38,7 @@
 #include "OrthogonalTrackSeedingConfig.h"
 #include "SpacePoint.h"
 #include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/interfaces/TaskPool.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -109,16 +112,31 @@ private:
   Acts::SeedFinderOptions m_seedFinderOptions;
   Acts::SeedFinderOrthogonalConfig<proxy_type> m_seedFinderConfig;
 
-  static int determineCharge(std::vector<std::pair<float, float>>& positions,
+  // Event-invariant objects, built once in init()
+  std::unique_ptr<const Acts::SeedFinderOrthogonal<proxy_type>> m_seedFinder;
+  std::shared_ptr<const Acts::PerigeeSurface> m_perigeeSurface;
+  // Workers for phi sectors, shared by all instances with the same numThreads
+  std::shared_ptr<TaskPool> m_taskPool;
+
+  static int determineCharge(const std::pair<float, float>& firstpos,
                              const std::pair<float, float>& PCA,
-                             std::tuple<float, float, float>& RX0Y0);
-  static std::pair<float, float> findPCA(std::tuple<float, float, float>& circleParams);
-  static std::vector<const eicrecon::SpacePoint*>
-  getSpacePoints(const edm4eic::TrackerHitCollection& trk_hits);
+                             const std::tuple<float, float, float>& RX0Y0);
+  static std::pair<float, float> findPCA(const std::tuple<float, float, float>& circleParams);
+  /// Fill `spacePoints` contiguously with one space point per hit and `spacePointPtrs` with
+  /// their addresses, as needed by the space point container
+  static void getSpacePoints(const edm4eic::TrackerHitCollection& trk_hits,
+                             std::vector<eicrecon::SpacePoint>& spacePoints,
+                             std::vector<const eicrecon::SpacePoint*>& spacePointPtrs);
+  /// Run the seed finder over `spacePointPtrs`
+  std::vector<Acts::Seed<eicrecon::SpacePoint>>
+  findSeeds(std::vector<const eicrecon::SpacePoint*>& spacePointPtrs) const;
+  /// Run the seed finder over overlapping phi sectors, in parallel, keeping in each sector
+  /// only the seeds whose middle space point lies in the sector proper
+  std::vector<Acts::Seed<eicrecon::SpacePoint>>
+  findSeedsInPhiSectors(const std::vector<const eicrecon::SpacePoint*>& spacePointPtrs) const;
+  /// Track parameters from the circle (R, X0, Y0) and the r-z line slope fitted to the seed
   std::optional<edm4eic::MutableTrackParameters>
-  estimateTrackParamsFromSeed(const Acts::Seed<SpacePoint>& seed) const;
-
-  static std::tuple<float, float, float> circleFit(std::vector<std::pair<float, float>>& positions);
-  static std::tuple<float, float> lineFit(std::vector<std::pair<float, float>>& positions);
+  estimateTrackParamsFromSeed(const Acts::Seed<SpacePoint>& seed,
+                              const std::tuple<float, float, float>& RX0Y0, float slope) const;
 };
 } // namespace eicrecon
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
+
+#include "algorithms/interfaces/ObjectIDIndex.h"
+
+namespace eicrecon {
+
+/**
+ * Tracker hit associations indexed by raw hit. It is built once per association collection
+ * and event and then shared, read-only, by all track conversions that do truth matching
+ * against that collection.
+ */
+using TrackerHitAssociationIndex = ObjectIDIndex<edm4eic::MCRecoTrackerHitAssociationCollection>;
+
+} // namespace eicrecon
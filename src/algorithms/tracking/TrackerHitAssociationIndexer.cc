@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include "TrackerHitAssociationIndexer.h"
+
+#include <tuple>
+
+namespace eicrecon {
+
+void TrackerHitAssociationIndexer::process(const Input& input, const Output& output) const {
+  const auto [raw_hit_assocs] = input;
+  auto [index]                = output;
+
+  *index = new TrackerHitAssociationIndex(
+      *raw_hit_assocs, [](const auto& raw_hit_assoc) { return raw_hit_assoc.getRawHit(); });
+  debug("Indexed {} associations to {} raw hits", raw_hit_assocs->size(), (*index)->keys());
+}
+
+} // namespace eicrecon
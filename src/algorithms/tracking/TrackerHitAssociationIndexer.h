@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <algorithms/algorithm.h>
+#include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
+#include <string>
+#include <string_view>
+
+#include "TrackerHitAssociationIndex.h"
+#include "algorithms/interfaces/WithPodConfig.h"
+
+namespace eicrecon {
+
+using TrackerHitAssociationIndexerAlgorithm =
+    algorithms::Algorithm<algorithms::Input<edm4eic::MCRecoTrackerHitAssociationCollection>,
+                          algorithms::Output<TrackerHitAssociationIndex*>>;
+
+/// Indexes tracker hit associations by raw hit, shared by the track conversions
+class TrackerHitAssociationIndexer : public TrackerHitAssociationIndexerAlgorithm,
+                                     public WithPodConfig<NoConfig> {
+public:
+  TrackerHitAssociationIndexer(std::string_view name)
+      : TrackerHitAssociationIndexerAlgorithm{name,
+                                              {"inputRawTrackerHitAssociations"},
+                                              {"outputRawTrackerHitAssociationIndex"},
+                                              "Index tracker hit associations by raw hit"} {}
+
+  void init() final {};
+  void process(const Input&, const Output&) const final;
+};
+
+} // namespace eicrecon
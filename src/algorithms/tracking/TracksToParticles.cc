@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "TracksToParticles.h"
+#include "algorithms/interfaces/ObjectIDIndex.h"
 
 namespace eicrecon {
 
@@ -26,6 +27,13 @@ void TracksToParticles::process(const TracksToParticles::Input& input,
   const auto [tracks, track_assocs]     = input;
   auto [parts, part_links, part_assocs] = output;
 
+  // Index track associations by reconstructed track once per event
+  ObjectIDIndex<edm4eic::MCRecoTrackParticleAssociationCollection> track_assoc_index;
+  if (track_assocs != nullptr) {
+    track_assoc_index.build(*track_assocs,
+                            [](const auto& track_assoc) { return track_assoc.getRec(); });
+  }
+
   for (const auto& track : *tracks) {
     auto trajectory = track.getTrajectory();
     for (const auto& trk : trajectory.getTrackParameters()) {
@@ -49,20 +57,18 @@ void TracksToParticles::process(const TracksToParticles::Input& input,
       rec_part.setReferencePoint(track.getPosition());
       // rec_part.covMatrix()  // @TODO: covariance matrix on 4-momentum
 
-      for (auto track_assoc : *track_assocs) {
-        if (track_assoc.getRec() == track) {
-          trace("Found track association: index={} -> index={}, weight={}",
-                track_assoc.getRec().getObjectID().index, track_assoc.getSim().getObjectID().index,
-                track_assoc.getWeight());
-          auto part_link = part_links->create();
-          part_link.setFrom(rec_part);
-          part_link.setTo(track_assoc.getSim());
-          part_link.setWeight(track_assoc.getWeight());
-          auto part_assoc = part_assocs->create();
-          part_assoc.setRec(rec_part);
-          part_assoc.setSim(track_assoc.getSim());
-          part_assoc.setWeight(track_assoc.getWeight());
-        }
+      for (auto track_assoc : track_assoc_index.find(track)) {
+        trace("Found track association: index={} -> index={}, weight={}",
+              track_assoc.getRec().getObjectID().index, track_assoc.getSim().getObjectID().index,
+              track_assoc.getWeight());
+        auto part_link = part_links->create();
+        part_link.setFrom(rec_part);
+        part_link.setTo(track_assoc.getSim());
+        part_link.setWeight(track_assoc.getWeight());
+        auto part_assoc = part_assocs->create();
+        part_assoc.setRec(rec_part);
+        part_assoc.setSim(track_assoc.getSim());
+        part_assoc.setWeight(track_assoc.getWeight());
       }
     }
   }
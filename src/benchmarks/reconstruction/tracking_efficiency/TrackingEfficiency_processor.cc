@@ -26,6 +26,7 @@
 #include <string>
 #include <vector>
 
+#include "algorithms/tracking/ConstTrackContainerView.h"
 #include "services/log/Log_service.h"
 #include "services/rootfile/RootFile_service.h"
 
@@ -99,11 +100,9 @@ void TrackingEfficiency_processor::Process(const std::shared_ptr<const JEvent>&
     assert(acts_tracks.front() != nullptr &&
            "ConstVectorTrackContainer pointer should not be null");
 
-    // Construct ConstTrackContainer from underlying containers
-    auto trackStateContainer =
-        std::make_shared<Acts::ConstVectorMultiTrajectory>(*acts_track_states.front());
-    auto trackContainer = std::make_shared<Acts::ConstVectorTrackContainer>(*acts_tracks.front());
-    ActsExamples::ConstTrackContainer track_container(trackContainer, trackStateContainer);
+    // View the underlying containers as a ConstTrackContainer, without copying them
+    auto track_container =
+        eicrecon::makeConstTrackContainerView(*acts_tracks.front(), *acts_track_states.front());
 
     for (const auto& track : track_container) {
       // Get the track parameters
@@ -4,14 +4,20 @@
 #include <Evaluator/DD4hepUnits.h>
 #include <JANA/JApplication.h>
 #include <JANA/JApplicationFwd.h>
+#include <JANA/Services/JParameterManager.h>
 #include <JANA/Utils/JTypeInfo.h>
 #include <edm4eic/EDM4eicVersion.h>
 #include <edm4eic/unit_system.h>
 #include <edm4hep/SimCalorimeterHit.h>
+#include <fmt/format.h>
+#include <spdlog/logger.h>
+#include <algorithm>
+#include <cctype>
 #include <cmath>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -19,6 +25,7 @@
 #include "algorithms/calorimetry/ImagingTopoClusterConfig.h"
 #include "algorithms/calorimetry/SimCalorimeterHitProcessorConfig.h"
 #include "algorithms/digi/CALOROCDigitizationConfig.h"
+#include "algorithms/digi/CalorimeterPulseDigitizationConfig.h"
 #include "algorithms/digi/PulseCombinerConfig.h"
 #include "algorithms/digi/PulseGenerationConfig.h"
 #include "algorithms/digi/PulseNoiseConfig.h"
@@ -36,9 +43,11 @@
 #include "factories/digi/PulseCombiner_factory.h"
 #include "factories/digi/PulseGeneration_factory.h"
 #include "factories/digi/PulseNoise_factory.h"
+#include "services/log/Log_service.h"
 
 #if EDM4EIC_VERSION_MAJOR > 8 || (EDM4EIC_VERSION_MAJOR == 8 && EDM4EIC_VERSION_MINOR >= 7)
 #include "factories/digi/CALOROCDigitization_factory.h"
+#include "factories/digi/CalorimeterPulseDigitization_factory.h"
 #endif
 
 extern "C" {
@@ -48,6 +57,9 @@ void InitPlugin(JApplication* app) {
 
   InitJANAPlugin(app);
 
+  auto log_service = app->GetService<Log_service>();
+  auto mLog        = log_service->logger("BEMC");
+
   // Make sure left and right use the same value
   decltype(SimCalorimeterHitProcessorConfig::attenuationParameters) EcalBarrelScFi_attPars = {
       0.416212, 747.39875 * edm4eic::unit::mm, 7521.88383 * edm4eic::unit::mm};
@@ -95,86 +107,180 @@ void InitPlugin(JApplication* app) {
   decltype(CalorimeterHitDigiConfig::pedSigmaADC) EcalBarrelScFi_pedSigmaADC = 1;
   decltype(CalorimeterHitDigiConfig::resolutionTDC) EcalBarrelScFi_resolutionTDC =
       10 * dd4hep::picosecond;
+  // Both readout ends in a single pass over the hits and their contributions. The ends had
+  // separate EcalBarrelScFiPAttenuatedHits and EcalBarrelScFiNAttenuatedHits factories
+  // before, whose parameters now have to be set on EcalBarrelScFiAttenuatedHits
+  for (const auto& [key, parameter] : app->GetJParameterManager()->GetAllParameters()) {
+    std::string lower_key = key;
+    std::ranges::transform(lower_key, lower_key.begin(),
+                           [](unsigned char c) { return std::tolower(c); });
+    if (lower_key.starts_with("ecalbarrelscfipattenuatedhits:") ||
+        lower_key.starts_with("ecalbarrelscfinattenuatedhits:")) {
+      mLog->warn("Parameter {} is ignored, the readout ends are attenuated by a single factory "
+                 "with the prefix EcalBarrelScFiAttenuatedHits",
+                 key);
+    }
+  }
   app->Add(new JOmniFactoryGeneratorT<SimCalorimeterHitProcessor_factory>(
-      "EcalBarrelScFiPAttenuatedHits", {"EcalBarrelScFiHits"},
-      {"EcalBarrelScFiPAttenuatedHits", "EcalBarrelScFiPAttenuatedHitContributions"},
-      {
-          .attenuationParameters            = EcalBarrelScFi_attPars,
-          .readout                          = "EcalBarrelScFiHits",
-          .attenuationReferencePositionName = "EcalBarrel_LightGuide_PositivePosZ",
-          .hitMergeFields                   = EcalBarrelScFi_hitMergeFields,
-          .contributionMergeFields          = EcalBarrelScFi_contributionMergeFields,
-          .inversePropagationSpeed          = EcalBarrelScFi_inversePropagationSpeed,
-          .fixedTimeDelay                   = EcalBarrelScFi_fixedTimeDelay,
-          .timeWindow                       = EcalBarrelScFi_timeWindow,
-      },
-      app // TODO: Remove me once fixed
-      ));
-  app->Add(new JOmniFactoryGeneratorT<SimCalorimeterHitProcessor_factory>(
-      "EcalBarrelScFiNAttenuatedHits", {"EcalBarrelScFiHits"},
-      {"EcalBarrelScFiNAttenuatedHits", "EcalBarrelScFiNAttenuatedHitContributions"},
-      {
-          .attenuationParameters            = EcalBarrelScFi_attPars,
-          .readout                          = "EcalBarrelScFiHits",
-          .attenuationReferencePositionName = "EcalBarrel_LightGuide_NegativePosZ",
-          .hitMergeFields                   = EcalBarrelScFi_hitMergeFields,
-          .contributionMergeFields          = EcalBarrelScFi_contributionMergeFields,
-          .inversePropagationSpeed          = EcalBarrelScFi_inversePropagationSpeed,
-          .fixedTimeDelay                   = EcalBarrelScFi_fixedTimeDelay,
-          .timeWindow                       = EcalBarrelScFi_timeWindow,
-      },
-      app // TODO: Remove me once fixed
-      ));
-  app->Add(new JOmniFactoryGeneratorT<PulseGeneration_factory<edm4hep::SimCalorimeterHit>>(
-      "EcalBarrelScFiPPulses", {"EcalBarrelScFiPAttenuatedHits"}, {"EcalBarrelScFiPPulses"},
-      {
-          .pulse_shape_function = EcalBarrelScFi_pulse_shape_function,
-          .pulse_shape_params   = EcalBarrelScFi_pulse_shape_params,
-          .ignore_thres         = EcalBarrelScFi_ignore_thres,
-          .timestep             = EcalBarrelScFi_timestep,
-      },
-      app // TODO: Remove me once fixed
-      ));
-  app->Add(new JOmniFactoryGeneratorT<PulseGeneration_factory<edm4hep::SimCalorimeterHit>>(
-      "EcalBarrelScFiNPulses", {"EcalBarrelScFiNAttenuatedHits"}, {"EcalBarrelScFiNPulses"},
-      {
-          .pulse_shape_function = EcalBarrelScFi_pulse_shape_function,
-          .pulse_shape_params   = EcalBarrelScFi_pulse_shape_params,
-          .ignore_thres         = EcalBarrelScFi_ignore_thres,
-          .timestep             = EcalBarrelScFi_timestep,
-      },
-      app // TODO: Remove me once fixed
-      ));
-  app->Add(new JOmniFactoryGeneratorT<PulseCombiner_factory>(
-      "EcalBarrelScFiPCombinedPulses", {"EcalBarrelScFiPPulses"}, {"EcalBarrelScFiPCombinedPulses"},
-      {
-          .minimum_separation = EcalBarrelScFi_minimum_separation,
-          .readout            = "EcalBarrelScFiHits",
-          .combine_field      = EcalBarrelScFi_combine_field,
-      },
-      app // TODO: Remove me once fixed
-      ));
-  app->Add(new JOmniFactoryGeneratorT<PulseCombiner_factory>(
-      "EcalBarrelScFiNCombinedPulses", {"EcalBarrelScFiNPulses"}, {"EcalBarrelScFiNCombinedPulses"},
-      {
-          .minimum_separation = EcalBarrelScFi_minimum_separation,
-          .readout            = "EcalBarrelScFiHits",
-          .combine_field      = EcalBarrelScFi_combine_field,
-      },
-      app // TODO: Remove me once fixed
-      ));
-  app->Add(new JOmniFactoryGeneratorT<PulseNoise_factory>(
-      "EcalBarrelScFiPCombinedPulsesWithNoise", {"EventHeader", "EcalBarrelScFiPCombinedPulses"},
-      {"EcalBarrelScFiPCombinedPulsesWithNoise"},
+      "EcalBarrelScFiAttenuatedHits", {"EcalBarrelScFiHits"},
+      {"EcalBarrelScFiPAttenuatedHits", "EcalBarrelScFiNAttenuatedHits",
+       "EcalBarrelScFiPAttenuatedHitContributions", "EcalBarrelScFiNAttenuatedHitContributions"},
       {
-          .poles    = EcalBarrelScFi_poles,
-          .variance = EcalBarrelScFi_variance,
-          .alpha    = EcalBarrelScFi_alpha,
-          .scale    = EcalBarrelScFi_scale,
-          .pedestal = EcalBarrelScFi_pedestal,
+          .attenuationParameters             = EcalBarrelScFi_attPars,
+          .readout                           = "EcalBarrelScFiHits",
+          .attenuationReferencePositionNames = {"EcalBarrel_LightGuide_PositivePosZ",
+                                                "EcalBarrel_LightGuide_NegativePosZ"},
+          .hitMergeFields                    = EcalBarrelScFi_hitMergeFields,
+          .contributionMergeFields           = EcalBarrelScFi_contributionMergeFields,
+          .inversePropagationSpeed           = EcalBarrelScFi_inversePropagationSpeed,
+          .fixedTimeDelay                    = EcalBarrelScFi_fixedTimeDelay,
+          .timeWindow                        = EcalBarrelScFi_timeWindow,
       },
       app // TODO: Remove me once fixed
       ));
+  // Pulse generation, combination, noise and CALOROC digitization either in one pass per
+  // readout end, or as separate factories. Either way, the pulse collections are produced
+  // by the same factories as the CALOROC hits digitized from them
+  bool EcalBarrelScFi_fusedPulseDigitization = false;
+#if EDM4EIC_VERSION_MAJOR > 8 || (EDM4EIC_VERSION_MAJOR == 8 && EDM4EIC_VERSION_MINOR >= 7)
+  app->SetDefaultParameter("BEMC:EcalBarrelScFiFusedPulseDigitization",
+                           EcalBarrelScFi_fusedPulseDigitization,
+                           "Generate, combine, add noise to and digitize EcalBarrelScFi pulses in "
+                           "a single pass per readout end");
+  if (EcalBarrelScFi_fusedPulseDigitization) {
+    // N side is digitized without noise, as in the stage-by-stage chain, and its noisy
+    // pulses come from the PulseNoise factory below
+    for (const auto& [side, add_noise] : {std::pair{"P", true}, std::pair{"N", false}}) {
+      std::vector<std::string> outputs{fmt::format("EcalBarrelScFi{}CALOROCHits", side),
+                                       fmt::format("EcalBarrelScFi{}Pulses", side),
+                                       fmt::format("EcalBarrelScFi{}CombinedPulses", side)};
+      if (add_noise) {
+        outputs.push_back(fmt::format("EcalBarrelScFi{}CombinedPulsesWithNoise", side));
+      }
+      app->Add(new JOmniFactoryGeneratorT<CalorimeterPulseDigitization_factory>(
+          fmt::format("EcalBarrelScFi{}CALOROCHits", side),
+          {"EventHeader", fmt::format("EcalBarrelScFi{}AttenuatedHits", side)}, outputs,
+          {
+              .generation =
+                  {
+                      .pulse_shape_function = EcalBarrelScFi_pulse_shape_function,
+                      .pulse_shape_params   = EcalBarrelScFi_pulse_shape_params,
+                      .ignore_thres         = EcalBarrelScFi_ignore_thres,
+                      .timestep             = EcalBarrelScFi_timestep,
+                  },
+              .combiner =
+                  {
+                      .minimum_separation = EcalBarrelScFi_minimum_separation,
+                      .readout            = "EcalBarrelScFiHits",
+                      .combine_field      = EcalBarrelScFi_combine_field,
+                  },
+              .add_noise = add_noise,
+              .noise =
+                  {
+                      .poles    = EcalBarrelScFi_poles,
+                      .variance = EcalBarrelScFi_variance,
+                      .alpha    = EcalBarrelScFi_alpha,
+                      .scale    = EcalBarrelScFi_scale,
+                      .pedestal = EcalBarrelScFi_pedestal,
+                  },
+              .digitization =
+                  {
+                      .adc_phase            = EcalBarrelScFi_adc_phase,
+                      .toa_thres            = EcalBarrelScFi_toa_thres,
+                      .tot_thres            = EcalBarrelScFi_tot_thres,
+                      .dyRangeSingleGainADC = EcalBarrelScFi_dyRangeSingleGainADC,
+                      .dyRangeHighGainADC   = EcalBarrelScFi_dyRangeHighGainADC,
+                      .dyRangeLowGainADC    = EcalBarrelScFi_dyRangeLowGainADC,
+                  },
+          },
+          app // TODO: Remove me once fixed
+          ));
+    }
+  }
+#endif
+  if (!EcalBarrelScFi_fusedPulseDigitization) {
+    app->Add(new JOmniFactoryGeneratorT<PulseGeneration_factory<edm4hep::SimCalorimeterHit>>(
+        "EcalBarrelScFiPPulses", {"EcalBarrelScFiPAttenuatedHits"}, {"EcalBarrelScFiPPulses"},
+        {
+            .pulse_shape_function = EcalBarrelScFi_pulse_shape_function,
+            .pulse_shape_params   = EcalBarrelScFi_pulse_shape_params,
+            .ignore_thres         = EcalBarrelScFi_ignore_thres,
+            .timestep             = EcalBarrelScFi_timestep,
+        },
+        app // TODO: Remove me once fixed
+        ));
+    app->Add(new JOmniFactoryGeneratorT<PulseGeneration_factory<edm4hep::SimCalorimeterHit>>(
+        "EcalBarrelScFiNPulses", {"EcalBarrelScFiNAttenuatedHits"}, {"EcalBarrelScFiNPulses"},
+        {
+            .pulse_shape_function = EcalBarrelScFi_pulse_shape_function,
+            .pulse_shape_params   = EcalBarrelScFi_pulse_shape_params,
+            .ignore_thres         = EcalBarrelScFi_ignore_thres,
+            .timestep             = EcalBarrelScFi_timestep,
+        },
+        app // TODO: Remove me once fixed
+        ));
+    app->Add(new JOmniFactoryGeneratorT<PulseCombiner_factory>(
+        "EcalBarrelScFiPCombinedPulses", {"EcalBarrelScFiPPulses"},
+        {"EcalBarrelScFiPCombinedPulses"},
+        {
+            .minimum_separation = EcalBarrelScFi_minimum_separation,
+            .readout            = "EcalBarrelScFiHits",
+            .combine_field      = EcalBarrelScFi_combine_field,
+        },
+        app // TODO: Remove me once fixed
+        ));
+    app->Add(new JOmniFactoryGeneratorT<PulseCombiner_factory>(
+        "EcalBarrelScFiNCombinedPulses", {"EcalBarrelScFiNPulses"},
+        {"EcalBarrelScFiNCombinedPulses"},
+        {
+            .minimum_separation = EcalBarrelScFi_minimum_separation,
+            .readout            = "EcalBarrelScFiHits",
+            .combine_field      = EcalBarrelScFi_combine_field,
+        },
+        app // TODO: Remove me once fixed
+        ));
+    app->Add(new JOmniFactoryGeneratorT<PulseNoise_factory>(
+        "EcalBarrelScFiPCombinedPulsesWithNoise", {"EventHeader", "EcalBarrelScFiPCombinedPulses"},
+        {"EcalBarrelScFiPCombinedPulsesWithNoise"},
+        {
+            .poles    = EcalBarrelScFi_poles,
+            .variance = EcalBarrelScFi_variance,
+            .alpha    = EcalBarrelScFi_alpha,
+            .scale    = EcalBarrelScFi_scale,
+            .pedestal = EcalBarrelScFi_pedestal,
+        },
+        app // TODO: Remove me once fixed
+        ));
+#if EDM4EIC_VERSION_MAJOR > 8 || (EDM4EIC_VERSION_MAJOR == 8 && EDM4EIC_VERSION_MINOR >= 7)
+    app->Add(new JOmniFactoryGeneratorT<CALOROCDigitization_factory>(
+        "EcalBarrelScFiPCALOROCHits", {"EcalBarrelScFiPCombinedPulsesWithNoise"},
+        {"EcalBarrelScFiPCALOROCHits"},
+        {
+            .adc_phase            = EcalBarrelScFi_adc_phase,
+            .toa_thres            = EcalBarrelScFi_toa_thres,
+            .tot_thres            = EcalBarrelScFi_tot_thres,
+            .dyRangeSingleGainADC = EcalBarrelScFi_dyRangeSingleGainADC,
+            .dyRangeHighGainADC   = EcalBarrelScFi_dyRangeHighGainADC,
+            .dyRangeLowGainADC    = EcalBarrelScFi_dyRangeLowGainADC,
+        },
+        app // TODO: Remove me once fixed
+        ));
+    app->Add(new JOmniFactoryGeneratorT<CALOROCDigitization_factory>(
+        "EcalBarrelScFiNCALOROCHits", {"EcalBarrelScFiNCombinedPulses"},
+        {"EcalBarrelScFiNCALOROCHits"},
+        {
+            .adc_phase            = EcalBarrelScFi_adc_phase,
+            .toa_thres            = EcalBarrelScFi_toa_thres,
+            .tot_thres            = EcalBarrelScFi_tot_thres,
+            .dyRangeSingleGainADC = EcalBarrelScFi_dyRangeSingleGainADC,
+            .dyRangeHighGainADC   = EcalBarrelScFi_dyRangeHighGainADC,
+            .dyRangeLowGainADC    = EcalBarrelScFi_dyRangeLowGainADC,
+        },
+        app // TODO: Remove me once fixed
+        ));
+#endif
+  }
+  // Noisy N pulses, which are not digitized
   app->Add(new JOmniFactoryGeneratorT<PulseNoise_factory>(
       "EcalBarrelScFiNCombinedPulsesWithNoise", {"EventHeader", "EcalBarrelScFiNCombinedPulses"},
       {"EcalBarrelScFiNCombinedPulsesWithNoise"},
@@ -187,34 +293,6 @@ void InitPlugin(JApplication* app) {
       },
       app // TODO: Remove me once fixed
       ));
-#if EDM4EIC_VERSION_MAJOR > 8 || (EDM4EIC_VERSION_MAJOR == 8 && EDM4EIC_VERSION_MINOR >= 7)
-  app->Add(new JOmniFactoryGeneratorT<CALOROCDigitization_factory>(
-      "EcalBarrelScFiPCALOROCHits", {"EcalBarrelScFiPCombinedPulsesWithNoise"},
-      {"EcalBarrelScFiPCALOROCHits"},
-      {
-          .adc_phase            = EcalBarrelScFi_adc_phase,
-          .toa_thres            = EcalBarrelScFi_toa_thres,
-          .tot_thres            = EcalBarrelScFi_tot_thres,
-          .dyRangeSingleGainADC = EcalBarrelScFi_dyRangeSingleGainADC,
-          .dyRangeHighGainADC   = EcalBarrelScFi_dyRangeHighGainADC,
-          .dyRangeLowGainADC    = EcalBarrelScFi_dyRangeLowGainADC,
-      },
-      app // TODO: Remove me once fixed
-      ));
-  app->Add(new JOmniFactoryGeneratorT<CALOROCDigitization_factory>(
-      "EcalBarrelScFiNCALOROCHits", {"EcalBarrelScFiNCombinedPulses"},
-      {"EcalBarrelScFiNCALOROCHits"},
-      {
-          .adc_phase            = EcalBarrelScFi_adc_phase,
-          .toa_thres            = EcalBarrelScFi_toa_thres,
-          .tot_thres            = EcalBarrelScFi_tot_thres,
-          .dyRangeSingleGainADC = EcalBarrelScFi_dyRangeSingleGainADC,
-          .dyRangeHighGainADC   = EcalBarrelScFi_dyRangeHighGainADC,
-          .dyRangeLowGainADC    = EcalBarrelScFi_dyRangeLowGainADC,
-      },
-      app // TODO: Remove me once fixed
-      ));
-#endif
   app->Add(new JOmniFactoryGeneratorT<CalorimeterHitDigi_factory>(
       "EcalBarrelScFiRawHits", {"EventHeader", "EcalBarrelScFiHits"},
       {"EcalBarrelScFiRawHits", "EcalBarrelScFiRawHitLinks", "EcalBarrelScFiRawHitAssociations"},
@@ -33,6 +33,11 @@ private:
   ParameterRef<double> m_pedSigmaADC{this, "pedestalSigma", config().pedSigmaADC};
   ParameterRef<double> m_resolutionTDC{this, "resolutionTDC", config().resolutionTDC};
   ParameterRef<std::string> m_corrMeanScale{this, "scaleResponse", config().corrMeanScale};
+  ParameterRef<bool> m_zeroSuppression{this, "zeroSuppression", config().zeroSuppression};
+  ParameterRef<double> m_zeroSuppressionThresholdFactor{this, "zeroSuppressionThresholdFactor",
+                                                        config().zeroSuppressionThresholdFactor};
+  ParameterRef<double> m_zeroSuppressionThresholdValue{this, "zeroSuppressionThresholdValue",
+                                                       config().zeroSuppressionThresholdValue};
   ParameterRef<std::vector<std::string>> m_fields{this, "signalSumFields", config().fields};
   ParameterRef<std::string> m_readout{this, "readoutClass", config().readout};
   ParameterRef<std::string> m_readoutType{this, "readoutType", config().readoutType};
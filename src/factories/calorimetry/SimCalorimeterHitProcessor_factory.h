@@ -19,13 +19,15 @@ private:
   std::unique_ptr<AlgoT> m_algo;
 
   PodioInput<edm4hep::SimCalorimeterHit> m_hits_input{this};
-  PodioOutput<edm4hep::SimCalorimeterHit> m_hits_output{this};
-  PodioOutput<edm4hep::CaloHitContribution> m_hits_contribs_output{this};
+  // one hit and one contribution collection per readout end, in the order of
+  // attenuationReferencePositionNames
+  VariadicPodioOutput<edm4hep::SimCalorimeterHit> m_hits_output{this};
+  VariadicPodioOutput<edm4hep::CaloHitContribution> m_hits_contribs_output{this};
 
   ParameterRef<std::vector<double>> m_attenuationParameters{this, "attenuationParameters",
                                                             config().attenuationParameters};
-  ParameterRef<std::string> m_attenuationReferencePositionName{
-      this, "attenuationReferencePositionName", config().attenuationReferencePositionName};
+  ParameterRef<std::vector<std::string>> m_attenuationReferencePositionNames{
+      this, "attenuationReferencePositionNames", config().attenuationReferencePositionNames};
   ParameterRef<std::vector<std::string>> m_hitMergeFields{this, "hitMergeFields",
                                                           config().hitMergeFields};
   ParameterRef<std::vector<std::string>> m_contributionMergeFields{
@@ -47,7 +49,15 @@ public:
   }
 
   void Process(int32_t /* run_number */, uint64_t /* event_number */) {
-    m_algo->process({m_hits_input()}, {m_hits_output().get(), m_hits_contribs_output().get()});
+    std::vector<gsl::not_null<edm4hep::SimCalorimeterHitCollection*>> hits_collections;
+    for (const auto& hits : m_hits_output()) {
+      hits_collections.emplace_back(hits.get());
+    }
+    std::vector<gsl::not_null<edm4hep::CaloHitContributionCollection*>> contribs_collections;
+    for (const auto& contribs : m_hits_contribs_output()) {
+      contribs_collections.emplace_back(contribs.get());
+    }
+    m_algo->process({m_hits_input()}, {hits_collections, contribs_collections});
   }
 };
 
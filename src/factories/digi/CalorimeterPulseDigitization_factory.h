@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <edm4eic/EDM4eicVersion.h>
+#include "algorithms/digi/CalorimeterPulseDigitization.h"
+#include "services/algorithms_init/AlgorithmsInit_service.h"
+#include "extensions/jana/JOmniFactory.h"
+
+namespace eicrecon {
+
+class CalorimeterPulseDigitization_factory
+    : public JOmniFactory<CalorimeterPulseDigitization_factory,
+                          CalorimeterPulseDigitizationConfig> {
+
+public:
+  using AlgoT = eicrecon::CalorimeterPulseDigitization;
+
+private:
+  std::unique_ptr<AlgoT> m_algo;
+
+  PodioInput<edm4hep::EventHeader> m_in_headers{this};
+  PodioInput<edm4hep::SimCalorimeterHit> m_in_sim_hits{this};
+  PodioOutput<edm4eic::RawCALOROCHit> m_digi_output{this};
+  // Optional generated and combined pulses, followed by the noisy pulses if added
+  VariadicPodioOutput<edm4eic::SimPulse> m_pulse_output{this};
+
+  // Same parameter names as the PulseGeneration, PulseCombiner, PulseNoise and
+  // CALOROCDigitization factories
+  ParameterRef<std::string> m_pulse_shape_function{this, "pulseShapeFunction",
+                                                   config().generation.pulse_shape_function};
+  ParameterRef<std::vector<double>> m_pulse_shape_params{this, "pulseShapeParams",
+                                                         config().generation.pulse_shape_params};
+  ParameterRef<double> m_timestep{this, "timestep", config().generation.timestep};
+  ParameterRef<double> m_ignore_thres{this, "ignoreThreshold", config().generation.ignore_thres};
+  ParameterRef<double> m_min_sampling_time{this, "minSamplingTime",
+                                           config().generation.min_sampling_time};
+  ParameterRef<uint32_t> m_max_time_bins{this, "maxTimeBins", config().generation.max_time_bins};
+  ParameterRef<uint32_t> m_template_oversampling{this, "templateOversampling",
+                                                 config().generation.template_oversampling};
+  ParameterRef<double> m_template_tolerance{this, "templateTolerance",
+                                            config().generation.template_tolerance};
+
+  ParameterRef<double> m_minimum_separation{this, "minimumSeperation",
+                                            config().combiner.minimum_separation};
+  ParameterRef<std::string> m_readout{this, "readout", config().combiner.readout};
+  ParameterRef<std::string> m_combine_field{this, "combineField", config().combiner.combine_field};
+
+  ParameterRef<bool> m_add_noise{this, "addNoise", config().add_noise};
+  ParameterRef<std::size_t> m_poles{this, "poles", config().noise.poles};
+  ParameterRef<double> m_variance{this, "variance", config().noise.variance};
+  ParameterRef<double> m_alpha{this, "alpha", config().noise.alpha};
+  ParameterRef<double> m_scale{this, "scale", config().noise.scale};
+  ParameterRef<double> m_pedestal{this, "pedestal", config().noise.pedestal};
+
+  ParameterRef<double> m_time_window{this, "timeWindow", config().digitization.time_window};
+  ParameterRef<double> m_adc_phase{this, "adcPhase", config().digitization.adc_phase};
+  ParameterRef<double> m_toa_thres{this, "toaThres", config().digitization.toa_thres};
+  ParameterRef<double> m_tot_thres{this, "totThres", config().digitization.tot_thres};
+  ParameterRef<unsigned int> m_capADC{this, "capADC", config().digitization.capADC};
+  ParameterRef<double> m_dyRangeSingleGainADC{this, "dyRangeSingleGainADC",
+                                              config().digitization.dyRangeSingleGainADC};
+  ParameterRef<double> m_dyRangeHighGainADC{this, "dyRangeHighGainADC",
+                                            config().digitization.dyRangeHighGainADC};
+  ParameterRef<double> m_dyRangeLowGainADC{this, "dyRangeLowGainADC",
+                                           config().digitization.dyRangeLowGainADC};
+  ParameterRef<unsigned int> m_capTOA{this, "capTOA", config().digitization.capTOA};
+  ParameterRef<double> m_dyRangeTOA{this, "dyRangeTOA", config().digitization.dyRangeTOA};
+  ParameterRef<unsigned int> m_capTOT{this, "capTOT", config().digitization.capTOT};
+  ParameterRef<double> m_dyRangeTOT{this, "dyRangeTOT", config().digitization.dyRangeTOT};
+
+  Service<AlgorithmsInit_service> m_algorithmsInit{this};
+
+public:
+  void Configure() {
+    m_algo = std::make_unique<AlgoT>(GetPrefix());
+    m_algo->level(static_cast<algorithms::LogLevel>(logger()->level()));
+    m_algo->applyConfig(config());
+    m_algo->init();
+  }
+
+  void Process(int32_t /* run_number */, uint64_t /* event_number */) {
+    std::vector<gsl::not_null<edm4eic::SimPulseCollection*>> pulses;
+    for (const auto& pulse_collection : m_pulse_output()) {
+      pulses.emplace_back(pulse_collection.get());
+    }
+    m_algo->process({m_in_headers(), m_in_sim_hits()}, {m_digi_output().get(), pulses});
+  }
+};
+
+} // namespace eicrecon
@@ -7,14 +7,19 @@
 #include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
 #include <edm4eic/EDM4eicVersion.h>
 #include <edm4eic/RawTrackerHitCollection.h>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 // algorithms
+#include "algorithms/digi/NoiseLibrary.h"
 #include "algorithms/digi/PhotoMultiplierHitDigi.h"
 #include "algorithms/digi/PhotoMultiplierHitDigiConfig.h"
+#include "algorithms/interfaces/CounterRNG.h"
+#include "algorithms/interfaces/UniqueIDGenSvc.h"
 // JANA
 #include "extensions/jana/JOmniFactory.h"
 // services
@@ -55,6 +60,9 @@ private:
   ParameterRef<bool> m_enableNoise{this, "enableNoise", config().enableNoise, ""};
   ParameterRef<double> m_noiseRate{this, "noiseRate", config().noiseRate, ""};
   ParameterRef<double> m_noiseTimeWindow{this, "noiseTimeWindow", config().noiseTimeWindow, ""};
+  ParameterRef<std::size_t> m_noiseLibrarySize{
+      this, "noiseLibrarySize", config().noiseLibrarySize,
+      "number of pre-generated noise patterns (0: sample noise pixels every event)"};
   //ParameterRef<std::vector<std::pair<double, double>>> m_quantumEfficiency {this, "quantumEfficiency", config().quantumEfficiency, ""};
 
   Service<AlgorithmsInit_service> m_algorithmsInit{this};
@@ -67,13 +75,29 @@ public:
 
     // Initialize richgeo ReadoutGeo and set random CellID visitor lambda (if a RICH)
     if (GetPluginName() == "DRICH" || GetPluginName() == "PFRICH") {
-      m_RichGeoSvc().GetReadoutGeo(config().detectorName, config().readoutClass);
-      m_algo->SetVisitRngCellIDs(
-          [this](std::function<void(PhotoMultiplierHitDigi::CellIDType)> lambda, float p) {
-            m_RichGeoSvc()
-                .GetReadoutGeo(config().detectorName, config().readoutClass)
-                ->VisitAllRngPixels(lambda, p);
-          });
+      auto readoutGeo = m_RichGeoSvc().GetReadoutGeo(config().detectorName, config().readoutClass);
+      if (config().enableNoise && config().noiseLibrarySize > 0) {
+        // draw noise from a library of patterns, generated once for this factory
+        const double p = config().noiseRate * config().noiseTimeWindow;
+        auto library   = std::make_shared<const NoiseLibrary>(
+            readoutGeo->NumPixels(), p * readoutGeo->NumPixels(), config().noiseLibrarySize,
+            algorithms::UniqueIDGenSvc::instance().getStreamKey(GetPrefix()));
+        m_algo->SetRngCellIDs([readoutGeo, library](
+                                  std::vector<PhotoMultiplierHitDigi::CellIDType>& cellIDs,
+                                  double /* p */, std::uint64_t seed) {
+          CounterRNG rng(seed, 0);
+          thread_local std::vector<std::uint64_t> indices;
+          library->draw(rng, indices);
+          readoutGeo->PixelCellIDs(indices, cellIDs);
+        });
+      } else {
+        m_algo->SetRngCellIDs([this](std::vector<PhotoMultiplierHitDigi::CellIDType>& cellIDs,
+                                     double p, std::uint64_t seed) {
+          m_RichGeoSvc()
+              .GetReadoutGeo(config().detectorName, config().readoutClass)
+              ->RandomCellIDs(cellIDs, p, seed);
+        });
+      }
       m_algo->SetPixelGapMask(
           [this](PhotoMultiplierHitDigi::CellIDType cellID, dd4hep::Position pos) {
             return m_RichGeoSvc()
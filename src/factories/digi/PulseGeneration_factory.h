@@ -37,6 +37,10 @@ private:
       this, "minSamplingTime", this->config().min_sampling_time};
   typename FactoryT::template ParameterRef<uint32_t> m_max_time_bins{this, "maxTimeBins",
                                                                      this->config().max_time_bins};
+  typename FactoryT::template ParameterRef<uint32_t> m_template_oversampling{
+      this, "templateOversampling", this->config().template_oversampling};
+  typename FactoryT::template ParameterRef<double> m_template_tolerance{
+      this, "templateTolerance", this->config().template_tolerance};
 
   typename FactoryT::template Service<AlgorithmsInit_service> m_algorithmsInit{this};
 
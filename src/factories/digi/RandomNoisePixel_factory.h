@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include <edm4hep/EventHeader.h>
 
@@ -29,6 +31,12 @@ private:
   ParameterRef<double> m_noise_rate{this, "noiseRate", config().noise_rate_per_pixel_per_event,
                                     "Noise occupancy per pixel per event"};
   ParameterRef<std::string> m_readout_name{this, "readout_name", config().readout_name};
+  ParameterRef<std::size_t> m_noise_library_size{
+      this, "noiseLibrarySize", config().noise_library_size,
+      "Number of pre-generated noise patterns per layer (0: sample pixels every event)"};
+  ParameterRef<std::string> m_noise_library_file{
+      this, "noiseLibraryFile", config().noise_library_file,
+      "Noise pattern library, read if it exists and written after generation otherwise"};
 
 public:
   void Configure() {
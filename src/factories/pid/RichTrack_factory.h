@@ -16,6 +16,7 @@
 #include <vector>
 
 // algorithms
+#include "algorithms/tracking/StepperType.h"
 #include "algorithms/tracking/TrackPropagation.h"
 #include "algorithms/tracking/TrackPropagationConfig.h"
 #include "extensions/jana/JOmniFactory.h"
@@ -35,6 +36,10 @@ private:
   Input<Acts::ConstVectorTrackContainer> m_acts_tracks_input{this};
   PodioOutput<edm4eic::TrackSegment> m_track_segments_output{this};
 
+  ParameterRef<StepperType> m_stepper{
+      this, "stepper", config().stepper,
+      "Acts stepper of the propagation: eigen, sympy, atlas or straight_line"};
+
   Service<DD4hep_service> m_GeoSvc{this};
   Service<ACTSGeo_service> m_ACTSGeoSvc{this};
 
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "algorithms/tracking/ActsToTracks.h"
+#include "algorithms/tracking/TrackerHitAssociationIndex.h"
 #include "extensions/jana/JOmniFactory.h"
 
 namespace eicrecon {
@@ -23,7 +24,7 @@ private:
   PodioInput<edm4eic::TrackSeed> m_seeds_input{this};
   Input<Acts::ConstVectorMultiTrajectory> m_acts_track_states_input{this};
   Input<Acts::ConstVectorTrackContainer> m_acts_tracks_input{this};
-  PodioInput<edm4eic::MCRecoTrackerHitAssociation> m_raw_hit_assocs_input{this};
+  Input<TrackerHitAssociationIndex> m_raw_hit_assoc_index_input{this};
   PodioOutput<edm4eic::Trajectory> m_trajectories_output{this};
   PodioOutput<edm4eic::TrackParameters> m_parameters_output{this};
   PodioOutput<edm4eic::Track> m_tracks_output{this};
@@ -41,18 +42,20 @@ public:
   void Process(int32_t /* run_number */, uint64_t /* event_number */) {
     auto track_states_vec = m_acts_track_states_input();
     auto tracks_vec       = m_acts_tracks_input();
+    auto assoc_index_vec  = m_raw_hit_assoc_index_input();
     assert(!track_states_vec.empty() && "ConstVectorMultiTrajectory vector should not be empty");
     assert(track_states_vec.front() != nullptr &&
            "ConstVectorMultiTrajectory pointer should not be null");
     assert(!tracks_vec.empty() && "ConstVectorTrackContainer vector should not be empty");
     assert(tracks_vec.front() != nullptr && "ConstVectorTrackContainer pointer should not be null");
+    assert(!assoc_index_vec.empty() && "TrackerHitAssociationIndex vector should not be empty");
     m_algo->process(
         {
             m_measurements_input(),
             m_seeds_input(),
             track_states_vec.front(),
             tracks_vec.front(),
-            m_raw_hit_assocs_input(),
+            assoc_index_vec.front(),
         },
         {
             m_trajectories_output().get(),
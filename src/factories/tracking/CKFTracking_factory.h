@@ -15,6 +15,8 @@
 
 #include "algorithms/tracking/CKFTracking.h"
 #include "algorithms/tracking/CKFTrackingConfig.h"
+#include "algorithms/tracking/MeasurementSourceLinkIndex.h"
+#include "algorithms/tracking/StepperType.h"
 #include "extensions/jana/JOmniFactory.h"
 #include "services/geometry/acts/ACTSGeo_service.h"
 
@@ -28,6 +30,7 @@ private:
 
   PodioInput<edm4eic::TrackSeed> m_seeds_input{this};
   PodioInput<edm4eic::Measurement2D> m_measurements_input{this};
+  Input<MeasurementSourceLinkIndex> m_source_link_index_input{this};
   Output<Acts::ConstVectorMultiTrajectory> m_acts_trajectories_output{this};
   Output<Acts::ConstVectorTrackContainer> m_acts_tracks_output{this};
 
@@ -41,6 +44,12 @@ private:
   ParameterRef<std::size_t> m_numMeasurementsMin{
       this, "NumMeasurementsMin", config().numMeasurementsMin,
       "Minimum number of measurements for ACTS CKF tracking"};
+  ParameterRef<StepperType> m_stepper{
+      this, "Stepper", config().stepper,
+      "Acts stepper of the track finding: eigen or sympy"};
+  ParameterRef<std::size_t> m_numThreads{
+      this, "NumThreads", config().numThreads,
+      "Number of threads finding tracks of one event in parallel over seeds (1: serial)"};
 
   Service<ACTSGeo_service> m_ACTSGeoSvc{this};
 
@@ -53,7 +62,8 @@ public:
   }
 
   void Process(int32_t /* run_number */, uint64_t /* event_number */) {
-    m_algo->process(AlgoT::Input{m_seeds_input(), m_measurements_input()},
+    m_algo->process(AlgoT::Input{m_seeds_input(), m_measurements_input(),
+                                 m_source_link_index_input().front()},
                     AlgoT::Output{&m_acts_trajectories_output().emplace_back(),
                                   &m_acts_tracks_output().emplace_back()});
   }
@@ -16,6 +16,7 @@
 
 #include "algorithms/tracking/IterativeVertexFinderConfig.h"
 #include "algorithms/tracking/IterativeVertexFinder.h"
+#include "algorithms/tracking/StepperType.h"
 #include "extensions/jana/JOmniFactory.h"
 
 namespace eicrecon {
@@ -40,6 +41,9 @@ private:
   ParameterRef<unsigned int> m_minTrackHits{
       this, "minTrackHits", config().minTrackHits,
       "Minimum number of hits to require for the tracks used"};
+  ParameterRef<StepperType> m_stepper{
+      this, "stepper", config().stepper,
+      "Acts stepper of the propagation: eigen, sympy, atlas or straight_line"};
 
   Service<ACTSGeo_service> m_ACTSGeoSvc{this};
 
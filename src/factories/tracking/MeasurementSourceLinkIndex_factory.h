@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#pragma once
+
+#include <edm4eic/Measurement2DCollection.h>
+#include <memory>
+
+#include "algorithms/tracking/MeasurementSourceLinkIndex.h"
+#include "algorithms/tracking/MeasurementSourceLinkIndexer.h"
+#include "extensions/jana/JOmniFactory.h"
+
+namespace eicrecon {
+
+class MeasurementSourceLinkIndex_factory
+    : public JOmniFactory<MeasurementSourceLinkIndex_factory, NoConfig> {
+public:
+  using AlgoT = eicrecon::MeasurementSourceLinkIndexer;
+
+private:
+  std::unique_ptr<AlgoT> m_algo;
+
+  PodioInput<edm4eic::Measurement2D> m_measurements_input{this};
+  Output<MeasurementSourceLinkIndex> m_index_output{this};
+
+public:
+  void Configure() {
+    m_algo = std::make_unique<AlgoT>(this->GetPrefix());
+    m_algo->level(static_cast<algorithms::LogLevel>(logger()->level()));
+    m_algo->applyConfig(config());
+    m_algo->init();
+  }
+
+  void Process(int32_t /* run_number */, uint64_t /* event_number */) {
+    m_algo->process({m_measurements_input()}, {&m_index_output().emplace_back()});
+  }
+};
+
+} // namespace eicrecon
@@ -15,6 +15,7 @@
 
 #include "algorithms/tracking/SecondaryVertexFinderConfig.h"
 #include "algorithms/tracking/SecondaryVertexFinder.h"
+#include "algorithms/tracking/StepperType.h"
 #include "extensions/jana/JOmniFactory.h"
 
 namespace eicrecon {
@@ -43,6 +44,9 @@ private:
   ParameterRef<float> m_maxDistToLinPoint{
       this, "maxDistToLinPoint", config().maxDistToLinPoint,
       "Max disttance to line point (pca) for Acts::AdaptiveMultivertexFinder"};
+  ParameterRef<StepperType> m_stepper{
+      this, "stepper", config().stepper,
+      "Acts stepper of the propagation: eigen, sympy, atlas or straight_line"};
 
   Service<ACTSGeo_service> m_ACTSGeoSvc{this};
 
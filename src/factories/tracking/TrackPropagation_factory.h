@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "algorithms/interfaces/WithPodConfig.h"
+#include "algorithms/tracking/StepperType.h"
 #include "algorithms/tracking/TrackPropagation.h"
 #include "algorithms/tracking/TrackPropagationConfig.h"
 #include "extensions/jana/JOmniFactory.h"
@@ -33,6 +34,10 @@ private:
   Input<Acts::ConstVectorTrackContainer> m_acts_tracks_input{this};
   PodioOutput<edm4eic::TrackSegment> m_track_segments_output{this};
 
+  ParameterRef<StepperType> m_stepper{
+      this, "stepper", config().stepper,
+      "Acts stepper of the propagation: eigen, sympy, atlas or straight_line"};
+
   Service<DD4hep_service> m_GeoSvc{this};
   Service<ACTSGeo_service> m_ACTSGeoSvc{this};
 
@@ -5,6 +5,7 @@
 
 #include <JANA/JEvent.h>
 #include <edm4eic/TrackParametersCollection.h>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -86,6 +87,12 @@ private:
       "max radius for middle space point for Acts::OrthogonalSeedFinder"};
   ParameterRef<float> m_deltaPhiMax{this, "deltaPhiMax", config().deltaPhiMax,
                                     "Max phi difference between middle and top/bottom space point"};
+  ParameterRef<std::size_t> m_numPhiSectors{
+      this, "numPhiSectors", config().numPhiSectors,
+      "Number of overlapping phi sectors searched for seeds independently (1: no sectors)"};
+  ParameterRef<std::size_t> m_numThreads{
+      this, "numThreads", config().numThreads,
+      "Number of threads searching phi sectors of one event in parallel"};
   ParameterRef<float> m_locaError{this, "loc_a_Error", config().locaError,
                                   "Error on Loc a for Acts::OrthogonalSeedFinder"};
   ParameterRef<float> m_locbError{this, "loc_b_Error", config().locbError,
@@ -34,11 +34,13 @@
 #include "factories/tracking/AmbiguitySolver_factory.h"
 #include "factories/tracking/CKFTracking_factory.h"
 #include "factories/tracking/IterativeVertexFinder_factory.h"
+#include "factories/tracking/MeasurementSourceLinkIndex_factory.h"
 #include "factories/tracking/SecondaryVertexFinder_factory.h"
 #include "factories/tracking/TrackParamTruthInit_factory.h"
 #include "factories/tracking/TrackProjector_factory.h"
 #include "factories/tracking/TrackPropagation_factory.h"
 #include "factories/tracking/TrackSeeding_factory.h"
+#include "factories/tracking/TrackerHitAssociationIndex_factory.h"
 #include "factories/tracking/TrackerMeasurementFromHits_factory.h"
 #include "factories/tracking/TracksToParticles_factory.h"
 
@@ -87,6 +89,11 @@ void InitPlugin(JApplication* app) {
       {"CentralTrackingRawHitAssociations"}, // Output collection name
       app));
 
+  // Association index shared by the truth matching of all central track conversions
+  app->Add(new JOmniFactoryGeneratorT<TrackerHitAssociationIndex_factory>(
+      "CentralTrackingRawHitAssociationIndex", {"CentralTrackingRawHitAssociations"},
+      {"CentralTrackingRawHitAssociationIndex"}, app));
+
   // Tracker hit links collector
   app->Add(
       new JOmniFactoryGeneratorT<CollectionCollector_factory<edm4eic::MCRecoTrackerHitLink, true>>(
@@ -109,9 +116,15 @@ void InitPlugin(JApplication* app) {
       {"CentralTrackerMeasurements"}, // Output collection name
       app));
 
+  // Source link index shared by the CKF passes over the central tracker measurements
+  app->Add(new JOmniFactoryGeneratorT<MeasurementSourceLinkIndex_factory>(
+      "CentralTrackerMeasurementSourceLinks", {"CentralTrackerMeasurements"},
+      {"CentralTrackerMeasurementSourceLinks"}, app));
+
   app->Add(new JOmniFactoryGeneratorT<CKFTracking_factory>(
       "CentralCKFTruthSeededTrajectories",
-      {"CentralTrackerTruthSeeds", "CentralTrackerMeasurements"},
+      {"CentralTrackerTruthSeeds", "CentralTrackerMeasurements",
+       "CentralTrackerMeasurementSourceLinks"},
       {
           "CentralCKFTruthSeededActsTrackStatesUnfiltered",
           "CentralCKFTruthSeededActsTracksUnfiltered",
@@ -125,7 +138,7 @@ void InitPlugin(JApplication* app) {
           "CentralTrackerTruthSeeds",
           "CentralCKFTruthSeededActsTrackStatesUnfiltered",
           "CentralCKFTruthSeededActsTracksUnfiltered",
-          "CentralTrackingRawHitAssociations",
+          "CentralTrackingRawHitAssociationIndex",
       },
       {
           "CentralCKFTruthSeededTrajectoriesUnfiltered",
@@ -153,7 +166,7 @@ void InitPlugin(JApplication* app) {
                                                            "CentralTrackerTruthSeeds",
                                                            "CentralCKFTruthSeededActsTrackStates",
                                                            "CentralCKFTruthSeededActsTracks",
-                                                           "CentralTrackingRawHitAssociations",
+                                                           "CentralTrackingRawHitAssociationIndex",
                                                        },
                                                        {
                                                            "CentralCKFTruthSeededTrajectories",
@@ -169,7 +182,8 @@ void InitPlugin(JApplication* app) {
       {"CentralTrackSeeds", "CentralTrackSeedParameters"}, {}, app));
 
   app->Add(new JOmniFactoryGeneratorT<CKFTracking_factory>(
-      "CentralCKFTrajectories", {"CentralTrackSeeds", "CentralTrackerMeasurements"},
+      "CentralCKFTrajectories",
+      {"CentralTrackSeeds", "CentralTrackerMeasurements", "CentralTrackerMeasurementSourceLinks"},
       {
           "CentralCKFActsTrackStatesUnfiltered",
           "CentralCKFActsTracksUnfiltered",
@@ -183,7 +197,7 @@ void InitPlugin(JApplication* app) {
                                                            "CentralTrackSeeds",
                                                            "CentralCKFActsTrackStatesUnfiltered",
                                                            "CentralCKFActsTracksUnfiltered",
-                                                           "CentralTrackingRawHitAssociations",
+                                                           "CentralTrackingRawHitAssociationIndex",
                                                        },
                                                        {
                                                            "CentralCKFTrajectoriesUnfiltered",
@@ -203,22 +217,23 @@ void InitPlugin(JApplication* app) {
       },
       app));
 
-  app->Add(new JOmniFactoryGeneratorT<ActsToTracks_factory>("CentralCKFTracks",
-                                                            {
-                                                                "CentralTrackerMeasurements",
-                                                                "CentralTrackSeeds",
-                                                                "CentralCKFActsTrackStates",
-                                                                "CentralCKFActsTracks",
-                                                                "CentralTrackingRawHitAssociations",
-                                                            },
-                                                            {
-                                                                "CentralCKFTrajectories",
-                                                                "CentralCKFTrackParameters",
-                                                                "CentralCKFTracks",
-                                                                "CentralCKFTrackLinks",
-                                                                "CentralCKFTrackAssociations",
-                                                            },
-                                                            app));
+  app->Add(new JOmniFactoryGeneratorT<ActsToTracks_factory>(
+      "CentralCKFTracks",
+      {
+          "CentralTrackerMeasurements",
+          "CentralTrackSeeds",
+          "CentralCKFActsTrackStates",
+          "CentralCKFActsTracks",
+          "CentralTrackingRawHitAssociationIndex",
+      },
+      {
+          "CentralCKFTrajectories",
+          "CentralCKFTrackParameters",
+          "CentralCKFTracks",
+          "CentralCKFTrackLinks",
+          "CentralCKFTrackAssociations",
+      },
+      app));
 
   app->Add(new JOmniFactoryGeneratorT<TrackProjector_factory>("CentralTrackSegments",
                                                               {
@@ -305,7 +320,7 @@ void InitPlugin(JApplication* app) {
                                       .zmin = "LFHCAL_zmin + 150*mm",
                                       .rmin = 0.,
                                       .rmax = "1.1*LFHCAL_rmax"},
-      }},
+       }},
       app));
 
   // B0 TRACKER
@@ -313,8 +328,19 @@ void InitPlugin(JApplication* app) {
   app->Add(new JOmniFactoryGeneratorT<TrackerMeasurementFromHits_factory>(
       "B0TrackerMeasurements", {"B0TrackerRecHits"}, {"B0TrackerMeasurements"}, app));
 
+  // Source link index shared by the CKF passes over the B0 tracker measurements
+  app->Add(new JOmniFactoryGeneratorT<MeasurementSourceLinkIndex_factory>(
+      "B0TrackerMeasurementSourceLinks", {"B0TrackerMeasurements"},
+      {"B0TrackerMeasurementSourceLinks"}, app));
+
+  // Association index shared by the truth matching of all B0 tracker track conversions
+  app->Add(new JOmniFactoryGeneratorT<TrackerHitAssociationIndex_factory>(
+      "B0TrackerRawHitAssociationIndex", {"B0TrackerRawHitAssociations"},
+      {"B0TrackerRawHitAssociationIndex"}, app));
+
   app->Add(new JOmniFactoryGeneratorT<CKFTracking_factory>(
-      "B0TrackerCKFTruthSeededTrajectories", {"B0TrackerTruthSeeds", "B0TrackerMeasurements"},
+      "B0TrackerCKFTruthSeededTrajectories",
+      {"B0TrackerTruthSeeds", "B0TrackerMeasurements", "B0TrackerMeasurementSourceLinks"},
       {
           "B0TrackerCKFTruthSeededActsTrackStatesUnfiltered",
           "B0TrackerCKFTruthSeededActsTracksUnfiltered",
@@ -331,7 +357,7 @@ void InitPlugin(JApplication* app) {
           "B0TrackerTruthSeeds",
           "B0TrackerCKFTruthSeededActsTrackStatesUnfiltered",
           "B0TrackerCKFTruthSeededActsTracksUnfiltered",
-          "B0TrackerRawHitAssociations",
+          "B0TrackerRawHitAssociationIndex",
       },
       {
           "B0TrackerCKFTruthSeededTrajectoriesUnfiltered",
@@ -362,7 +388,7 @@ void InitPlugin(JApplication* app) {
           "B0TrackerTruthSeeds",
           "B0TrackerCKFTruthSeededActsTrackStates",
           "B0TrackerCKFTruthSeededActsTracks",
-          "B0TrackerRawHitAssociations",
+          "B0TrackerRawHitAssociationIndex",
       },
       {
           "B0TrackerCKFTruthSeededTrajectories",
@@ -378,7 +404,8 @@ void InitPlugin(JApplication* app) {
       app));
 
   app->Add(new JOmniFactoryGeneratorT<CKFTracking_factory>(
-      "B0TrackerCKFTrajectories", {"B0TrackerSeeds", "B0TrackerMeasurements"},
+      "B0TrackerCKFTrajectories",
+      {"B0TrackerSeeds", "B0TrackerMeasurements", "B0TrackerMeasurementSourceLinks"},
       {
           "B0TrackerCKFActsTrackStatesUnfiltered",
           "B0TrackerCKFActsTracksUnfiltered",
@@ -392,7 +419,7 @@ void InitPlugin(JApplication* app) {
           "B0TrackerSeeds",
           "B0TrackerCKFActsTrackStatesUnfiltered",
           "B0TrackerCKFActsTracksUnfiltered",
-          "B0TrackerRawHitAssociations",
+          "B0TrackerRawHitAssociationIndex",
       },
       {
           "B0TrackerCKFTrajectoriesUnfiltered",
@@ -418,7 +445,7 @@ void InitPlugin(JApplication* app) {
                                                                 "B0TrackerSeeds",
                                                                 "B0TrackerCKFActsTrackStates",
                                                                 "B0TrackerCKFActsTracks",
-                                                                "B0TrackerRawHitAssociations",
+                                                                "B0TrackerRawHitAssociationIndex",
                                                             },
                                                             {
                                                                 "B0TrackerCKFTrajectories",
@@ -13,6 +13,7 @@
 #include <spdlog/logger.h>
 
 #include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/interfaces/DataModeSvc.h"
 #include "algorithms/interfaces/UniqueIDGenSvc.h"
 #include "services/geometry/acts/ACTSGeo_service.h"
 #include "services/geometry/dd4hep/DD4hep_service.h"
@@ -100,6 +101,15 @@ public:
     }
     serviceSvc.add<algorithms::UniqueIDGenSvc>(&uniqueIDGenSvc);
 
+    // Register the data mode service
+    auto& dataModeSvc = algorithms::DataModeSvc::instance();
+    bool data_only    = false;
+    this->GetApplication()->SetDefaultParameter(
+        "eicrecon:data_only", data_only,
+        "Skip MC truth links, associations and truth matching (empty association collections)");
+    dataModeSvc.setProperty("data_only", data_only);
+    serviceSvc.add<algorithms::DataModeSvc>(&dataModeSvc);
+
     // Finally, initialize the ServiceSvc
     serviceSvc.init();
   }
@@ -18,10 +18,13 @@
 #include <TGeoMatrix.h>
 #include <fmt/core.h>
 #include <fmt/format.h>
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <utility>
 
+#include "algorithms/digi/NoiseLibrary.h"
+#include "algorithms/interfaces/CounterRNG.h"
 #include "services/geometry/richgeo/RichGeo.h"
 
 // constructor
@@ -37,14 +40,12 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, std::string readoutClass_,
     , m_detRich(m_det->detector(m_detName))
     , m_readoutCoder(m_det->readout(m_readoutClass).idSpec().decoder())
     , m_systemID(m_detRich.id()) {
-  // random number generators
-  m_random.SetSeed(1); // default seed
-
   // default (empty) cellID looper
   m_loopCellIDs = [](std::function<void(CellIDType)> /* lambda */) { return; };
 
-  // default (empty) cellID rng generator
-  m_rngCellIDs = [](std::function<void(CellIDType)> /* lambda */, float /* p */) { return; };
+  // default (empty) flat pixel index converter
+  m_pixelCellIDs = [](std::span<const std::uint64_t> /* indices */,
+                      std::vector<CellIDType>& cellIDs) { cellIDs.clear(); };
 
   // dRICH readout --------------------------------------------------------------------
   if (m_detName == "DRICH") {
@@ -84,22 +85,23 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, std::string readoutClass_,
       } // end sensor loop (for all sectors)
     }; // end definition of m_loopCellIDs
 
-    // define k random cell IDs generator
-    m_rngCellIDs = [this](std::function<void(CellIDType)> lambda, float p) {
-      m_log->trace("call RngReadoutPixels for systemID = {} = {}", m_systemID, m_detName);
-
-      int k = p * m_num_sec * m_num_pdus * m_num_sipms_per_pdu * m_num_px * m_num_px;
-
-      for (int i = 0; i < k; i++) {
-        int isec  = m_random.Uniform(0., m_num_sec);
-        int ipdu  = m_random.Uniform(0., m_num_pdus);
-        int isipm = m_random.Uniform(0., m_num_sipms_per_pdu);
-        int x     = m_random.Uniform(0., m_num_px);
-        int y     = m_random.Uniform(0., m_num_px);
-
-        auto cellID = cellIDEncoding(isec, ipdu, isipm, x, y);
-
-        lambda(cellID);
+    // define flat pixel index converter, with the pixel y index running fastest
+    m_num_pixels = static_cast<std::uint64_t>(m_num_sec) * m_num_pdus * m_num_sipms_per_pdu *
+                   m_num_px * m_num_px;
+    m_pixelCellIDs = [this](std::span<const std::uint64_t> indices,
+                            std::vector<CellIDType>& cellIDs) {
+      cellIDs.clear();
+      cellIDs.reserve(indices.size());
+      for (auto index : indices) {
+        int y = index % m_num_px;
+        index /= m_num_px;
+        int x = index % m_num_px;
+        index /= m_num_px;
+        int isipm = index % m_num_sipms_per_pdu;
+        index /= m_num_sipms_per_pdu;
+        int ipdu = index % m_num_pdus;
+        int isec = index / m_num_pdus;
+        cellIDs.push_back(cellIDEncoding(isec, ipdu, isipm, x, y));
       }
     };
 
@@ -116,6 +118,18 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, std::string readoutClass_,
   }
 }
 
+// random noisy pixels
+void richgeo::ReadoutGeo::RandomCellIDs(std::vector<CellIDType>& cellIDs, double p,
+                                        std::uint64_t seed) const {
+  m_log->trace("call RandomCellIDs for systemID = {} = {}", m_systemID, m_detName);
+
+  // the RNG state lives for this call only, so concurrent events do not share it
+  eicrecon::CounterRNG rng(seed, 0);
+  thread_local std::vector<std::uint64_t> indices;
+  eicrecon::sample_noise_pixels(rng, m_num_pixels, p * m_num_pixels, indices);
+  PixelCellIDs(indices, cellIDs);
+}
+
 // pixel gap mask
 // FIXME: generalize; this assumes the segmentation is `CartesianGridXY`
 bool richgeo::ReadoutGeo::PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global) const {
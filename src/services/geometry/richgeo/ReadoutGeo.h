@@ -13,12 +13,14 @@
 #include <DDRec/CellIDPositionConverter.h>
 #include <DDSegmentation/BitFieldCoder.h>
 #include <Parsers/Primitives.h>
-#include <TRandomGen.h>
 #include <spdlog/logger.h>
+#include <cstdint>
 #include <functional>
 #include <gsl/pointers>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 // local
 #include "RichGeo.h"
@@ -34,7 +36,7 @@ public:
   ~ReadoutGeo() {}
 
   // define cellID encoding
-  CellIDType cellIDEncoding(int isec, int ipdu, int isipm, int x, int y) {
+  CellIDType cellIDEncoding(int isec, int ipdu, int isipm, int x, int y) const {
     // encode cellID
     dd4hep::rec::CellID cellID_dd4hep;
     m_readoutCoder->set(cellID_dd4hep, "system", m_systemID);
@@ -51,11 +53,19 @@ public:
   // loop over readout pixels, executing `lambda(cellID)` on each
   void VisitAllReadoutPixels(std::function<void(CellIDType)> lambda) { m_loopCellIDs(lambda); }
 
-  // generated k rng cell IDs, executing `lambda(cellID)` on each
-  void VisitAllRngPixels(std::function<void(CellIDType)> lambda, float p) {
-    m_rngCellIDs(lambda, p);
+  // number of readout pixels, addressed by the flat pixel indices of `PixelCellIDs`
+  std::uint64_t NumPixels() const { return m_num_pixels; }
+
+  // convert flat pixel indices in [0, NumPixels()) to cellIDs, preserving their order
+  void PixelCellIDs(std::span<const std::uint64_t> indices,
+                    std::vector<CellIDType>& cellIDs) const {
+    m_pixelCellIDs(indices, cellIDs);
   }
 
+  // fill `cellIDs` with distinct random pixels, each one noisy with probability `p`; the
+  // number of pixels is Poisson distributed and only depends on the per-event `seed`
+  void RandomCellIDs(std::vector<CellIDType>& cellIDs, double p, std::uint64_t seed) const;
+
   // pixel gap mask
   bool PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global) const;
 
@@ -63,9 +73,6 @@ public:
   // IMPORTANT NOTE: this has only been tested for the dRICH; if you use it, test it carefully...
   dd4hep::Position GetSensorLocalPosition(CellIDType id, dd4hep::Position pos) const;
 
-  // set RNG seed
-  void SetSeed(unsigned long seed) { m_random.SetSeed(seed); }
-
 protected:
   // common objects
   std::shared_ptr<spdlog::logger> m_log;
@@ -84,11 +91,8 @@ protected:
 
   // local function to loop over cellIDs; defined in initialization and called by `VisitAllReadoutPixels`
   std::function<void(std::function<void(CellIDType)>)> m_loopCellIDs;
-  // local function to generate rng cellIDs; defined in initialization and called by `VisitAllRngPixels`
-  std::function<void(std::function<void(CellIDType)>, float)> m_rngCellIDs;
-
-private:
-  // random number generators
-  TRandomMixMax m_random;
+  // local function to convert flat pixel indices; defined in initialization and called by `PixelCellIDs`
+  std::function<void(std::span<const std::uint64_t>, std::vector<CellIDType>&)> m_pixelCellIDs;
+  std::uint64_t m_num_pixels = 0;
 };
 } // namespace richgeo
@@ -1,8 +1,11 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 // Copyright (C) 2024, Wouter Deconinck
 
+#include <DD4hep/DD4hepUnits.h>
 #include <DD4hep/DetElement.h>
 #include <DD4hep/Detector.h>
+#include <DD4hep/FieldTypes.h>
+#include <DD4hep/Fields.h>
 #include <DD4hep/Handle.h>
 #include <DD4hep/IDDescriptor.h>
 #include <DD4hep/Objects.h>
@@ -20,6 +23,7 @@
 #include <TGeoMaterial.h>
 #include <TGeoMedium.h>
 #include <algorithms/geo.h>
+#include <algorithms/interfaces/DataModeSvc.h>
 #include <algorithms/interfaces/UniqueIDGenSvc.h>
 #include <algorithms/random.h>
 #include <algorithms/service.h>
@@ -34,6 +38,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <numbers>
 #include <string>
 #include <utility>
 
@@ -51,6 +56,9 @@ public:
     readout.setIDDescriptor(id_desc);
     detector->add(id_desc);
     detector->add(readout);
+    // readout end positions, in dd4hep units (1000 mm)
+    detector->addConstant(dd4hep::Constant("MockCalorimeter_PositivePosZ", "100.0"));
+    detector->addConstant(dd4hep::Constant("MockCalorimeter_NegativePosZ", "-100.0"));
 
     detector->addConstant(dd4hep::Constant("MockTracker_ID", "2"));
     dd4hep::Readout readoutTracker(std::string("MockTrackerHits"));
@@ -68,7 +76,13 @@ public:
                                          "system:8,layer:4,module:12,sensor:10,x:40:-8,y:-16");
     //Create segmentation with 1x1 mm pixels
     dd4hep::Segmentation segmentation_Silicon("CartesianGridXY", "SiliconHitsSeg",
-                                              id_desc_tracker.decoder());
+                                              id_desc_Silicon.decoder());
+    {
+      auto* grid = dynamic_cast<dd4hep::DDSegmentation::CartesianGridXY*>(
+          segmentation_Silicon.segmentation());
+      grid->setGridSizeX(0.1); // 1 mm pitch in DD4hep units (cm)
+      grid->setGridSizeY(0.1);
+    }
     readoutSilicon.setIDDescriptor(id_desc_Silicon);
     readoutSilicon.setSegmentation(segmentation_Silicon);
     detector->add(id_desc_Silicon);
@@ -203,12 +217,51 @@ public:
     envPV.addPhysVolID("system", 3);
     det.setPlacement(envPV);
 
+    // Mock silicon sensors for SiliconChargeSharing: two 2.1 x 2.1 cm sensors downstream of
+    // the MPGD envelope, the second one rotated by 90 degrees around z
+    dd4hep::SensitiveDetector sdSilicon("MockSilicon", "tracker");
+    sdSilicon.setReadout(readoutSilicon);
+    detector->add(sdSilicon);
+
+    dd4hep::Box siliconSensorShape("silicon_sensor_shape", 1.05, 1.05, 0.01);
+    dd4hep::Volume siliconSensorVol("MockSiliconSensor", siliconSensorShape, detector->air());
+    siliconSensorVol.setSensitiveDetector(sdSilicon);
+    dd4hep::Box siliconEnvShape("silicon_env_shape", 2.0, 2.0, 2.0);
+    dd4hep::Volume siliconEnvVol("MockSiliconEnvelope", siliconEnvShape, detector->air());
+
+    dd4hep::DetElement siliconDet(worldDet, "MockSilicon", 4);
+    siliconDet.object<dd4hep::DetElement::Object>().flag |=
+        dd4hep::DetElement::Object::HAVE_SENSITIVE_DETECTOR;
+    for (int imod = 0; imod < 2; imod++) {
+      dd4hep::PlacedVolume sensorPV = siliconEnvVol.placeVolume(
+          siliconSensorVol, dd4hep::Transform3D(dd4hep::RotationZ(imod * std::numbers::pi / 2),
+                                                dd4hep::Position(0, 0, imod == 0 ? -1. : 1.)));
+      sensorPV.addPhysVolID("layer", 1);
+      sensorPV.addPhysVolID("module", imod);
+      sensorPV.addPhysVolID("sensor", 0);
+      dd4hep::DetElement sensorDE(siliconDet, "sensor_" + std::to_string(imod), imod);
+      sensorDE.setPlacement(sensorPV);
+    }
+    dd4hep::PlacedVolume siliconEnvPV =
+        worldVol.placeVolume(siliconEnvVol, dd4hep::Position(0, 0, 20.));
+    siliconEnvPV.addPhysVolID("system", 4);
+    siliconDet.setPlacement(siliconEnvPV);
+
+    // Uniform solenoid field, e.g. for the helix propagation of SecondaryVerticesHelix
+    auto* fieldObj       = new dd4hep::ConstantField();
+    fieldObj->field_type = dd4hep::CartesianField::MAGNETIC;
+    fieldObj->direction  = dd4hep::Direction(0., 0., 1.7 * dd4hep::tesla);
+    dd4hep::CartesianField field;
+    field.assign(fieldObj, "MockField", "constant");
+    detector->field().add(field);
+
     detector->endDocument();
 
     // NONE flag avoids auto-scanning; addSubdetector passes the correct Readout.
     dd4hep::VolumeManager vm(*detector, "tracking", detector->world(), dd4hep::Readout(),
                              dd4hep::VolumeManager::NONE);
     vm.addSubdetector(det, readoutMPGD);
+    vm.addSubdetector(siliconDet, readoutSilicon);
 
     m_detector = std::move(detector);
 
@@ -235,6 +288,9 @@ public:
     auto& uniqueIDSvc = algorithms::UniqueIDGenSvc::instance();
     serviceSvc.add<algorithms::UniqueIDGenSvc>(&uniqueIDSvc);
 
+    auto& dataModeSvc = algorithms::DataModeSvc::instance();
+    serviceSvc.add<algorithms::DataModeSvc>(&dataModeSvc);
+
     serviceSvc.init();
   }
 };
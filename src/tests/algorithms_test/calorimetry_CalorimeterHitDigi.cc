@@ -113,4 +113,46 @@ TEST_CASE("the clustering algorithm runs", "[CalorimeterHitDigi]") {
     // Verify weights are normalized (should be 1.0 for single hit)
     REQUIRE_THAT(rawlinks[0].getWeight(), Catch::Matchers::WithinAbs(1.0, EPSILON));
   }
+
+  SECTION("zero suppression drops hits below threshold with their links") {
+    cfg.capADC                        = 555;
+    cfg.dyRangeADC                    = 5.0 /* GeV */;
+    cfg.pedMeanADC                    = 123;
+    cfg.resolutionTDC                 = 1.0 * dd4hep::ns;
+    cfg.zeroSuppression               = true;
+    cfg.zeroSuppressionThresholdValue = 50;
+    algo.level(algorithms::LogLevel(spdlog::level::trace));
+    algo.applyConfig(cfg);
+    algo.init();
+
+    auto headers = std::make_unique<edm4hep::EventHeaderCollection>();
+    auto header  = headers->create(1, 1, 12345678, 1.0);
+
+    auto calohits = std::make_unique<edm4hep::CaloHitContributionCollection>();
+    auto simhits  = std::make_unique<edm4hep::SimCalorimeterHitCollection>();
+    // 1 GeV -> 111 ADC above pedestal, kept
+    auto hit_above = simhits->create(id_desc.encode({{"system", 255}, {"x", 0}, {"y", 0}}),
+                                     1.0 /* GeV */, edm4hep::Vector3f({0., 0., 0.}));
+    hit_above.addToContributions(
+        calohits->create(0, 1.0 /* GeV */, 7.0 /* ns */, edm4hep::Vector3f({0., 0., 0.})));
+    // 0.1 GeV -> 11 ADC above pedestal, suppressed
+    auto hit_below = simhits->create(id_desc.encode({{"system", 255}, {"x", 1}, {"y", 0}}),
+                                     0.1 /* GeV */, edm4hep::Vector3f({0., 0., 0.}));
+    hit_below.addToContributions(
+        calohits->create(0, 0.1 /* GeV */, 7.0 /* ns */, edm4hep::Vector3f({0., 0., 0.})));
+
+    auto rawhits   = std::make_unique<edm4hep::RawCalorimeterHitCollection>();
+    auto rawassocs = std::make_unique<edm4eic::MCRecoCalorimeterHitAssociationCollection>();
+    edm4eic::MCRecoCalorimeterHitLinkCollection rawlinks;
+    algo.process({headers.get(), simhits.get()}, {rawhits.get(), &rawlinks, rawassocs.get()});
+
+    REQUIRE((*rawhits).size() == 1);
+    REQUIRE((*rawhits)[0].getCellID() == hit_above.getCellID());
+    REQUIRE((*rawhits)[0].getAmplitude() == 123 + 111);
+
+    REQUIRE((*rawassocs).size() == 1);
+    REQUIRE((*rawassocs)[0].getSimHit() == hit_above);
+    REQUIRE(rawlinks.size() == 1);
+    REQUIRE(rawlinks[0].getTo() == hit_above);
+  }
 }
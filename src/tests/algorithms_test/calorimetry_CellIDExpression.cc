@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <DD4hep/Detector.h>
+#include <DD4hep/IDDescriptor.h>
+#include <DD4hep/Readout.h>
+#include <algorithms/geo.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "algorithms/calorimetry/CellIDExpression.h"
+
+using eicrecon::CellIDExpression;
+
+TEST_CASE("CellIDExpression memoizes per referenced fields", "[CellIDExpression]") {
+  auto detector = algorithms::GeoSvc::instance().detector();
+  auto id_desc  = detector->readout("MockCalorimeterHits").idSpec();
+
+  SECTION("constant expression") {
+    CellIDExpression expr;
+    expr.compile("0.5 * 2e-1", id_desc);
+    REQUIRE(expr.isConstant());
+    REQUIRE_THAT(expr(0), Catch::Matchers::WithinAbs(0.1, 1e-12));
+    REQUIRE_THAT(expr(id_desc.encode({{"system", 1}, {"layer", 3}})),
+                 Catch::Matchers::WithinAbs(0.1, 1e-12));
+  }
+
+  SECTION("expression of a subset of fields") {
+    CellIDExpression expr;
+    expr.compile("layer < 2 ? 0.1 : 0.2 + x", id_desc);
+    REQUIRE_FALSE(expr.isConstant());
+    REQUIRE(expr.referencedFields() == std::vector<std::string>{"layer", "x"});
+    REQUIRE(expr.keyMask() == (id_desc.field("layer")->mask() | id_desc.field("x")->mask()));
+
+    // repeated and interleaved lookups agree with direct evaluation
+    for (int pass = 0; pass < 2; ++pass) {
+      for (int layer = 0; layer < 4; ++layer) {
+        for (int x = 0; x < 3; ++x) {
+          for (int y = 0; y < 3; ++y) {
+            const std::uint64_t cellID =
+                id_desc.encode({{"system", 1}, {"layer", layer}, {"x", x}, {"y", y}});
+            const double expected = layer < 2 ? 0.1 : 0.2 + x;
+            REQUIRE_THAT(expr(cellID), Catch::Matchers::WithinAbs(expected, 1e-12));
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <DD4hep/Detector.h>
+#include <algorithms/geo.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <edm4eic/unit_system.h>
+#include <edm4hep/CaloHitContributionCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <edm4hep/SimCalorimeterHitCollection.h>
+#include <edm4hep/Vector3f.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <gsl/pointers>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algorithms/calorimetry/SimCalorimeterHitProcessor.h"
+#include "algorithms/calorimetry/SimCalorimeterHitProcessorConfig.h"
+
+using eicrecon::SimCalorimeterHitProcessor;
+using eicrecon::SimCalorimeterHitProcessorConfig;
+
+namespace {
+
+struct Outputs {
+  std::vector<std::unique_ptr<edm4hep::SimCalorimeterHitCollection>> hits;
+  std::vector<std::unique_ptr<edm4hep::CaloHitContributionCollection>> contribs;
+};
+
+/// Run the processor with the given readout end positions, one output pair per end
+Outputs run(SimCalorimeterHitProcessorConfig cfg, const std::vector<std::string>& ends,
+            const edm4hep::SimCalorimeterHitCollection& simhits) {
+  cfg.attenuationReferencePositionNames = ends;
+  SimCalorimeterHitProcessor algo("SimCalorimeterHitProcessor");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  Outputs outputs;
+  std::vector<gsl::not_null<edm4hep::SimCalorimeterHitCollection*>> hits;
+  std::vector<gsl::not_null<edm4hep::CaloHitContributionCollection*>> contribs;
+  for (std::size_t end = 0; end < std::max<std::size_t>(ends.size(), 1); ++end) {
+    hits.emplace_back(
+        outputs.hits.emplace_back(std::make_unique<edm4hep::SimCalorimeterHitCollection>()).get());
+    contribs.emplace_back(
+        outputs.contribs.emplace_back(std::make_unique<edm4hep::CaloHitContributionCollection>())
+            .get());
+  }
+  algo.process({&simhits}, {hits, contribs});
+  return outputs;
+}
+
+} // namespace
+
+TEST_CASE("All readout ends are processed in one pass", "[SimCalorimeterHitProcessor]") {
+  auto id_desc = algorithms::GeoSvc::instance().detector()->readout("MockCalorimeterHits").idSpec();
+
+  SimCalorimeterHitProcessorConfig cfg;
+  cfg.readout                 = "MockCalorimeterHits";
+  cfg.attenuationParameters   = {0.5, 500 * edm4eic::unit::mm, 2000 * edm4eic::unit::mm};
+  cfg.inversePropagationSpeed = (1. / 160) * edm4eic::unit::ns / edm4eic::unit::mm;
+  cfg.fixedTimeDelay          = 2 * edm4eic::unit::ns;
+  cfg.timeWindow              = 100 * edm4eic::unit::ns;
+
+  // one primary, with two contributions to each of three cells along z
+  edm4hep::MCParticleCollection particles;
+  auto primary = particles.create();
+  primary.setPDG(11);
+  primary.setGeneratorStatus(1);
+
+  edm4hep::CaloHitContributionCollection calohits;
+  edm4hep::SimCalorimeterHitCollection simhits;
+  const std::vector<float> zs{-300., 0., 400.};
+  for (std::size_t cell = 0; cell < zs.size(); ++cell) {
+    auto hit = simhits.create(id_desc.encode({{"system", 1}, {"x", static_cast<int>(cell)}}), 1.0,
+                              edm4hep::Vector3f(0., 0., zs[cell]));
+    for (float time : {1.0F, 3.0F}) {
+      auto contrib = calohits.create(11, 0.5, time, edm4hep::Vector3f(0., 0., zs[cell]));
+      contrib.setParticle(primary);
+      hit.addToContributions(contrib);
+    }
+  }
+
+  const std::string positive = "MockCalorimeter_PositivePosZ";
+  const std::string negative = "MockCalorimeter_NegativePosZ";
+  const auto both            = run(cfg, {positive, negative}, simhits);
+  REQUIRE(both.hits.size() == 2);
+  REQUIRE(both.contribs.size() == 2);
+
+  SECTION("Each end matches a separate pass for that end") {
+    for (const auto& [end, name] : {std::pair{0, positive}, std::pair{1, negative}}) {
+      CAPTURE(name);
+      const auto single = run(cfg, {name}, simhits);
+      const auto& hits  = *both.hits[end];
+      REQUIRE(hits.size() == single.hits[0]->size());
+      REQUIRE(both.contribs[end]->size() == single.contribs[0]->size());
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        const auto& expected = (*single.hits[0])[i];
+        REQUIRE(hits[i].getCellID() == expected.getCellID());
+        REQUIRE(hits[i].getEnergy() == expected.getEnergy());
+        REQUIRE(hits[i].getPosition().z == expected.getPosition().z);
+        REQUIRE(hits[i].contributions_size() == expected.contributions_size());
+        for (std::size_t j = 0; j < hits[i].contributions_size(); ++j) {
+          REQUIRE(hits[i].getContributions(j).getEnergy() ==
+                  expected.getContributions(j).getEnergy());
+          REQUIRE(hits[i].getContributions(j).getTime() == expected.getContributions(j).getTime());
+        }
+      }
+    }
+  }
+
+  SECTION("Hits are attenuated toward their own end") {
+    for (const auto& [end, ref_z] : {std::pair{0, 1000.}, std::pair{1, -1000.}}) {
+      const auto& hits = *both.hits[end];
+      REQUIRE(hits.size() == zs.size());
+      for (const auto& hit : hits) {
+        const double length = std::abs(ref_z - hit.getPosition().z);
+        const double att    = 0.5 * std::exp(-length / 500.) + 0.5 * std::exp(-length / 2000.);
+        REQUIRE_THAT(hit.getEnergy(), Catch::Matchers::WithinRel(1.0 * att, 1e-5));
+        // delays add to the earliest contribution time
+        REQUIRE(hit.contributions_size() == 1);
+        REQUIRE_THAT(hit.getContributions(0).getTime(),
+                     Catch::Matchers::WithinRel(1.0 + length / 160. + 2., 1e-5));
+      }
+    }
+  }
+
+  SECTION("Without readout ends, hits are not attenuated") {
+    const auto unattenuated = run(cfg, {}, simhits);
+    REQUIRE(unattenuated.hits.size() == 1);
+    REQUIRE(unattenuated.hits[0]->size() == zs.size());
+    for (const auto& hit : *unattenuated.hits[0]) {
+      REQUIRE_THAT(hit.getEnergy(), Catch::Matchers::WithinRel(1.0, 1e-6));
+    }
+  }
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/EDM4eicVersion.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#if EDM4EIC_VERSION_MAJOR > 8 || (EDM4EIC_VERSION_MAJOR == 8 && EDM4EIC_VERSION_MINOR >= 7)
+#include <edm4eic/RawCALOROCHitCollection.h>
+#include <edm4eic/SimPulseCollection.h>
+#include <edm4eic/unit_system.h>
+#include <edm4hep/CaloHitContributionCollection.h>
+#include <edm4hep/EventHeaderCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <edm4hep/SimCalorimeterHitCollection.h>
+#include <edm4hep/Vector3f.h>
+#include <gsl/pointers>
+#include <podio/RelationRange.h>
+#include <tuple>
+#include <vector>
+
+#include "algorithms/digi/CALOROCDigitization.h"
+#include "algorithms/digi/CalorimeterPulseDigitization.h"
+#include "algorithms/digi/CalorimeterPulseDigitizationConfig.h"
+#include "algorithms/digi/PulseCombiner.h"
+#include "algorithms/digi/PulseGeneration.h"
+
+TEST_CASE("Fused pulse digitization matches the stage-by-stage chain",
+          "[CalorimeterPulseDigitization]") {
+
+  eicrecon::CalorimeterPulseDigitizationConfig cfg;
+  cfg.generation.pulse_shape_function = "LandauPulse";
+  cfg.generation.pulse_shape_params   = {1.0, 2 * edm4eic::unit::ns};
+  cfg.generation.ignore_thres         = 1e-3;
+  cfg.generation.timestep             = 0.5 * edm4eic::unit::ns;
+  cfg.combiner.minimum_separation     = 10 * edm4eic::unit::ns;
+  cfg.add_noise                       = false;
+
+  eicrecon::PulseGeneration<edm4hep::SimCalorimeterHit> generation("PulseGeneration");
+  generation.applyConfig(cfg.generation);
+  generation.init();
+  eicrecon::PulseCombiner combiner("PulseCombiner");
+  combiner.applyConfig(cfg.combiner);
+  combiner.init();
+  eicrecon::CALOROCDigitization digitization("CALOROCDigitization");
+  digitization.applyConfig(cfg.digitization);
+  digitization.init();
+
+  eicrecon::CalorimeterPulseDigitization algo("CalorimeterPulseDigitization");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  edm4hep::EventHeaderCollection headers;
+  headers.create(1, 1, 12345678, 1.0);
+
+  // two overlapping hits and a late one in one cell, and one hit in another cell
+  edm4hep::MCParticleCollection particles;
+  auto particle = particles.create();
+  edm4hep::CaloHitContributionCollection contribs;
+  edm4hep::SimCalorimeterHitCollection hits;
+  for (const auto& [cellID, energy, time] :
+       std::vector<std::tuple<std::uint64_t, float, float>>{
+           {2, 0.1F, 3.0F}, {1, 0.2F, 1.0F}, {1, 0.05F, 2.5F}, {1, 0.1F, 200.0F}}) {
+    auto contrib = contribs.create(0, energy, time, edm4hep::Vector3f{});
+    contrib.setParticle(particle);
+    auto hit = hits.create(cellID, energy, edm4hep::Vector3f{});
+    hit.addToContributions(contrib);
+  }
+
+  edm4eic::SimPulseCollection pulses;
+  edm4eic::SimPulseCollection combined_pulses;
+  edm4eic::RawCALOROCHitCollection chain_digi_hits;
+  generation.process({&hits}, {&pulses});
+  combiner.process({&pulses}, {&combined_pulses});
+  digitization.process({&combined_pulses}, {&chain_digi_hits});
+
+  edm4eic::SimPulseCollection fused_pulses;
+  edm4eic::SimPulseCollection fused_combined_pulses;
+  edm4eic::SimPulseCollection fused_noisy_pulses;
+  edm4eic::RawCALOROCHitCollection fused_digi_hits;
+  std::vector<gsl::not_null<edm4eic::SimPulseCollection*>> fused_pulse_sets{
+      &fused_pulses, &fused_combined_pulses, &fused_noisy_pulses};
+  algo.process({&headers, &hits}, {&fused_digi_hits, fused_pulse_sets});
+
+  REQUIRE(fused_pulses.size() == pulses.size());
+  REQUIRE(fused_combined_pulses.size() == combined_pulses.size());
+  REQUIRE(fused_combined_pulses.size() == 3);
+  REQUIRE(fused_noisy_pulses.empty());
+  for (std::size_t i = 0; i < combined_pulses.size(); ++i) {
+    const auto& expected = combined_pulses[i];
+    const auto& actual   = fused_combined_pulses[i];
+    REQUIRE(actual.getCellID() == expected.getCellID());
+    REQUIRE(actual.getTime() == expected.getTime());
+    REQUIRE(actual.getPulses().size() == expected.getPulses().size());
+    REQUIRE(actual.getAmplitude().size() == expected.getAmplitude().size());
+    for (std::size_t j = 0; j < expected.getAmplitude().size(); ++j) {
+      REQUIRE(actual.getAmplitude()[j] == expected.getAmplitude()[j]);
+    }
+  }
+
+  REQUIRE(fused_digi_hits.size() == chain_digi_hits.size());
+  for (std::size_t i = 0; i < chain_digi_hits.size(); ++i) {
+    const auto& expected = chain_digi_hits[i];
+    const auto& actual   = fused_digi_hits[i];
+    REQUIRE(actual.getCellID() == expected.getCellID());
+    REQUIRE(actual.getTimeStamp() == expected.getTimeStamp());
+    REQUIRE(actual.getASamples().size() == expected.getASamples().size());
+    for (std::size_t j = 0; j < expected.getASamples().size(); ++j) {
+      REQUIRE(actual.getASamples()[j].ADC == expected.getASamples()[j].ADC);
+      REQUIRE(actual.getASamples()[j].timeOfArrival == expected.getASamples()[j].timeOfArrival);
+      REQUIRE(actual.getASamples()[j].timeOverThreshold ==
+              expected.getASamples()[j].timeOverThreshold);
+      REQUIRE(actual.getBSamples()[j].highGainADC == expected.getBSamples()[j].highGainADC);
+    }
+  }
+
+  SECTION("without the noisy pulse collection") {
+    edm4eic::SimPulseCollection only_pulses;
+    edm4eic::SimPulseCollection only_combined_pulses;
+    edm4eic::RawCALOROCHitCollection digi_hits;
+    std::vector<gsl::not_null<edm4eic::SimPulseCollection*>> pulse_sets{&only_pulses,
+                                                                        &only_combined_pulses};
+    algo.process({&headers, &hits}, {&digi_hits, pulse_sets});
+    REQUIRE(only_pulses.size() == pulses.size());
+    REQUIRE(only_combined_pulses.size() == combined_pulses.size());
+    REQUIRE(digi_hits.size() == chain_digi_hits.size());
+  }
+
+  SECTION("without intermediate pulse collections") {
+    edm4eic::RawCALOROCHitCollection digi_hits;
+    algo.process({&headers, &hits}, {&digi_hits, {}});
+    REQUIRE(digi_hits.size() == chain_digi_hits.size());
+  }
+}
+#endif
@@ -6,6 +6,8 @@
 #include <DD4hep/Readout.h>
 #include <DDSegmentation/BitFieldCoder.h>
 #include <algorithms/geo.h>
+#include <algorithms/interfaces/DataModeSvc.h>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
@@ -18,6 +20,7 @@
 #include <edm4hep/Vector3f.h>
 #include <podio/detail/Link.h>
 #include <array>
+#include <cstddef>
 #include <cstdlib>
 #include <deque>
 #include <gsl/pointers>
@@ -507,3 +510,108 @@ TEST_CASE("MPGDTrackerDigi: produces both p-strip and n-strip raw hits", "[MPGDT
   CHECK(hasPStrip);
   CHECK(hasNStrip);
 }
+
+TEST_CASE("MPGDTrackerDigi: raw hits are associated to the sim hits they stem from",
+          "[MPGDTrackerDigi]") {
+  MPGDTrackerDigi algo("test_digi_assoc_origin");
+  auto cfg = makeDefaultConfig();
+  algo.applyConfig(cfg);
+  algo.init();
+
+  auto id_desc     = getMPGDIdDesc();
+  const int pStrip = 1;
+
+  edm4hep::EventHeaderCollection headers;
+  headers.create(12, 0);
+  edm4hep::SimTrackerHitCollection sim_hits;
+  edm4hep::MCParticleCollection mc_particles;
+
+  // Two hits sharing a cellID (the volume fields) but firing distinct strips
+  auto cellID = makeCellID(id_desc, 3, 0, 0, 0, pStrip, 0, 0);
+  createSimHit(sim_hits, mc_particles, cellID, -20.0, -20.0, -0.025, 0.0, 0.0, 1.0, 1.0e-6, 10.0,
+               0.05);
+  createSimHit(sim_hits, mc_particles, cellID, 20.0, 20.0, -0.025, 0.0, 0.0, 1.0, 1.0e-6, 10.0,
+               0.05);
+
+  edm4eic::RawTrackerHitCollection raw_hits;
+  edm4eic::MCRecoTrackerHitLinkCollection links;
+  edm4eic::MCRecoTrackerHitAssociationCollection associations;
+
+  algo.process({&headers, &sim_hits}, {&raw_hits, &links, &associations});
+
+  // One association per raw hit, to the sim hit it was digitized from
+  REQUIRE(raw_hits.size() >= 4);
+  REQUIRE(associations.size() == raw_hits.size());
+  REQUIRE(links.size() == raw_hits.size());
+  std::array<std::size_t, 2> counts{0, 0};
+  for (const auto& assoc : associations) {
+    counts[assoc.getSimHit().getPosition().x < 0 ? 0 : 1]++;
+  }
+  CHECK(counts[0] == raw_hits.size() / 2);
+  CHECK(counts[1] == raw_hits.size() / 2);
+}
+
+TEST_CASE("MPGDTrackerDigi: data-only mode produces no associations", "[MPGDTrackerDigi]") {
+  MPGDTrackerDigi algo("test_digi_data_only");
+  auto cfg = makeDefaultConfig();
+  algo.applyConfig(cfg);
+  algo.init();
+
+  auto id_desc     = getMPGDIdDesc();
+  const int pStrip = 1;
+
+  edm4hep::EventHeaderCollection headers;
+  headers.create(14, 0);
+  edm4hep::SimTrackerHitCollection sim_hits;
+  edm4hep::MCParticleCollection mc_particles;
+
+  auto cellID = makeCellID(id_desc, 3, 0, 0, 0, pStrip, 0, 0);
+  createSimHit(sim_hits, mc_particles, cellID, 0.0, 0.0, -0.025, 0.0, 0.0, 1.0, 1.0e-6, 10.0, 0.05);
+
+  edm4eic::RawTrackerHitCollection raw_hits;
+  edm4eic::MCRecoTrackerHitLinkCollection links;
+  edm4eic::MCRecoTrackerHitAssociationCollection associations;
+
+  auto& dataModeSvc = algorithms::DataModeSvc::instance();
+  dataModeSvc.setProperty("data_only", true);
+  algo.process({&headers, &sim_hits}, {&raw_hits, &links, &associations});
+  dataModeSvc.setProperty("data_only", false);
+
+  REQUIRE(raw_hits.size() > 0);
+  REQUIRE(links.size() == 0);
+  REQUIRE(associations.size() == 0);
+}
+
+TEST_CASE("MPGDTrackerDigi: benchmark", "[MPGDTrackerDigi][.benchmark]") {
+  MPGDTrackerDigi algo("test_digi_benchmark");
+  auto cfg = makeDefaultConfig();
+  algo.applyConfig(cfg);
+  algo.init();
+
+  auto id_desc = getMPGDIdDesc();
+
+  edm4hep::EventHeaderCollection headers;
+  headers.create(13, 0);
+  edm4hep::SimTrackerHitCollection sim_hits;
+  edm4hep::MCParticleCollection mc_particles;
+
+  // Hits as in the above test cases, spread over both modules and strip types
+  const int nHits = 500;
+  for (int ihit = 0; ihit < nHits; ihit++) {
+    const int module = ihit % 2;
+    const int strip  = 1 + (ihit / 2) % 2;
+    auto cellID      = makeCellID(id_desc, 3, 0, module, 0, strip, 0, 0);
+    double x         = -40.0 + 80.0 * ((ihit * 37) % nHits) / nHits;
+    double y         = -40.0 + 80.0 * ((ihit * 91) % nHits) / nHits;
+    double z         = module * 0.5 + (strip == 1 ? -0.025 : 0.025);
+    createSimHit(sim_hits, mc_particles, cellID, x, y, z, 0.0, 0.0, 1.0, 1.0e-6, 10.0, 0.05);
+  }
+
+  BENCHMARK("process " + std::to_string(nHits) + " sim hits") {
+    edm4eic::RawTrackerHitCollection raw_hits;
+    edm4eic::MCRecoTrackerHitLinkCollection links;
+    edm4eic::MCRecoTrackerHitAssociationCollection associations;
+    algo.process({&headers, &sim_hits}, {&raw_hits, &links, &associations});
+    return associations.size();
+  };
+}
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithms/digi/NoiseLibrary.h"
+#include "algorithms/interfaces/CounterRNG.h"
+
+using eicrecon::CounterRNG;
+using eicrecon::NoiseLibrary;
+
+TEST_CASE("Noise pixels are distinct, sorted and in range", "[NoiseLibrary]") {
+  std::vector<std::uint64_t> indices;
+  for (std::uint64_t event = 0; event < 100; ++event) {
+    CounterRNG rng(event, 0);
+    eicrecon::sample_noise_pixels(rng, 50, 20., indices);
+    REQUIRE(indices.size() <= 50);
+    REQUIRE(std::adjacent_find(indices.begin(), indices.end(), std::greater_equal<>()) ==
+            indices.end());
+    REQUIRE(std::all_of(indices.begin(), indices.end(), [](auto i) { return i < 50; }));
+  }
+
+  // saturated occupancy selects every pixel once
+  CounterRNG rng(1, 0);
+  eicrecon::sample_noise_pixels(rng, 10, 1e3, indices);
+  REQUIRE(indices == std::vector<std::uint64_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+TEST_CASE("Noise library draws shifted patterns uniformly over the pixels", "[NoiseLibrary]") {
+  const std::uint64_t num_pixels = 100;
+  const NoiseLibrary library(num_pixels, 5., 8, 42);
+  REQUIRE(library.size() == 8);
+
+  std::vector<std::size_t> occupancy(num_pixels);
+  std::vector<std::uint64_t> indices;
+  const std::size_t num_events = 20000;
+  for (std::uint64_t event = 0; event < num_events; ++event) {
+    CounterRNG rng(event, 0);
+    library.draw(rng, indices);
+    REQUIRE(std::adjacent_find(indices.begin(), indices.end(), std::greater_equal<>()) ==
+            indices.end());
+    for (const auto index : indices) {
+      REQUIRE(index < num_pixels);
+      ++occupancy[index];
+    }
+  }
+
+  // the random shifts spread even a handful of patterns over all pixels
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < library.size(); ++i) {
+    total += library.entry(i).size();
+  }
+  const double expected = static_cast<double>(total) / library.size() * num_events / num_pixels;
+  for (const auto count : occupancy) {
+    REQUIRE(count > 0.7 * expected);
+    REQUIRE(count < 1.3 * expected);
+  }
+}
+
+TEST_CASE("Noise library round-trips through its text format", "[NoiseLibrary]") {
+  const NoiseLibrary library(1000, 10., 5, 7);
+  std::stringstream stream;
+  library.write(stream);
+  const auto copy = NoiseLibrary::read(stream);
+  REQUIRE(copy.numPixels() == library.numPixels());
+  REQUIRE(copy.mean() == library.mean());
+  REQUIRE(copy.key() == library.key());
+  REQUIRE(copy.size() == library.size());
+  for (std::size_t i = 0; i < library.size(); ++i) {
+    REQUIRE(std::ranges::equal(copy.entry(i), library.entry(i)));
+  }
+
+  // the mean is read back exactly, for comparison with the configured noise rate
+  const NoiseLibrary inexact(1000, 0.1 * 1.7, 1, 7);
+  std::stringstream inexact_stream;
+  inexact.write(inexact_stream);
+  REQUIRE(NoiseLibrary::read(inexact_stream).mean() == inexact.mean());
+
+  std::stringstream unsorted{"noise-library 10 1 1.5 7\n2 5 3\n"};
+  REQUIRE_THROWS_AS(NoiseLibrary::read(unsorted), std::runtime_error);
+
+  // files without the generation parameters are rejected
+  std::stringstream old_header{"noise-library 10 1\n2 3 5\n"};
+  REQUIRE_THROWS_AS(NoiseLibrary::read(old_header), std::runtime_error);
+}
@@ -7,6 +7,7 @@
 #include <edm4eic/unit_system.h>
 #include <edm4hep/SimTrackerHitCollection.h>
 #include <podio/RelationRange.h>
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <initializer_list>
@@ -286,3 +287,63 @@ TEST_CASE("Test multi-modal expression pulse with early sub-threshold peak and l
   double last_sampled_time = pulse_start_time + amplitudes.size() * cfg.timestep;
   REQUIRE(last_sampled_time >= max_time + cfg.timestep);
 }
+
+TEST_CASE("Test tabulated Landau pulse agrees with direct evaluation",
+          "[PulseGeneration][Template]") {
+
+  eicrecon::PulseGenerationConfig cfg;
+  cfg.pulse_shape_function = "LandauPulse";
+  cfg.pulse_shape_params   = {1.0, 1.0}; // gain=1.0, sigma_analog=1.0
+  cfg.ignore_thres         = 1.0;
+  cfg.timestep             = 0.1 * edm4eic::unit::ns;
+  cfg.min_sampling_time    = 2.0 * edm4eic::unit::ns;
+  cfg.max_time_bins        = 1000;
+
+  eicrecon::PulseGeneration<edm4hep::SimTrackerHit> algo_direct("PulseGenerationDirect");
+  cfg.template_oversampling = 0;
+  algo_direct.applyConfig(cfg);
+  algo_direct.init();
+
+  eicrecon::PulseGeneration<edm4hep::SimTrackerHit> algo_template("PulseGenerationTemplate");
+  cfg.template_oversampling = 16;
+  algo_template.applyConfig(cfg);
+  algo_template.init();
+
+  // Peak amplitude ~0.18 * charge, sub-threshold charges must not produce pulses
+  double charge = GENERATE(2.0, 10.0, 100.0);
+  double time   = GENERATE(5.0, 5.03, 5.07) * edm4eic::unit::ns;
+
+  edm4hep::SimTrackerHitCollection hits_coll;
+  hits_coll.create(12345, charge, time);
+
+  auto pulses_direct   = std::make_unique<PulseType::collection_type>();
+  auto pulses_template = std::make_unique<PulseType::collection_type>();
+  algo_direct.process(std::make_tuple(&hits_coll), std::make_tuple(pulses_direct.get()));
+  algo_template.process(std::make_tuple(&hits_coll), std::make_tuple(pulses_template.get()));
+
+  REQUIRE(pulses_template->size() == pulses_direct->size());
+  if (pulses_direct->empty()) {
+    return;
+  }
+
+  // samples lying on the threshold within the tolerance may start or end the pulses
+  // differently, so compare the samples they have in common
+  const auto& direct    = (*pulses_direct)[0];
+  const auto& tabulated = (*pulses_template)[0];
+  const auto offset = std::lround((tabulated.getTime() - direct.getTime()) / cfg.timestep);
+  REQUIRE(std::abs(offset) <= 1);
+
+  auto amplitudes_direct   = direct.getAmplitude();
+  auto amplitudes_template = tabulated.getAmplitude();
+  REQUIRE(std::abs(static_cast<long>(amplitudes_template.size()) -
+                   static_cast<long>(amplitudes_direct.size())) <= 2);
+  const double peak = 0.18 * charge;
+  for (long i = 0; i < static_cast<long>(amplitudes_template.size()); i++) {
+    const long j = i + offset;
+    if (j < 0 || j >= static_cast<long>(amplitudes_direct.size())) {
+      continue;
+    }
+    REQUIRE(std::abs(amplitudes_template[i] - amplitudes_direct[j]) <=
+            (cfg.template_tolerance + 1e-6) * peak);
+  }
+}
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <DD4hep/Detector.h>
+#include <DD4hep/IDDescriptor.h>
+#include <DD4hep/Readout.h>
+#include <DDSegmentation/BitFieldCoder.h>
+#include <algorithms/geo.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <edm4hep/MCParticleCollection.h>
+#include <edm4hep/SimTrackerHitCollection.h>
+#include <edm4hep/Vector3d.h>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <numbers>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+#include "algorithms/digi/SiliconChargeSharing.h"
+#include "algorithms/digi/SiliconChargeSharingConfig.h"
+
+using eicrecon::SiliconChargeSharing;
+using eicrecon::SiliconChargeSharingConfig;
+
+namespace {
+
+// Mock sensor geometry, in DD4hep units (cm): 1 mm pixels centred on a 1.05 cm half-width
+// sensor, sensor 0 at z = 19 cm and sensor 1 at z = 21 cm, rotated by 90 degrees around z
+constexpr double pitch      = 0.1;
+constexpr double half_width = 1.05;
+
+std::uint64_t cellID(int module, int x, int y) {
+  const auto* decoder =
+      algorithms::GeoSvc::instance().detector()->readout("MockSiliconHits").idSpec().decoder();
+  std::uint64_t cell = 0;
+  decoder->set(cell, "system", 4);
+  decoder->set(cell, "layer", 1);
+  decoder->set(cell, "module", module);
+  decoder->set(cell, "sensor", 0);
+  decoder->set(cell, "x", x);
+  decoder->set(cell, "y", y);
+  return cell;
+}
+
+// Sensor local to global position, in mm
+edm4hep::Vector3d toGlobal(int module, double x, double y) {
+  if (module == 0) {
+    return {10. * x, 10. * y, 190.};
+  }
+  return {-10. * y, 10. * x, 210.};
+}
+
+struct Share {
+  float edep;
+  edm4hep::Vector3d position;
+};
+
+// Charge sharing as done by the original neighbour flood fill: every cell of the sensor with
+// more than the threshold of the Gaussian charge cloud, using the exact erf. The cells above
+// threshold form a connected window around the hit, so the flood fill reaches all of them.
+std::map<std::uint64_t, Share> floodFill(const SiliconChargeSharingConfig& cfg, int module,
+                                         double x, double y, float edep, double threshold) {
+  // charge fraction of the cell centred at cell
+  auto integral = [](double mean, double sigma, double cell) {
+    return -0.5 * std::erf(std::numbers::sqrt2 * (mean - cell - 0.5 * pitch) / sigma) +
+           0.5 * std::erf(std::numbers::sqrt2 * (mean - cell + 0.5 * pitch) / sigma);
+  };
+  std::map<std::uint64_t, Share> shares;
+  const int max_bin = static_cast<int>(half_width / pitch);
+  for (int xBin = -max_bin; xBin <= max_bin; ++xBin) {
+    for (int yBin = -max_bin; yBin <= max_bin; ++yBin) {
+      const double xCell = xBin * pitch;
+      const double yCell = yBin * pitch;
+      const float share  =
+          edep * integral(x, cfg.sigma_sharingx, xCell) * integral(y, cfg.sigma_sharingy, yCell);
+      if (share > threshold) {
+        shares.emplace(cellID(module, xBin, yBin), Share{share, toGlobal(module, xCell, yCell)});
+      }
+    }
+  }
+  return shares;
+}
+
+} // namespace
+
+TEST_CASE("SiliconChargeSharing shares charge like the neighbour flood fill",
+          "[SiliconChargeSharing]") {
+  SiliconChargeSharingConfig cfg;
+  cfg.sigma_mode     = SiliconChargeSharingConfig::ESigmaMode::abs;
+  cfg.sigma_sharingx = 0.1;  // cm
+  cfg.sigma_sharingy = 0.05; // cm
+  cfg.min_edep       = 1e-7; // GeV
+  cfg.readout        = "MockSiliconHits";
+
+  SiliconChargeSharing algo("SiliconChargeSharing");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  std::mt19937 rng(7);
+  // includes hits close to the sensor edges, where sharing is cut off
+  std::uniform_real_distribution<double> position(-half_width + 0.01, half_width - 0.01);
+  std::uniform_real_distribution<float> energy(1e-6, 1e-4);
+
+  edm4hep::MCParticleCollection particles;
+  auto particle = particles.create();
+  particle.setPDG(13);
+
+  for (int i = 0; i < 200; ++i) {
+    const int module  = i % 2;
+    const double x    = position(rng);
+    const double y    = position(rng);
+    const float edep  = energy(rng);
+    const auto hitPos = toGlobal(module, x, y);
+
+    edm4hep::SimTrackerHitCollection simhits;
+    auto hit = simhits.create();
+    // the cell of the hit position need not match the hit cellID
+    hit.setCellID(cellID(module, 0, 0));
+    hit.setEDep(edep);
+    hit.setPosition(hitPos);
+    hit.setParticle(particle);
+
+    edm4hep::SimTrackerHitCollection shared;
+    algo.process({&simhits}, {&shared});
+
+    // the tabulated erf is accurate to ~1e-7, cells within that of min_edep may go either way
+    const double tolerance = 1e-6 * edep;
+    const auto expected    = floodFill(cfg, module, x, y, edep, cfg.min_edep - tolerance);
+    CAPTURE(i, module, x, y, edep);
+    std::set<std::uint64_t> cells;
+    for (const auto& shared_hit : shared) {
+      const auto it = expected.find(shared_hit.getCellID());
+      REQUIRE(it != expected.end());
+      REQUIRE(cells.insert(shared_hit.getCellID()).second);
+      REQUIRE_THAT(shared_hit.getEDep(), Catch::Matchers::WithinAbs(it->second.edep, tolerance));
+      const auto& position = shared_hit.getPosition();
+      REQUIRE_THAT(position.x, Catch::Matchers::WithinAbs(it->second.position.x, 1e-6));
+      REQUIRE_THAT(position.y, Catch::Matchers::WithinAbs(it->second.position.y, 1e-6));
+      REQUIRE_THAT(position.z, Catch::Matchers::WithinAbs(it->second.position.z, 1e-6));
+    }
+    for (const auto& [cell, share] : expected) {
+      if (share.edep > cfg.min_edep + tolerance) {
+        REQUIRE(cells.contains(cell));
+      }
+    }
+  }
+}
+
+TEST_CASE("SiliconChargeSharing rejects cellIDs outside of the sensors", "[SiliconChargeSharing]") {
+  SiliconChargeSharingConfig cfg;
+  cfg.sigma_sharingx = 0.1;
+  cfg.sigma_sharingy = 0.1;
+  cfg.min_edep       = 1e-7;
+  cfg.readout        = "MockSiliconHits";
+
+  SiliconChargeSharing algo("SiliconChargeSharing");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  edm4hep::SimTrackerHitCollection simhits;
+  auto hit = simhits.create();
+  hit.setCellID(cellID(5, 0, 0));
+  hit.setEDep(1e-4);
+  hit.setPosition(toGlobal(0, 0., 0.));
+
+  edm4hep::SimTrackerHitCollection shared;
+  REQUIRE_THROWS_AS(algo.process({&simhits}, {&shared}), std::runtime_error);
+}
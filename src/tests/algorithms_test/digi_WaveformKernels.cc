@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "algorithms/digi/WaveformKernels.h"
+
+using namespace eicrecon;
+
+// The kernels are compared against the scalar loops they replaced in the digitizers,
+// on waveforms long enough to exercise both the block and the remainder paths
+
+TEST_CASE("Waveform threshold searches match scalar scans", "[WaveformKernels]") {
+  const std::size_t n_samples = GENERATE(0, 1, 2, 15, 16, 17, 100);
+  std::mt19937 rng(n_samples);
+  std::uniform_real_distribution<float> amplitude(-1, 1);
+
+  for (int trial = 0; trial < 100; ++trial) {
+    std::vector<float> samples(n_samples);
+    for (auto& sample : samples) {
+      sample = amplitude(rng);
+    }
+    const std::span<const float> span{samples};
+    const double thres     = amplitude(rng);
+    const std::size_t from = n_samples > 0 ? rng() % n_samples : 0;
+
+    std::size_t expected_above = waveform::npos;
+    std::size_t expected_below = waveform::npos;
+    for (std::size_t i = n_samples; i > from; --i) {
+      if (samples[i - 1] > thres) {
+        expected_above = i - 1;
+      }
+      if (samples[i - 1] < thres) {
+        expected_below = i - 1;
+      }
+    }
+    REQUIRE(waveform::find_first_above(span, thres, from) == expected_above);
+    REQUIRE(waveform::find_first_below(span, thres, from) == expected_below);
+  }
+}
+
+TEST_CASE("EICROC kernels match the scalar TDC and peak scan", "[WaveformKernels]") {
+  const std::size_t n_samples = GENERATE(0, 1, 2, 15, 16, 17, 100);
+  std::mt19937 rng(n_samples);
+  std::uniform_int_distribution<std::int32_t> adc(-20, 5);
+
+  for (int trial = 0; trial < 100; ++trial) {
+    std::vector<std::int32_t> adcs(n_samples);
+    for (auto& sample : adcs) {
+      sample = adc(rng);
+    }
+    const double thres = -5;
+
+    // scalar scan of EICROCDigitization
+    std::size_t expected_tdc = waveform::npos;
+    int expected_V           = 0;
+    double adc_prev          = 0;
+    for (std::size_t time_bin = 0; time_bin < adcs.size(); ++time_bin) {
+      if (adc_prev >= thres && adcs[time_bin] <= thres) {
+        expected_tdc = time_bin;
+      }
+      if (std::abs(adcs[time_bin]) > std::abs(expected_V)) {
+        expected_V = adcs[time_bin];
+      }
+      adc_prev = adcs[time_bin];
+    }
+
+    const std::span<const std::int32_t> span{adcs};
+    REQUIRE(waveform::find_last_falling_crossing(span, thres, 0.) == expected_tdc);
+    REQUIRE(waveform::abs_peak(span) == expected_V);
+  }
+}
+
+TEST_CASE("CFD kernels match the scalar peak and crossing scans", "[WaveformKernels]") {
+  const std::size_t n_samples = GENERATE(3, 16, 17, 40, 100);
+  std::mt19937 rng(n_samples);
+  std::uniform_int_distribution<std::int32_t> adc(-50, 50);
+
+  for (int trial = 0; trial < 100; ++trial) {
+    std::vector<std::int32_t> adcs(n_samples);
+    for (auto& sample : adcs) {
+      sample = adc(rng);
+    }
+    const std::span<const std::int32_t> span{adcs};
+
+    std::vector<std::size_t> expected_peaks;
+    for (std::size_t time_bin = 1; time_bin < adcs.size() - 1; ++time_bin) {
+      if (std::abs(adcs[time_bin - 1]) < std::abs(adcs[time_bin]) &&
+          std::abs(adcs[time_bin]) >= std::abs(adcs[time_bin + 1])) {
+        expected_peaks.push_back(time_bin);
+      }
+    }
+    std::vector<std::size_t> peaks;
+    waveform::find_local_peaks(span, peaks);
+    REQUIRE(peaks == expected_peaks);
+
+    for (std::size_t peak : peaks) {
+      const int target              = static_cast<int>(adcs[peak] * 0.5);
+      std::size_t expected_crossing = waveform::npos;
+      int prev_V                    = adcs[peak];
+      for (int time_bin = static_cast<int>(peak) - 1; time_bin >= 0; --time_bin) {
+        if (std::abs(adcs[time_bin]) <= std::abs(target) && std::abs(target) <= std::abs(prev_V)) {
+          expected_crossing = time_bin;
+          break;
+        }
+        prev_V = adcs[time_bin];
+      }
+      REQUIRE(waveform::find_cfd_crossing(span, peak, target) == expected_crossing);
+    }
+  }
+}
+
+TEST_CASE("Strided gather and quantization match scalar loops", "[WaveformKernels]") {
+  const std::size_t n_samples = GENERATE(0, 5, 50, 200);
+  std::vector<float> samples(n_samples);
+  for (std::size_t i = 0; i < n_samples; ++i) {
+    samples[i] = 0.01F * i;
+  }
+
+  for (std::size_t first : {0, 3, 49}) {
+    for (std::size_t stride : {1, 7, 50}) {
+      std::vector<double> expected(7, -1);
+      for (std::size_t i = 0; i < expected.size(); ++i) {
+        std::size_t idx = first + i * stride;
+        if (idx < samples.size()) {
+          expected[i] = samples[idx];
+        } else {
+          break;
+        }
+      }
+      std::vector<double> gathered(7, -1);
+      waveform::strided_gather(std::span<const float>{samples}, first, stride,
+                               std::span{gathered});
+      REQUIRE(gathered == expected);
+    }
+  }
+
+  for (double value : {-1.0, 0.0, 0.3, 0.49999, 0.5, 1.0, 2.0}) {
+    REQUIRE(waveform::clamp_quantize(value, 1.0, 1024) ==
+            std::clamp(std::llround(value / 1.0 * 1024), 0LL, 1023LL));
+  }
+}
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "algorithms/interfaces/CounterRNG.h"
+
+using eicrecon::CounterRNG;
+
+TEST_CASE("Philox4x32-10 reproduces the Random123 known-answer vectors", "[CounterRNG]") {
+  using block = std::array<std::uint32_t, 4>;
+  REQUIRE(eicrecon::philox4x32({0, 0, 0, 0}, {0, 0}) ==
+          block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+  REQUIRE(eicrecon::philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                               {0xffffffff, 0xffffffff}) ==
+          block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+  REQUIRE(eicrecon::philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                               {0xa4093822, 0x299f31d0}) ==
+          block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Counter-based streams do not depend on draw order", "[CounterRNG]") {
+  const std::uint64_t key = eicrecon::mix64(eicrecon::mix64(1), 42);
+
+  // draw from streams in two different interleavings
+  std::vector<std::uint64_t> forward;
+  std::vector<std::uint64_t> backward;
+  for (std::uint64_t stream = 0; stream < 10; ++stream) {
+    CounterRNG rng(key, stream);
+    for (int i = 0; i < 5; ++i) {
+      forward.push_back(rng());
+    }
+  }
+  for (std::uint64_t stream = 10; stream-- > 0;) {
+    CounterRNG rng(key, stream);
+    for (int i = 0; i < 5; ++i) {
+      backward.push_back(rng());
+    }
+  }
+  for (std::size_t stream = 0; stream < 10; ++stream) {
+    for (std::size_t i = 0; i < 5; ++i) {
+      REQUIRE(forward[stream * 5 + i] == backward[(9 - stream) * 5 + i]);
+    }
+  }
+
+  // streams and keys differ
+  REQUIRE(CounterRNG(key, 0)() != CounterRNG(key, 1)());
+  REQUIRE(CounterRNG(key, 0)() != CounterRNG(key + 1, 0)());
+
+  // skipping ahead is equivalent to drawing
+  for (std::uint64_t skip : {0, 1, 2, 3, 7}) {
+    CounterRNG skipped(key, 3);
+    CounterRNG drawn(key, 3);
+    skipped.discard(skip);
+    for (std::uint64_t i = 0; i < skip; ++i) {
+      drawn();
+    }
+    REQUIRE(skipped() == drawn());
+  }
+}
+
+TEST_CASE("Counter-based bulk draws have the expected moments", "[CounterRNG]") {
+  CounterRNG rng(12345, 0);
+  const std::size_t n = 200001;
+
+  std::vector<double> uniforms(n);
+  rng.fill_uniform(uniforms);
+  double sum = 0;
+  for (double u : uniforms) {
+    REQUIRE(u >= 0.);
+    REQUIRE(u < 1.);
+    sum += u;
+  }
+  REQUIRE_THAT(sum / n, Catch::Matchers::WithinAbs(0.5, 0.005));
+
+  std::vector<double> gaussians(n);
+  rng.fill_gaussian(gaussians, 1., 2.);
+  double sum2 = 0;
+  sum         = 0;
+  for (double g : gaussians) {
+    sum += g;
+    sum2 += g * g;
+  }
+  REQUIRE_THAT(sum / n, Catch::Matchers::WithinAbs(1., 0.02));
+  REQUIRE_THAT(sum2 / n - (sum / n) * (sum / n), Catch::Matchers::WithinAbs(4., 0.05));
+
+  std::vector<long long> counts(n);
+  rng.fill_poisson(counts, 3.5);
+  sum = 0;
+  for (long long c : counts) {
+    sum += c;
+  }
+  REQUIRE_THAT(sum / n, Catch::Matchers::WithinAbs(3.5, 0.02));
+
+  // usable with standard distributions
+  std::normal_distribution<double> gaussian;
+  REQUIRE(std::isfinite(gaussian(rng)));
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "algorithms/interfaces/SortedGrouping.h"
+
+using eicrecon::SortedGrouping;
+
+namespace {
+
+/// Groups as (key, indices) pairs, in visiting order
+std::vector<std::pair<std::uint64_t, std::vector<std::uint32_t>>>
+collect(const SortedGrouping<std::uint64_t>& grouping) {
+  std::vector<std::pair<std::uint64_t, std::vector<std::uint32_t>>> groups;
+  for (const auto& group : grouping.groups()) {
+    groups.emplace_back(group.key,
+                        std::vector<std::uint32_t>(group.indices.begin(), group.indices.end()));
+  }
+  return groups;
+}
+
+} // namespace
+
+TEST_CASE("Empty input has no groups", "[SortedGrouping]") {
+  SortedGrouping<std::uint64_t> grouping;
+  REQUIRE(grouping.empty());
+
+  grouping.sort();
+  REQUIRE(grouping.empty());
+  REQUIRE(grouping.size() == 0);
+  REQUIRE(collect(grouping).empty());
+}
+
+TEST_CASE("Equal keys form a single group in insertion order", "[SortedGrouping]") {
+  SortedGrouping<std::uint64_t> grouping;
+  for (int i = 0; i < 4; ++i) {
+    grouping.add(7);
+  }
+  grouping.sort();
+
+  REQUIRE(grouping.size() == 1);
+  REQUIRE(grouping[0].key == 7);
+  REQUIRE(collect(grouping) == decltype(collect(grouping)){{7, {0, 1, 2, 3}}});
+}
+
+TEST_CASE("Unsorted keys are grouped in ascending key order", "[SortedGrouping]") {
+  SortedGrouping<std::uint64_t> grouping;
+  for (std::uint64_t key : {5, 2, 9, 2, 5, 5, 1}) {
+    grouping.add(key);
+  }
+  grouping.sort();
+
+  REQUIRE(collect(grouping) ==
+          decltype(collect(grouping)){{1, {6}}, {2, {1, 3}}, {5, {0, 4, 5}}, {9, {2}}});
+
+  SECTION("Explicit indices are kept, sorted within their group") {
+    grouping.clear();
+    grouping.add(3, 10);
+    grouping.add(1, 20);
+    grouping.add(3, 5);
+    grouping.sort();
+    REQUIRE(collect(grouping) == decltype(collect(grouping)){{1, {20}}, {3, {5, 10}}});
+  }
+
+  SECTION("Reuse after clear() does not keep previous groups") {
+    grouping.clear();
+    REQUIRE(grouping.empty());
+    grouping.add(4);
+    grouping.sort();
+    REQUIRE(collect(grouping) == decltype(collect(grouping)){{4, {0}}});
+  }
+}
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "algorithms/interfaces/TaskPool.h"
+
+using eicrecon::TaskPool;
+
+TEST_CASE("Every iteration runs exactly once", "[TaskPool]") {
+  for (std::size_t num_workers : {0, 1, 3}) {
+    CAPTURE(num_workers);
+    TaskPool pool(num_workers);
+    REQUIRE(pool.num_workers() == num_workers);
+    for (std::size_t n : {0, 1, 2, 100}) {
+      std::vector<std::atomic<int>> calls(n);
+      pool.parallel_for(n, [&](std::size_t i) { ++calls[i]; });
+      for (const auto& count : calls) {
+        REQUIRE(count == 1);
+      }
+    }
+  }
+}
+
+TEST_CASE("Loops from several threads share the workers", "[TaskPool]") {
+  TaskPool pool(2);
+  std::vector<std::size_t> sums(4);
+  std::vector<std::thread> callers;
+  for (std::size_t caller = 0; caller < sums.size(); ++caller) {
+    callers.emplace_back([&, caller] {
+      for (int repeat = 0; repeat < 50; ++repeat) {
+        std::vector<std::size_t> values(64);
+        pool.parallel_for(values.size(), [&](std::size_t i) { values[i] = i * (caller + 1); });
+        sums[caller] += std::accumulate(values.begin(), values.end(), std::size_t{0});
+      }
+    });
+  }
+  for (auto& thread : callers) {
+    thread.join();
+  }
+  for (std::size_t caller = 0; caller < sums.size(); ++caller) {
+    REQUIRE(sums[caller] == 50 * (caller + 1) * (63 * 64 / 2));
+  }
+}
+
+TEST_CASE("Exceptions are rethrown to the caller", "[TaskPool]") {
+  TaskPool pool(2);
+  std::atomic<int> calls{0};
+  REQUIRE_THROWS_AS(pool.parallel_for(10,
+                                      [&](std::size_t i) {
+                                        ++calls;
+                                        if (i == 3) {
+                                          throw std::runtime_error("iteration 3");
+                                        }
+                                      }),
+                    std::runtime_error);
+  // the other iterations still ran
+  REQUIRE(calls == 10);
+}
+
+TEST_CASE("Shared pools are reused while in use", "[TaskPool]") {
+  auto pool       = TaskPool::shared(2);
+  auto same_pool  = TaskPool::shared(2);
+  auto other_pool = TaskPool::shared(3);
+  REQUIRE(pool == same_pool);
+  REQUIRE(pool != other_pool);
+  REQUIRE(other_pool->num_workers() == 3);
+}
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <Evaluator/DD4hepUnits.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4hep/Vector3f.h>
+#include <edm4hep/utils/vector_utils.h>
+#include <numbers>
+#include <random>
+#include <utility>
+
+#include "algorithms/reco/Helix.h"
+
+using eicrecon::Helix;
+
+TEST_CASE("Helix path lengths at dca are refined to the common vertex", "[Helix]") {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> position(-5., 5.); // cm
+  std::uniform_real_distribution<float> momentum(0.3, 3.); // GeV
+  std::uniform_real_distribution<float> angle(-std::numbers::pi, std::numbers::pi);
+  std::uniform_real_distribution<float> cot(-2., 2.);
+  std::uniform_real_distribution<double> offset(-5., 5.); // cm
+
+  const double b_field = 1.7 * dd4hep::tesla;
+
+  for (int i = 0; i < 1000; ++i) {
+    // two daughters of opposite charge from a common vertex
+    const edm4hep::Vector3f vertex(position(rng), position(rng), position(rng));
+    auto daughter = [&](int charge) {
+      const float pt  = momentum(rng);
+      const float phi = angle(rng);
+      return Helix(edm4hep::Vector3f(pt * std::cos(phi), pt * std::sin(phi), pt * cot(rng)),
+                   vertex, b_field, charge);
+    };
+    const Helix h1 = daughter(+1);
+    const Helix h2 = daughter(-1);
+
+    // the vertex is at s = 0 on both helices, start away from it
+    const auto ss = h1.refinePathLengths(h2, offset(rng), offset(rng));
+    CAPTURE(i, ss.first, ss.second);
+    REQUIRE(edm4hep::utils::magnitude(h1.at(ss.first) - h2.at(ss.second)) < 1e-3);
+    REQUIRE(edm4hep::utils::magnitude(h1.at(ss.first) - vertex) < 1e-2);
+
+    // at least as close as the scan from the transverse start value
+    const auto scan = h1.pathLengths(h2);
+    REQUIRE(edm4hep::utils::magnitude(h1.at(ss.first) - h2.at(ss.second)) <=
+            edm4hep::utils::magnitude(h1.at(scan.first) - h2.at(scan.second)) + 1e-4);
+  }
+}
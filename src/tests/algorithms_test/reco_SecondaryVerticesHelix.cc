@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <DD4hep/DD4hepUnits.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <edm4eic/TrackCollection.h>
+#include <edm4eic/TrackParametersCollection.h>
+#include <edm4eic/TrajectoryCollection.h>
+#include <edm4eic/VertexCollection.h>
+#include <edm4eic/unit_system.h>
+#include <edm4hep/Vector3f.h>
+#include <edm4hep/utils/vector_utils.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <numbers>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "algorithms/reco/Helix.h"
+#include "algorithms/reco/SecondaryVerticesHelix.h"
+#include "algorithms/reco/SecondaryVerticesHelixConfig.h"
+
+using eicrecon::Helix;
+using eicrecon::SecondaryVerticesHelix;
+using eicrecon::SecondaryVerticesHelixConfig;
+
+namespace {
+
+// field of the mock detector
+const double b_field = 1.7 * dd4hep::tesla;
+
+struct Collections {
+  edm4eic::TrackParametersCollection params;
+  edm4eic::TrajectoryCollection trajectories;
+  edm4eic::TrackCollection tracks;
+  edm4eic::ReconstructedParticleCollection particles;
+};
+
+/// Add a pion with the track parameters of `helix` at its point of closest approach to the
+/// beam line
+void addPion(Collections& c, const Helix& helix, int charge) {
+  const double s      = helix.pathLength(0., 0.);
+  const auto position = helix.at(s);
+  const auto momentum = helix.momentumAt(s, b_field);
+  const float phi     = std::atan2(momentum.y, momentum.x);
+
+  auto param = c.params.create();
+  param.setType(-1);
+  param.setLoc({static_cast<float>((position.y * std::cos(phi) - position.x * std::sin(phi)) *
+                                   edm4eic::unit::cm / edm4eic::unit::mm),
+                static_cast<float>(position.z * edm4eic::unit::cm / edm4eic::unit::mm)});
+  param.setTheta(std::atan2(edm4hep::utils::magnitudeTransverse(momentum), momentum.z));
+  param.setPhi(phi);
+  param.setQOverP(charge / edm4hep::utils::magnitude(momentum));
+  auto trajectory = c.trajectories.create();
+  trajectory.addToTrackParameters(param);
+  auto track = c.tracks.create();
+  track.setTrajectory(trajectory);
+  auto particle = c.particles.create();
+  particle.setCharge(charge);
+  particle.setPDG(charge * 211);
+  particle.addToTracks(track);
+}
+
+struct Candidate {
+  double dca12;
+  double cos_theta;
+  double dca2pv;
+  edm4hep::Vector3f position; // mm
+};
+
+/// Unlike-sign pairs with the dca quantities of the scan over path lengths that
+/// SecondaryVerticesHelix used before, keyed by particle indices; primary vertex at the origin
+std::map<std::pair<std::size_t, std::size_t>, Candidate>
+scanV0s(const SecondaryVerticesHelixConfig& cfg,
+        const edm4eic::ReconstructedParticleCollection& particles) {
+  const edm4hep::Vector3f pVtxPos(0, 0, 0);
+  std::vector<std::pair<std::size_t, Helix>> helices;
+  for (std::size_t i = 0; i < particles.size(); ++i) {
+    Helix h(particles[i], b_field);
+    if (h.distance(pVtxPos) * edm4eic::unit::cm >= cfg.minDca) {
+      helices.emplace_back(i, h);
+    }
+  }
+
+  std::map<std::pair<std::size_t, std::size_t>, Candidate> candidates;
+  for (std::size_t i1 = 0; i1 < helices.size(); ++i1) {
+    for (std::size_t i2 = i1 + 1; i2 < helices.size(); ++i2) {
+      const auto& [index1, h1] = helices[i1];
+      const auto& [index2, h2] = helices[i2];
+      if (particles[index1].getCharge() + particles[index2].getCharge() != 0) {
+        continue;
+      }
+      const auto ss      = h1.pathLengths(h2);
+      const auto h1AtDca = h1.at(ss.first);
+      const auto h2AtDca = h2.at(ss.second);
+      const auto pairPos = 0.5 * (h1AtDca + h2AtDca);
+      const auto pairMom = h1.momentumAt(ss.first, b_field) + h2.momentumAt(ss.second, b_field);
+      const double angle = edm4hep::utils::angleBetween(pairMom, pairPos - pVtxPos);
+
+      candidates[{index1, index2}] = {
+          edm4hep::utils::magnitude(h1AtDca - h2AtDca) * edm4eic::unit::cm, std::cos(angle),
+          edm4hep::utils::magnitude(pairPos - pVtxPos) * edm4eic::unit::cm * std::sin(angle),
+          pairPos * (edm4eic::unit::cm / edm4eic::unit::mm)};
+    }
+  }
+  return candidates;
+}
+
+} // namespace
+
+TEST_CASE("SecondaryVerticesHelix finds the V0s of the path length scan",
+          "[SecondaryVerticesHelix]") {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> uniform(0., 1.);
+  auto direction = [&](float cot_min, float cot_max) {
+    const float phi = 2 * std::numbers::pi * uniform(rng);
+    const float cot = cot_min + (cot_max - cot_min) * uniform(rng);
+    return edm4hep::Vector3f(std::cos(phi), std::sin(phi), cot) / std::hypot(1.F, cot);
+  };
+
+  // K0S -> pi+ pi- decays, 2 to 10 cm from the primary vertex at the origin
+  Collections c;
+  const std::size_t num_v0s = 10;
+  const float mass          = 0.497611;
+  const float pion_mass     = 0.1395701;
+  const float p_star        = std::sqrt(mass * mass / 4 - pion_mass * pion_mass);
+  for (std::size_t v0 = 0; v0 < num_v0s; ++v0) {
+    const auto dir    = direction(-1., 1.);
+    const float p     = 1. + 2. * uniform(rng);         // GeV
+    const auto vertex = (2. + 8. * uniform(rng)) * dir; // cm
+    const float gamma = std::hypot(p, mass) / mass;
+    const float beta  = p / std::hypot(p, mass);
+    // decay in the rest frame, boosted along dir
+    const auto u           = direction(-3., 3.);
+    const float p_parallel = p_star * (u * dir);
+    const auto p_perp      = p_star * u - p_parallel * dir;
+    const float e_star     = std::hypot(p_star, pion_mass);
+    for (int charge : {1, -1}) {
+      const float p_boosted = gamma * (charge * p_parallel + beta * e_star);
+      addPion(c, Helix(p_boosted * dir + charge * p_perp, vertex, b_field, charge), charge);
+    }
+  }
+  // prompt tracks, displaced from the origin by more than minDca
+  for (std::size_t track = 0; track < 20; ++track) {
+    const int charge  = (track % 2 == 0) ? 1 : -1;
+    const auto dir    = direction(-1., 1.);
+    const float p     = 0.3 + 2.7 * uniform(rng);
+    const float d0    = 0.01 + 0.2 * uniform(rng); // cm
+    const float z0    = -20. + 40. * uniform(rng); // cm
+    const edm4hep::Vector3f origin(-d0 * dir.y, d0 * dir.x, z0);
+    addPion(c, Helix(p * dir, origin, b_field, charge), charge);
+  }
+
+  edm4eic::VertexCollection primary;
+  primary.create().setPosition({0.F, 0.F, 0.F, 0.F});
+
+  SecondaryVerticesHelixConfig cfg;
+  SecondaryVerticesHelix algo("SecondaryVerticesHelix");
+  algo.applyConfig(cfg);
+  algo.init();
+  edm4eic::VertexCollection secondary;
+  algo.process({&primary, &c.particles}, {&secondary});
+
+  std::map<std::pair<std::size_t, std::size_t>, edm4hep::Vector3f> found;
+  for (const auto& vertex : secondary) {
+    REQUIRE(vertex.getAssociatedParticles().size() == 2);
+    const std::size_t i1 = vertex.getAssociatedParticles(0).getObjectID().index;
+    const std::size_t i2 = vertex.getAssociatedParticles(1).getObjectID().index;
+    const auto position  = vertex.getPosition();
+    found.emplace(std::minmax(i1, i2), edm4hep::Vector3f(position.x, position.y, position.z));
+  }
+  REQUIRE(found.size() == secondary.size());
+
+  // all decays are found
+  for (std::size_t v0 = 0; v0 < num_v0s; ++v0) {
+    REQUIRE(found.contains({2 * v0, 2 * v0 + 1}));
+  }
+
+  // The scan finds the dca to about 1 mm along the helices, so pairs within its precision of
+  // a cut may go either way
+  const auto candidates = scanV0s(cfg, c.particles);
+  for (const auto& [pair, position] : found) {
+    REQUIRE(candidates.contains(pair));
+  }
+  for (const auto& [pair, candidate] : candidates) {
+    CAPTURE(pair.first, pair.second, candidate.dca12, candidate.cos_theta, candidate.dca2pv);
+    if (std::abs(candidate.dca12 - cfg.maxDca12) < 0.3 * edm4eic::unit::mm ||
+        std::abs(candidate.cos_theta - cfg.minCostheta) < 0.02 ||
+        std::abs(candidate.dca2pv - cfg.maxDca) < 0.3 * edm4eic::unit::mm) {
+      continue;
+    }
+    const bool accepted = candidate.dca12 < cfg.maxDca12 &&
+                          candidate.cos_theta >= cfg.minCostheta && candidate.dca2pv < cfg.maxDca;
+    REQUIRE(found.contains(pair) == accepted);
+    if (accepted) {
+      REQUIRE(edm4hep::utils::magnitude(found.at(pair) - candidate.position) < 1.);
+    }
+  }
+}
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <Acts/Definitions/Units.hpp>
+#include <Acts/EventData/ProxyAccessor.hpp>
+#include <Acts/EventData/VectorMultiTrajectory.hpp>
+#include <Acts/EventData/VectorTrackContainer.hpp>
+#include <Acts/Geometry/CuboidVolumeBuilder.hpp>
+#include <Acts/Geometry/GeometryContext.hpp>
+#include <Acts/Geometry/TrackingGeometry.hpp>
+#include <Acts/Geometry/TrackingGeometryBuilder.hpp>
+#include <Acts/MagneticField/ConstantBField.hpp>
+#include <Acts/Surfaces/RectangleBounds.hpp>
+#include <Acts/Surfaces/Surface.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/Cov6f.h>
+#include <edm4eic/Measurement2DCollection.h>
+#include <edm4eic/TrackParametersCollection.h>
+#include <edm4eic/TrackSeedCollection.h>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/CKFTracking.h"
+#include "algorithms/tracking/CKFTrackingConfig.h"
+#include "algorithms/tracking/ConstTrackContainerView.h"
+#include "algorithms/tracking/MeasurementSourceLinkIndex.h"
+#include "algorithms/tracking/StepperType.h"
+
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Telescope of six 50 x 50 cm planes along x, from x = 10 cm to 60 cm, without field
+std::shared_ptr<ActsGeometryProvider> makeTelescope() {
+  Acts::CuboidVolumeBuilder::VolumeConfig volume;
+  volume.position = {30_cm, 0., 0.};
+  volume.length   = {70_cm, 60_cm, 60_cm};
+  volume.name     = "Telescope";
+  for (int plane = 1; plane <= 6; ++plane) {
+    Acts::CuboidVolumeBuilder::SurfaceConfig surface;
+    surface.position = {plane * 10_cm, 0., 0.};
+    // local z along the telescope axis
+    surface.rotation.col(0) = Acts::Vector3(0., 0., 1.);
+    surface.rotation.col(1) = Acts::Vector3(0., 1., 0.);
+    surface.rotation.col(2) = Acts::Vector3(-1., 0., 0.);
+    surface.rBounds         = std::make_shared<const Acts::RectangleBounds>(25_cm, 25_cm);
+    surface.thickness       = 1_um;
+
+    Acts::CuboidVolumeBuilder::LayerConfig layer;
+    layer.surfaceCfg = {surface};
+    layer.active     = true;
+    volume.layerCfg.push_back(layer);
+  }
+
+  Acts::CuboidVolumeBuilder::Config cfg;
+  cfg.position  = volume.position;
+  cfg.length    = volume.length;
+  cfg.volumeCfg = {volume};
+  Acts::CuboidVolumeBuilder builder(cfg);
+
+  Acts::TrackingGeometryBuilder::Config geometry_cfg;
+  geometry_cfg.trackingVolumeBuilders.push_back(
+      [=](const auto& gctx, const auto& inner, const auto&) {
+        return builder.trackingVolume(gctx, inner, nullptr);
+      });
+  Acts::TrackingGeometryBuilder geometry_builder(geometry_cfg);
+
+  auto provider = std::make_shared<ActsGeometryProvider>();
+  provider->initialize(
+      std::shared_ptr<const Acts::TrackingGeometry>(
+          geometry_builder.trackingGeometry(provider->getActsGeometryContext())),
+      std::make_shared<Acts::ConstantBField>(Acts::Vector3(0., 0., 0.)));
+  return provider;
+}
+
+} // namespace
+
+TEST_CASE("CKFTracking finds the same tracks with several threads", "[CKFTracking]") {
+  const auto provider = makeTelescope();
+  algorithms::ActsSvc::instance().init(provider);
+  const auto& gctx = provider->getActsGeometryContext();
+
+  std::vector<const Acts::Surface*> surfaces;
+  provider->trackingGeometry()->visitSurfaces(
+      [&](const Acts::Surface* surface) { surfaces.push_back(surface); });
+  REQUIRE(surfaces.size() == 6);
+
+  // Straight tracks from the origin toward the planes, with a measurement on every plane
+  edm4eic::TrackParametersCollection params;
+  edm4eic::TrackSeedCollection seeds;
+  edm4eic::Measurement2DCollection measurements;
+  const std::size_t num_tracks = 40;
+  for (std::size_t track = 0; track < num_tracks; ++track) {
+    const double phi   = -0.2 + 0.4 * (track + 0.5) / num_tracks;
+    const double theta =
+        std::numbers::pi / 2 - 0.2 + 0.4 * ((track * 17) % num_tracks) / num_tracks;
+    const Acts::Vector3 direction(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi),
+                                  std::cos(theta));
+
+    for (const auto* surface : surfaces) {
+      const Acts::Transform3& transform = surface->transform(gctx);
+      const Acts::Vector3 origin        = transform.inverse() * Acts::Vector3::Zero();
+      const Acts::Vector3 local_dir     = transform.linear().transpose() * direction;
+      const Acts::Vector3 local         = origin - origin.z() / local_dir.z() * local_dir;
+      auto measurement                  = measurements.create();
+      measurement.setSurface(surface->geometryId().value());
+      measurement.setLoc({static_cast<float>(local.x()), static_cast<float>(local.y())});
+      measurement.setCovariance({0.01, 0.01, 1., 0.});
+    }
+
+    auto param = params.create();
+    param.setType(-1);
+    param.setLoc({0.F, 0.F});
+    param.setPhi(phi);
+    param.setTheta(theta);
+    param.setQOverP((track % 2 == 0 ? 1. : -1.) / 2.); // 2 GeV
+    param.setTime(0.F);
+    edm4eic::Cov6f cov;
+    cov(0, 0) = 0.01;
+    cov(1, 1) = 0.01;
+    cov(2, 2) = 1e-4;
+    cov(3, 3) = 1e-4;
+    cov(4, 4) = 0.1;
+    cov(5, 5) = 10e9;
+    param.setCovariance(cov);
+
+    auto seed = seeds.create();
+    seed.setPerigee({0.F, 0.F, 0.F});
+    seed.setParams(param);
+  }
+  const eicrecon::MeasurementSourceLinkIndex source_links(measurements);
+
+  struct Track {
+    unsigned int seed;
+    std::size_t num_measurements;
+    Acts::BoundVector parameters;
+  };
+  auto find_tracks = [&](std::size_t num_threads) {
+    eicrecon::CKFTrackingConfig cfg;
+    cfg.numThreads = num_threads;
+    eicrecon::CKFTracking algo("CKFTracking");
+    algo.applyConfig(cfg);
+    algo.init();
+
+    Acts::ConstVectorMultiTrajectory* track_states = nullptr;
+    Acts::ConstVectorTrackContainer* tracks        = nullptr;
+    algo.process({&seeds, &measurements, &source_links}, {&track_states, &tracks});
+    std::unique_ptr<Acts::ConstVectorMultiTrajectory> track_states_owner(track_states);
+    std::unique_ptr<Acts::ConstVectorTrackContainer> tracks_owner(tracks);
+
+    Acts::ConstProxyAccessor<unsigned int> seed_number("seed");
+    std::vector<Track> found;
+    for (const auto& track : eicrecon::makeConstTrackContainerView(*tracks, *track_states)) {
+      found.push_back({seed_number(track), track.nMeasurements(), track.parameters()});
+    }
+    return found;
+  };
+
+  const auto expected = find_tracks(1);
+  REQUIRE(!expected.empty());
+
+  for (std::size_t num_threads : {2, 3, 8}) {
+    CAPTURE(num_threads);
+    const auto tracks = find_tracks(num_threads);
+    REQUIRE(tracks.size() == expected.size());
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+      REQUIRE(tracks[i].seed == expected[i].seed);
+      REQUIRE(tracks[i].num_measurements == expected[i].num_measurements);
+      REQUIRE(tracks[i].parameters == expected[i].parameters);
+    }
+  }
+}
+
+TEST_CASE("CKFTracking is only built for the eigen and sympy steppers", "[CKFTracking]") {
+  algorithms::ActsSvc::instance().init(makeTelescope());
+
+  for (auto stepper : {eicrecon::StepperType::eigen, eicrecon::StepperType::sympy}) {
+    eicrecon::CKFTrackingConfig cfg;
+    cfg.stepper = stepper;
+    eicrecon::CKFTracking algo("CKFTracking");
+    algo.applyConfig(cfg);
+    REQUIRE_NOTHROW(algo.init());
+  }
+  for (auto stepper : {eicrecon::StepperType::atlas, eicrecon::StepperType::straight_line}) {
+    eicrecon::CKFTrackingConfig cfg;
+    cfg.stepper = stepper;
+    eicrecon::CKFTracking algo("CKFTracking");
+    algo.applyConfig(cfg);
+    REQUIRE_THROWS_AS(algo.init(), std::invalid_argument);
+  }
+}
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "algorithms/tracking/SeedFitKernels.h"
+
+using namespace eicrecon;
+
+namespace {
+
+// The scalar fits previously in TrackSeeding, as reference
+
+std::tuple<float, float, float> circleFit(std::vector<std::pair<float, float>>& positions) {
+  double meanX  = 0;
+  double meanY  = 0;
+  double weight = 0;
+  for (const auto& [x, y] : positions) {
+    meanX += x;
+    meanY += y;
+    ++weight;
+  }
+  meanX /= weight;
+  meanY /= weight;
+
+  double Mxx = 0;
+  double Myy = 0;
+  double Mxy = 0;
+  double Mxz = 0;
+  double Myz = 0;
+  double Mzz = 0;
+  for (auto& [x, y] : positions) {
+    double Xi = x - meanX;
+    double Yi = y - meanY;
+    double Zi = std::pow(Xi, 2) + std::pow(Yi, 2);
+    Mxy += Xi * Yi;
+    Mxx += Xi * Xi;
+    Myy += Yi * Yi;
+    Mxz += Xi * Zi;
+    Myz += Yi * Zi;
+    Mzz += Zi * Zi;
+  }
+  Mxx /= weight;
+  Myy /= weight;
+  Mxy /= weight;
+  Mxz /= weight;
+  Myz /= weight;
+  Mzz /= weight;
+
+  const double Mz     = Mxx + Myy;
+  const double Cov_xy = Mxx * Myy - Mxy * Mxy;
+  const double Var_z  = Mzz - Mz * Mz;
+  const double A3     = 4 * Mz;
+  const double A2     = -3 * Mz * Mz - Mzz;
+  const double A1     = Var_z * Mz + 4 * Cov_xy * Mz - Mxz * Mxz - Myz * Myz;
+  const double A0  = Mxz * (Mxz * Myy - Myz * Mxy) + Myz * (Myz * Mxx - Mxz * Mxy) - Var_z * Cov_xy;
+  const double A22 = A2 + A2;
+  const double A33 = A3 + A3 + A3;
+
+  static constexpr int iter_max = 99;
+  double x                      = 0;
+  double y                      = A0;
+  for (int iter = 0; iter < iter_max; ++iter) {
+    const double Dy   = A1 + x * (A22 + A33 * x);
+    const double xnew = x - y / Dy;
+    if ((xnew == x) || (!std::isfinite(xnew))) {
+      break;
+    }
+    const double ynew = A0 + xnew * (A1 + xnew * (A2 + xnew * A3));
+    if (std::abs(ynew) >= std::abs(y)) {
+      break;
+    }
+    x = xnew;
+    y = ynew;
+  }
+
+  const double DET     = std::pow(x, 2) - x * Mz + Cov_xy;
+  const double Xcenter = (Mxz * (Myy - x) - Myz * Mxy) / DET / 2;
+  const double Ycenter = (Myz * (Mxx - x) - Mxz * Mxy) / DET / 2;
+
+  float X0 = Xcenter + meanX;
+  float Y0 = Ycenter + meanY;
+  float R  = std::sqrt(std::pow(Xcenter, 2) + std::pow(Ycenter, 2) + Mz);
+  return std::make_tuple(R, X0, Y0);
+}
+
+std::tuple<float, float> lineFit(std::vector<std::pair<float, float>>& positions) {
+  double xsum  = 0;
+  double x2sum = 0;
+  double ysum  = 0;
+  double xysum = 0;
+  for (const auto& [r, z] : positions) {
+    xsum  = xsum + r;
+    ysum  = ysum + z;
+    x2sum = x2sum + std::pow(r, 2);
+    xysum = xysum + r * z;
+  }
+  const auto npts          = positions.size();
+  const double denominator = (x2sum * npts - std::pow(xsum, 2));
+  const float a            = (xysum * npts - xsum * ysum) / denominator;
+  const float b            = (x2sum * ysum - xsum * xysum) / denominator;
+  return std::make_tuple(a, b);
+}
+
+/// Same operations, up to floating point contraction differences between the two loops
+void requireSame(float value, float expected) {
+  REQUIRE_THAT(value, Catch::Matchers::WithinRel(expected, 1e-4F) ||
+                          Catch::Matchers::WithinAbs(expected, 1e-4F));
+}
+
+} // namespace
+
+TEST_CASE("Batched seed fits match the scalar fits", "[SeedFitKernels]") {
+  // seed counts exercising full and partial blocks
+  const std::size_t n_seeds = GENERATE(0, 1, 15, 16, 17, 100);
+  std::mt19937 rng(n_seeds);
+  std::uniform_real_distribution<float> angle(-std::numbers::pi, std::numbers::pi);
+  // above half of the largest hit radius (~360), so that all hits lie on the circle
+  std::uniform_real_distribution<float> radius(200., 5000.);
+  std::uniform_real_distribution<float> cot(-3., 3.);
+
+  seed_fit::Triplets triplets;
+  for (std::size_t i = 0; i < n_seeds; ++i) {
+    // hits on a circle through the origin, at increasing radii
+    const float R    = radius(rng);
+    const float phi0 = angle(rng);
+    const float c    = cot(rng);
+    std::array<std::array<float, 4>, 3> hits{};
+    for (std::size_t j = 0; j < 3; ++j) {
+      const float r   = 30.F + 150.F * j + 10.F * angle(rng);
+      const float s   = 2.F * R * std::asin(r / (2.F * R));
+      const float phi = phi0 + s / R;
+      const float x   = R * (std::sin(phi) - std::sin(phi0));
+      const float y   = -R * (std::cos(phi) - std::cos(phi0));
+      hits[j]         = {x, y, s * c, std::hypot(x, y)};
+    }
+    triplets.push_back(hits);
+  }
+  REQUIRE(triplets.size() == n_seeds);
+
+  seed_fit::Circles circles;
+  seed_fit::Lines lines;
+  seed_fit::circle_fit(triplets, circles);
+  seed_fit::line_fit(triplets, lines);
+  REQUIRE(circles.R.size() == n_seeds);
+  REQUIRE(lines.slope.size() == n_seeds);
+
+  for (std::size_t i = 0; i < n_seeds; ++i) {
+    std::vector<std::pair<float, float>> xy;
+    std::vector<std::pair<float, float>> rz;
+    for (std::size_t j = 0; j < 3; ++j) {
+      const float x = triplets.x[j][i];
+      const float y = triplets.y[j][i];
+      xy.emplace_back(x, y);
+      rz.emplace_back(triplets.r[j][i], triplets.z[j][i]);
+    }
+    const auto [R, X0, Y0]        = circleFit(xy);
+    const auto [slope, intercept] = lineFit(rz);
+    requireSame(circles.R[i], R);
+    requireSame(circles.X0[i], X0);
+    requireSame(circles.Y0[i], Y0);
+    requireSame(lines.slope[i], slope);
+    requireSame(lines.intercept[i], intercept);
+  }
+}
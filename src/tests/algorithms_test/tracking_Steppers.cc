@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <Acts/Definitions/TrackParametrization.hpp>
+#include <Acts/Definitions/Units.hpp>
+#include <Acts/EventData/ParticleHypothesis.hpp>
+#include <Acts/MagneticField/ConstantBField.hpp>
+#include <Acts/Propagator/Propagator.hpp>
+#include <Acts/Surfaces/PerigeeSurface.hpp>
+#include <Acts/Surfaces/Surface.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numbers>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/ActsStepper.h"
+#include "algorithms/tracking/StepperType.h"
+
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+// Path length over which the tracks are propagated
+constexpr double path_length = 1_m;
+
+/// Fixed sample of pion tracks from the origin, spread in phi, theta, momentum and charge
+std::vector<Acts::BoundTrackParameters> makeTracks(std::size_t n_tracks) {
+  auto perigee = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3{0., 0., 0.});
+  std::vector<Acts::BoundTrackParameters> tracks;
+  for (std::size_t track = 0; track < n_tracks; ++track) {
+    const double phi    = 2. * std::numbers::pi * (track + 0.5) / n_tracks;
+    const double theta  = 0.3 + 2.5 * ((track * 37) % n_tracks + 0.5) / n_tracks;
+    const double p      = (0.5 + (track % 5)) * 1_GeV;
+    const double charge = (track % 2 == 0) ? 1. : -1.;
+    Acts::BoundVector params;
+    params << 0., 0., phi, theta, charge / p, 0.;
+    tracks.emplace_back(perigee, params, std::nullopt, Acts::ParticleHypothesis::pion());
+  }
+  return tracks;
+}
+
+/// Position of a track from the origin after `path_length`, on its helix in the field `bz`
+Acts::Vector3 helixPosition(const Acts::BoundTrackParameters& track, double bz) {
+  const double phi   = track.parameters()[Acts::eBoundPhi];
+  const double theta = track.parameters()[Acts::eBoundTheta];
+  const double s_t   = path_length * std::sin(theta);
+  const double z     = path_length * std::cos(theta);
+  if (bz == 0.) {
+    return {s_t * std::cos(phi), s_t * std::sin(phi), z};
+  }
+  // curvature of the transverse projection, clockwise for positive charges in a positive field
+  const double kappa = -track.charge() * bz / track.transverseMomentum();
+  return {(std::sin(phi + kappa * s_t) - std::sin(phi)) / kappa,
+          -(std::cos(phi + kappa * s_t) - std::cos(phi)) / kappa, z};
+}
+
+/// End positions of the tracks after `path_length`, propagated with the given stepper
+std::vector<Acts::Vector3> propagate(eicrecon::StepperType stepper_type,
+                                     std::shared_ptr<const Acts::MagneticFieldProvider> field,
+                                     const ActsGeometryProvider& geo,
+                                     const std::vector<Acts::BoundTrackParameters>& tracks) {
+  return eicrecon::withStepper(stepper_type, std::move(field), [&](auto stepper) {
+    using Propagator = Acts::Propagator<decltype(stepper)>;
+    Propagator propagator(std::move(stepper));
+    typename Propagator::template Options<> options(geo.getActsGeometryContext(),
+                                                    geo.getActsMagneticFieldContext());
+    options.pathLimit = path_length;
+
+    std::vector<Acts::Vector3> positions;
+    positions.reserve(tracks.size());
+    for (const auto& track : tracks) {
+      auto result = propagator.propagate(track, options);
+      positions.push_back(result.ok()
+                              ? result->endParameters->position(geo.getActsGeometryContext())
+                              : Acts::Vector3::Constant(std::numeric_limits<double>::quiet_NaN()));
+    }
+    return positions;
+  });
+}
+
+/// Largest distance of the end positions to the helix positions
+double maxResidual(const std::vector<Acts::BoundTrackParameters>& tracks,
+                   const std::vector<Acts::Vector3>& positions, double bz) {
+  double max_residual = 0.;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    const double residual = (positions[i] - helixPosition(tracks[i], bz)).norm();
+    // failed propagations make the result NaN
+    if (std::isnan(residual)) {
+      return residual;
+    }
+    max_residual = std::max(max_residual, residual);
+  }
+  return max_residual;
+}
+
+} // namespace
+
+TEST_CASE("Steppers follow the helix in a constant field", "[Steppers]") {
+  ActsGeometryProvider geo;
+  const auto tracks = makeTracks(50);
+
+  SECTION("Runge-Kutta-Nystrom steppers") {
+    const double bz = 1.7_T;
+    auto field      = std::make_shared<Acts::ConstantBField>(Acts::Vector3{0., 0., bz});
+    const auto stepper_type =
+        GENERATE(eicrecon::StepperType::eigen, eicrecon::StepperType::sympy,
+                 eicrecon::StepperType::atlas);
+    CAPTURE(stepper_type);
+    REQUIRE(maxResidual(tracks, propagate(stepper_type, field, geo, tracks), bz) < 0.1_mm);
+  }
+
+  SECTION("Straight line stepper without field") {
+    auto field = std::make_shared<Acts::ConstantBField>(Acts::Vector3{0., 0., 0.});
+    REQUIRE(maxResidual(tracks, propagate(eicrecon::StepperType::straight_line, field, geo, tracks),
+                        0.) < 1_um);
+  }
+}
+
+TEST_CASE("Stepper type names", "[Steppers]") {
+  const auto stepper_type =
+      GENERATE(eicrecon::StepperType::eigen, eicrecon::StepperType::sympy,
+               eicrecon::StepperType::atlas, eicrecon::StepperType::straight_line);
+  std::stringstream ss;
+  ss << stepper_type;
+  eicrecon::StepperType parsed{};
+  ss >> parsed;
+  REQUIRE(parsed == stepper_type);
+}
+
+// Not run by default: select with the "[.benchmark]" tag
+TEST_CASE("Steppers: benchmark", "[Steppers][.benchmark]") {
+  ActsGeometryProvider geo;
+  const auto tracks = makeTracks(1000);
+
+  for (auto stepper_type : {eicrecon::StepperType::eigen, eicrecon::StepperType::sympy,
+                            eicrecon::StepperType::atlas, eicrecon::StepperType::straight_line}) {
+    // the straight line stepper ignores the field, compare it to straight lines
+    const double bz = (stepper_type == eicrecon::StepperType::straight_line) ? 0. : 1.7_T;
+    auto field      = std::make_shared<Acts::ConstantBField>(Acts::Vector3{0., 0., bz});
+
+    std::stringstream name;
+    name << stepper_type;
+    std::cout << name.str() << " stepper, max residual after " << path_length / 1_m
+              << " m: " << maxResidual(tracks, propagate(stepper_type, field, geo, tracks), bz)
+              << " mm" << std::endl;
+    BENCHMARK(name.str() + " stepper, " + std::to_string(tracks.size()) + " tracks") {
+      return propagate(stepper_type, field, geo, tracks);
+    };
+  }
+}
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <Acts/Definitions/TrackParametrization.hpp>
+#include <Acts/Definitions/Units.hpp>
+#include <Acts/EventData/ParticleHypothesis.hpp>
+#include <Acts/EventData/TrackContainer.hpp>
+#include <Acts/EventData/TrackStatePropMask.hpp>
+#include <Acts/EventData/VectorMultiTrajectory.hpp>
+#include <Acts/EventData/VectorTrackContainer.hpp>
+#include <Acts/Geometry/CuboidVolumeBuilder.hpp>
+#include <Acts/Geometry/TrackingGeometry.hpp>
+#include <Acts/Geometry/TrackingGeometryBuilder.hpp>
+#include <Acts/MagneticField/ConstantBField.hpp>
+#include <Acts/Surfaces/CylinderSurface.hpp>
+#include <Acts/Surfaces/DiscSurface.hpp>
+#include <Acts/Surfaces/RectangleBounds.hpp>
+#include <Acts/Surfaces/Surface.hpp>
+#include <DD4hep/DD4hepUnits.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/TrackCollection.h>
+#include <edm4eic/TrackPoint.h>
+#include <edm4eic/TrackSegmentCollection.h>
+#include <edm4hep/utils/vector_utils.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <numbers>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/TrackPropagation.h"
+#include "algorithms/tracking/TrackPropagationConfig.h"
+
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Empty 10 m world around the origin, in a 1.7 T solenoid field
+std::shared_ptr<ActsGeometryProvider> makeWorld() {
+  Acts::CuboidVolumeBuilder::VolumeConfig volume;
+  volume.position = {0., 0., 0.};
+  volume.length   = {10_m, 10_m, 10_m};
+  volume.name     = "World";
+  // one plane away from all tracks, as the volume builder needs a layer
+  Acts::CuboidVolumeBuilder::SurfaceConfig surface;
+  surface.position        = {-4.5_m, 0., 0.};
+  surface.rotation.col(0) = Acts::Vector3(0., 0., 1.);
+  surface.rotation.col(1) = Acts::Vector3(0., 1., 0.);
+  surface.rotation.col(2) = Acts::Vector3(-1., 0., 0.);
+  surface.rBounds         = std::make_shared<const Acts::RectangleBounds>(10_cm, 10_cm);
+  surface.thickness       = 1_um;
+  Acts::CuboidVolumeBuilder::LayerConfig layer;
+  layer.surfaceCfg = {surface};
+  layer.active     = true;
+  volume.layerCfg.push_back(layer);
+
+  Acts::CuboidVolumeBuilder::Config cfg;
+  cfg.position  = volume.position;
+  cfg.length    = volume.length;
+  cfg.volumeCfg = {volume};
+  Acts::CuboidVolumeBuilder builder(cfg);
+
+  Acts::TrackingGeometryBuilder::Config geometry_cfg;
+  geometry_cfg.trackingVolumeBuilders.push_back(
+      [=](const auto& gctx, const auto& inner, const auto&) {
+        return builder.trackingVolume(gctx, inner, nullptr);
+      });
+  Acts::TrackingGeometryBuilder geometry_builder(geometry_cfg);
+
+  auto provider = std::make_shared<ActsGeometryProvider>();
+  provider->initialize(
+      std::shared_ptr<const Acts::TrackingGeometry>(
+          geometry_builder.trackingGeometry(provider->getActsGeometryContext())),
+      std::make_shared<Acts::ConstantBField>(Acts::Vector3(0., 0., 1.7_T)));
+  return provider;
+}
+
+struct Tracks {
+  std::unique_ptr<Acts::ConstVectorMultiTrajectory> states;
+  std::unique_ptr<Acts::ConstVectorTrackContainer> tracks;
+};
+
+/// Pion tracks with their last measurement on `surface`, a disc at z = `size` or a cylinder of
+/// radius `size`, where a straight line from the origin with polar angle between `theta_min`
+/// and `theta_max` crosses it
+Tracks makeTracks(std::size_t n_tracks, const std::shared_ptr<const Acts::Surface>& surface,
+                  double size, double theta_min, double theta_max) {
+  auto trackContainer      = std::make_shared<Acts::VectorTrackContainer>();
+  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  Acts::TrackContainer tracks(trackContainer, trackStateContainer);
+
+  const bool on_disc = surface->type() == Acts::Surface::Disc;
+  for (std::size_t i = 0; i < n_tracks; ++i) {
+    const double phi    = 2. * std::numbers::pi * (i + 0.5) / n_tracks - std::numbers::pi;
+    const double theta  = theta_min + (theta_max - theta_min) * ((i * 7) % n_tracks) / n_tracks;
+    const double p      = (1. + (i % 5) * 2.) * 1_GeV;
+    const double charge = (i % 2 == 0) ? 1. : -1.;
+
+    Acts::BoundVector params;
+    if (on_disc) {
+      // (r, phi) at the disc position z
+      params << size * std::tan(theta), phi, phi, theta, charge / p, 0.;
+    } else {
+      // (r phi, z) on the cylinder of radius r
+      params << size * phi, size / std::tan(theta), phi, theta, charge / p, 0.;
+    }
+    Acts::BoundSquareMatrix cov = Acts::BoundSquareMatrix::Identity() * 1e-6;
+    cov(Acts::eBoundTime, Acts::eBoundTime) = 1_ns * 1_ns;
+
+    auto track = tracks.makeTrack();
+    track.setReferenceSurface(surface);
+    track.parameters() = params;
+    track.covariance() = cov;
+    track.setParticleHypothesis(Acts::ParticleHypothesis::pion());
+    auto state = track.appendTrackState(Acts::TrackStatePropMask::Filtered);
+    state.setReferenceSurface(surface);
+    state.filtered()           = params;
+    state.filteredCovariance() = cov;
+    state.pathLength()         = size / std::sin(theta);
+  }
+  return {std::make_unique<Acts::ConstVectorMultiTrajectory>(std::move(*trackStateContainer)),
+          std::make_unique<Acts::ConstVectorTrackContainer>(std::move(*trackContainer))};
+}
+
+/// Track points of every track, keyed by the layer of their surface
+std::vector<std::map<std::uint64_t, edm4eic::TrackPoint>>
+propagate(const std::vector<eicrecon::SurfaceConfig>& surfaces, bool single_pass,
+          const Tracks& input) {
+  eicrecon::TrackPropagationConfig cfg;
+  cfg.target_surfaces         = surfaces;
+  cfg.single_pass_propagation = single_pass;
+  eicrecon::TrackPropagation algo("TrackPropagation");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  const edm4eic::TrackCollection tracks;
+  edm4eic::TrackSegmentCollection segments;
+  algo.process({&tracks, input.states.get(), input.tracks.get()}, {&segments});
+
+  std::vector<std::map<std::uint64_t, edm4eic::TrackPoint>> points;
+  for (const auto& segment : segments) {
+    auto& track_points = points.emplace_back();
+    for (const auto& point : segment.getPoints()) {
+      track_points.emplace(point.surface, point);
+    }
+  }
+  return points;
+}
+
+/// dRICH tracking planes: `n_planes` discs at equal steps inside a radiator from `zmin` to
+/// `zmax`, between the bore and the vessel
+std::vector<eicrecon::SurfaceConfig> radiatorPlanes(double zmin, double zmax, int n_planes) {
+  std::vector<eicrecon::SurfaceConfig> discs;
+  const double step = (zmax - zmin) / (n_planes + 1);
+  for (int i = 1; i <= n_planes; ++i) {
+    const double z = zmin + i * step;
+    discs.emplace_back(eicrecon::DiscSurfaceConfig{
+        .id = "MockTracker_ID", .zmin = z, .rmin = 0.05 * z, .rmax = 180. * dd4hep::cm});
+  }
+  return discs;
+}
+
+/// Calorimeter projection surfaces, laid out like the ePIC calorimeters: a front and a
+/// back surface for each of the barrel and endcap calorimeters, in front of them the DIRC
+std::vector<eicrecon::SurfaceConfig> calorimeterSurfaces() {
+  using eicrecon::CylinderSurfaceConfig;
+  using eicrecon::DiscSurfaceConfig;
+  const std::string id = "MockCalorimeter_ID";
+  const double cm      = dd4hep::cm;
+  return {
+      CylinderSurfaceConfig{.id = id, .rmin = 72. * cm, .zmin = -285. * cm, .zmax = 175. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = -174. * cm, .rmin = 0., .rmax = 70. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = -179. * cm, .rmin = 0., .rmax = 70. * cm},
+      CylinderSurfaceConfig{.id = id, .rmin = 76. * cm, .zmin = -465. * cm, .zmax = 465. * cm},
+      CylinderSurfaceConfig{.id = id, .rmin = 81. * cm, .zmin = -465. * cm, .zmax = 465. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = 355. * cm, .rmin = 0., .rmax = 210. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = 360. * cm, .rmin = 0., .rmax = 210. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = -395. * cm, .rmin = 0., .rmax = 290. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = -410. * cm, .rmin = 0., .rmax = 290. * cm},
+      CylinderSurfaceConfig{.id = id, .rmin = 188. * cm, .zmin = -410. * cm, .zmax = 410. * cm},
+      CylinderSurfaceConfig{.id = id, .rmin = 203. * cm, .zmin = -410. * cm, .zmax = 410. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = 380. * cm, .rmin = 0., .rmax = 290. * cm},
+      DiscSurfaceConfig{.id = id, .zmin = 395. * cm, .rmin = 0., .rmax = 290. * cm},
+  };
+}
+
+/// Compare the track points of single pass propagation to those of per-surface propagation
+void requireSamePoints(const std::vector<eicrecon::SurfaceConfig>& surfaces, const Tracks& input) {
+  const auto expected = propagate(surfaces, false, input);
+  const auto found    = propagate(surfaces, true, input);
+  REQUIRE(found.size() == expected.size());
+
+  std::size_t num_points = 0;
+  for (std::size_t track = 0; track < expected.size(); ++track) {
+    CAPTURE(track);
+    REQUIRE(found[track].size() == expected[track].size());
+    for (const auto& [surface, point] : expected[track]) {
+      CAPTURE(surface);
+      REQUIRE(found[track].contains(surface));
+      const auto& other = found[track].at(surface);
+      REQUIRE(edm4hep::utils::magnitude(other.position - point.position) < 0.2_mm);
+      REQUIRE(edm4hep::utils::magnitude(other.momentum - point.momentum) <
+              1e-3 * edm4hep::utils::magnitude(point.momentum));
+      REQUIRE(std::abs(other.pathlength - point.pathlength) < 0.2_mm);
+      ++num_points;
+    }
+  }
+  // the comparison is not vacuous
+  REQUIRE(num_points >= expected.size());
+}
+
+} // namespace
+
+TEST_CASE("Single pass propagation reaches the surfaces of per-surface propagation",
+          "[TrackPropagation]") {
+  algorithms::ActsSvc::instance().init(makeWorld());
+
+  SECTION("dRICH radiators") {
+    // last measurements on a forward tracker disc, in the dRICH acceptance
+    const double z = 1.8_m;
+    auto disc      = Acts::Surface::makeShared<Acts::DiscSurface>(
+        Acts::Transform3(Acts::Translation3(0., 0., z)), 0., 1_m);
+    const auto tracks = makeTracks(50, disc, z, 0.06, 0.45);
+    requireSamePoints(radiatorPlanes(195.5 * dd4hep::cm, 199.5 * dd4hep::cm, 5), tracks);
+    requireSamePoints(radiatorPlanes(201. * dd4hep::cm, 313. * dd4hep::cm, 10), tracks);
+  }
+
+  SECTION("Calorimeters") {
+    // last measurements on a barrel tracker layer, in all directions
+    const double r = 40_cm;
+    auto cylinder =
+        Acts::Surface::makeShared<Acts::CylinderSurface>(Acts::Transform3::Identity(), r, 1.5_m);
+    requireSamePoints(calorimeterSurfaces(), makeTracks(100, cylinder, r, 0.35, 2.8));
+  }
+}
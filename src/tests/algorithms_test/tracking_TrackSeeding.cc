@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <Acts/Definitions/Units.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/CovDiag3f.h>
+#include <edm4eic/TrackParametersCollection.h>
+#include <edm4eic/TrackSeedCollection.h>
+#include <edm4eic/TrackerHitCollection.h>
+#include <edm4hep/Vector3f.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <numbers>
+#include <string>
+#include <vector>
+
+#include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/OrthogonalTrackSeedingConfig.h"
+#include "algorithms/tracking/TrackSeeding.h"
+
+namespace {
+
+// Barrel layer radii [mm], close to the ePIC silicon vertex and barrel layers
+constexpr double layer_radii[] = {36., 48., 120., 270., 420.};
+
+/// Hits of `n_tracks` helices from the origin, spread in phi and theta, on all layers
+edm4eic::TrackerHitCollection makeHits(std::size_t n_tracks, double bFieldInZ) {
+  edm4eic::TrackerHitCollection hits;
+  for (std::size_t track = 0; track < n_tracks; ++track) {
+    const double phi0   = 2. * std::numbers::pi * (track + 0.5) / n_tracks;
+    const double cot    = -1. + 2. * ((track * 37) % n_tracks + 0.5) / n_tracks;
+    const double pt     = (1. + (track % 5)) * Acts::UnitConstants::GeV;
+    const double charge = (track % 2 == 0) ? 1. : -1.;
+    const double R      = pt / bFieldInZ; // [mm]
+    for (double r : layer_radii) {
+      // arc length s and position on the circle through the origin, with direction phi0
+      const double s     = 2. * R * std::asin(r / (2. * R));
+      const double phi_s = phi0 + charge * s / R;
+      const double x     = charge * R * (std::sin(phi_s) - std::sin(phi0));
+      const double y     = -charge * R * (std::cos(phi_s) - std::cos(phi0));
+      hits.create(0, edm4hep::Vector3f(x, y, s * cot), edm4eic::CovDiag3f{0.01, 0.01, 0.01}, 0.0,
+                  0.0, 1.0, 0.0);
+    }
+  }
+  return hits;
+}
+
+} // namespace
+
+TEST_CASE("TrackSeeding finds seeds of helices from the origin", "[TrackSeeding]") {
+  algorithms::ActsSvc::instance().init(std::make_shared<ActsGeometryProvider>());
+
+  eicrecon::OrthogonalTrackSeedingConfig cfg;
+  eicrecon::TrackSeeding algo("TrackSeeding");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  const auto hits = makeHits(10, cfg.bFieldInZ);
+
+  edm4eic::TrackSeedCollection seeds;
+  edm4eic::TrackParametersCollection params;
+  algo.process({&hits}, {&seeds, &params});
+
+  REQUIRE(seeds.size() > 0);
+  REQUIRE(seeds.size() == params.size());
+  for (const auto& seed : seeds) {
+    REQUIRE(seed.getHits().size() == 3);
+  }
+
+  // the persistent seed finder keeps no state between events
+  edm4eic::TrackSeedCollection seeds_again;
+  edm4eic::TrackParametersCollection params_again;
+  algo.process({&hits}, {&seeds_again, &params_again});
+  REQUIRE(seeds_again.size() == seeds.size());
+  for (std::size_t i = 0; i < seeds.size(); ++i) {
+    REQUIRE(params_again[i].getPhi() == params[i].getPhi());
+    REQUIRE(params_again[i].getTheta() == params[i].getTheta());
+    REQUIRE(params_again[i].getQOverP() == params[i].getQOverP());
+  }
+}
+
+TEST_CASE("TrackSeeding in phi sectors finds the same seeds", "[TrackSeeding]") {
+  algorithms::ActsSvc::instance().init(std::make_shared<ActsGeometryProvider>());
+
+  eicrecon::OrthogonalTrackSeedingConfig cfg;
+  const auto hits = makeHits(200, cfg.bFieldInZ);
+
+  // seeds as sorted hit index triplets, sorted
+  auto find_seeds = [&](std::size_t num_phi_sectors, std::size_t num_threads) {
+    cfg.numPhiSectors = num_phi_sectors;
+    cfg.numThreads    = num_threads;
+    eicrecon::TrackSeeding algo("TrackSeeding");
+    algo.applyConfig(cfg);
+    algo.init();
+
+    edm4eic::TrackSeedCollection seeds;
+    edm4eic::TrackParametersCollection params;
+    algo.process({&hits}, {&seeds, &params});
+
+    std::vector<std::array<int, 3>> triplets;
+    for (const auto& seed : seeds) {
+      std::array<int, 3> triplet{};
+      for (std::size_t i = 0; i < 3; ++i) {
+        triplet[i] = seed.getHits()[i].getObjectID().index;
+      }
+      std::sort(triplet.begin(), triplet.end());
+      triplets.push_back(triplet);
+    }
+    std::sort(triplets.begin(), triplets.end());
+    return triplets;
+  };
+
+  const auto expected = find_seeds(1, 1);
+  REQUIRE(!expected.empty());
+
+  // the first and last sectors meet at phi = +-pi, without overlapping across it: make sure
+  // that seeds with middle space points on both sides of the boundary are compared
+  auto has_seed_near = [&](double phi_boundary) {
+    return std::any_of(expected.begin(), expected.end(), [&](const auto& triplet) {
+      std::array<edm4hep::Vector3f, 3> positions;
+      for (std::size_t i = 0; i < 3; ++i) {
+        positions[i] = hits[triplet[i]].getPosition();
+      }
+      std::sort(positions.begin(), positions.end(), [](const auto& a, const auto& b) {
+        return std::hypot(a.x, a.y) < std::hypot(b.x, b.y);
+      });
+      const auto& middle = positions[1];
+      return std::abs(std::atan2(middle.y, middle.x) - phi_boundary) < cfg.deltaPhiMax;
+    });
+  };
+  REQUIRE(has_seed_near(std::numbers::pi));
+  REQUIRE(has_seed_near(-std::numbers::pi));
+  REQUIRE(find_seeds(8, 1) == expected);
+  REQUIRE(find_seeds(8, 4) == expected);
+  REQUIRE(find_seeds(13, 3) == expected);
+}
+
+TEST_CASE("TrackSeeding: benchmark", "[TrackSeeding][.benchmark]") {
+  algorithms::ActsSvc::instance().init(std::make_shared<ActsGeometryProvider>());
+
+  eicrecon::OrthogonalTrackSeedingConfig cfg;
+  eicrecon::TrackSeeding algo("TrackSeeding");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  // seeding throughput against hit multiplicity, repeated events with the same seed finder
+  for (std::size_t n_tracks : {10, 100, 300, 1000}) {
+    const auto hits = makeHits(n_tracks, cfg.bFieldInZ);
+    BENCHMARK("seeding " + std::to_string(hits.size()) + " hits") {
+      edm4eic::TrackSeedCollection seeds;
+      edm4eic::TrackParametersCollection params;
+      algo.process({&hits}, {&seeds, &params});
+      return seeds.size();
+    };
+  }
+}
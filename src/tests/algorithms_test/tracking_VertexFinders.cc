@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 ePIC Collaboration
+
+#include <Acts/Definitions/Algebra.hpp>
+#include <Acts/Definitions/TrackParametrization.hpp>
+#include <Acts/Definitions/Units.hpp>
+#include <Acts/EventData/ParticleHypothesis.hpp>
+#include <Acts/EventData/TrackContainer.hpp>
+#include <Acts/EventData/VectorMultiTrajectory.hpp>
+#include <Acts/EventData/VectorTrackContainer.hpp>
+#include <Acts/MagneticField/ConstantBField.hpp>
+#include <Acts/Surfaces/PerigeeSurface.hpp>
+#include <Acts/Surfaces/Surface.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <edm4eic/VertexCollection.h>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <utility>
+
+#include "algorithms/interfaces/ActsSvc.h"
+#include "algorithms/tracking/ActsGeometryProvider.h"
+#include "algorithms/tracking/IterativeVertexFinder.h"
+#include "algorithms/tracking/IterativeVertexFinderConfig.h"
+#include "algorithms/tracking/SecondaryVertexFinder.h"
+#include "algorithms/tracking/SecondaryVertexFinderConfig.h"
+
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+// Track parameter resolutions at the perigee
+constexpr double sigma_d0 = 20_um;
+constexpr double sigma_z0 = 30_um;
+
+struct Tracks {
+  std::unique_ptr<Acts::ConstVectorMultiTrajectory> states;
+  std::unique_ptr<Acts::ConstVectorTrackContainer> tracks;
+};
+
+/// `n_tracks` fitted pion tracks from a vertex on the beam line at `z`, in a 1.7 T field
+Tracks makeTracks(std::size_t n_tracks, double z, std::mt19937& rng) {
+  auto trackContainer      = std::make_shared<Acts::VectorTrackContainer>();
+  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  Acts::TrackContainer tracks(trackContainer, trackStateContainer);
+
+  auto perigee = Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3{0., 0., 0.});
+  std::normal_distribution<double> normal;
+  for (std::size_t i = 0; i < n_tracks; ++i) {
+    const double phi    = 2. * std::numbers::pi * (i + 0.5) / n_tracks;
+    const double theta  = 0.5 + 2. * ((i * 7) % n_tracks + 0.5) / n_tracks;
+    const double p      = (0.5 + (i % 4)) * 1_GeV;
+    const double charge = (i % 2 == 0) ? 1. : -1.;
+
+    auto track = tracks.makeTrack();
+    track.setReferenceSurface(perigee);
+    track.parameters() << sigma_d0 * normal(rng), z + sigma_z0 * normal(rng), phi, theta,
+        charge / p, 0.;
+    track.covariance()                                         = Acts::BoundSquareMatrix::Zero();
+    track.covariance()(Acts::eBoundLoc0, Acts::eBoundLoc0)     = sigma_d0 * sigma_d0;
+    track.covariance()(Acts::eBoundLoc1, Acts::eBoundLoc1)     = sigma_z0 * sigma_z0;
+    track.covariance()(Acts::eBoundPhi, Acts::eBoundPhi)       = 1e-6;
+    track.covariance()(Acts::eBoundTheta, Acts::eBoundTheta)   = 1e-6;
+    track.covariance()(Acts::eBoundQOverP, Acts::eBoundQOverP) = 1e-6 / (1_GeV * 1_GeV);
+    track.covariance()(Acts::eBoundTime, Acts::eBoundTime)     = 1_ns * 1_ns;
+    track.setParticleHypothesis(Acts::ParticleHypothesis::pion());
+    track.nMeasurements() = 6;
+  }
+  return {std::make_unique<Acts::ConstVectorMultiTrajectory>(std::move(*trackStateContainer)),
+          std::make_unique<Acts::ConstVectorTrackContainer>(std::move(*trackContainer))};
+}
+
+/// Geometry provider with only a solenoid field, which is all the vertex finders use
+std::shared_ptr<ActsGeometryProvider> makeFieldProvider() {
+  auto provider = std::make_shared<ActsGeometryProvider>();
+  provider->initialize(nullptr,
+                       std::make_shared<Acts::ConstantBField>(Acts::Vector3(0., 0., 1.7_T)));
+  return provider;
+}
+
+/// Whether one of the vertices is within `tolerance` of the beam line at `z`
+bool hasVertexAt(const edm4eic::VertexCollection& vertices, double z, double tolerance) {
+  for (const auto& vertex : vertices) {
+    const auto position = vertex.getPosition();
+    if (std::hypot(position.x, position.y, position.z - z) < tolerance) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+// The vertexing engines are built once in init(): run several events on the same instance
+TEST_CASE("IterativeVertexFinder finds the vertex of every event", "[VertexFinders]") {
+  algorithms::ActsSvc::instance().init(makeFieldProvider());
+
+  eicrecon::IterativeVertexFinderConfig cfg;
+  eicrecon::IterativeVertexFinder algo("IterativeVertexFinder");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  std::mt19937 rng(3);
+  const edm4eic::ReconstructedParticleCollection particles;
+  for (double z : {-40_mm, 0_mm, 25_mm}) {
+    CAPTURE(z);
+    const auto input = makeTracks(20, z, rng);
+    edm4eic::VertexCollection vertices;
+    algo.process({input.states.get(), input.tracks.get(), &particles}, {&vertices});
+    REQUIRE(!vertices.empty());
+    REQUIRE(hasVertexAt(vertices, z, 0.1_mm));
+  }
+}
+
+TEST_CASE("SecondaryVertexFinder finds the vertex of every event", "[VertexFinders]") {
+  algorithms::ActsSvc::instance().init(makeFieldProvider());
+
+  const bool is_primary = GENERATE(true, false);
+  CAPTURE(is_primary);
+  eicrecon::SecondaryVertexFinderConfig cfg;
+  cfg.isPrimary = is_primary;
+  eicrecon::SecondaryVertexFinder algo("SecondaryVertexFinder");
+  algo.applyConfig(cfg);
+  algo.init();
+
+  std::mt19937 rng(5);
+  const edm4eic::ReconstructedParticleCollection particles;
+  for (double z : {-40_mm, 0_mm, 25_mm}) {
+    CAPTURE(z);
+    // few tracks, since the secondary mode fits every pair
+    const auto input = makeTracks(6, z, rng);
+    edm4eic::VertexCollection vertices;
+    algo.process({&particles, input.states.get(), input.tracks.get()}, {&vertices});
+    REQUIRE(!vertices.empty());
+    REQUIRE(hasVertexAt(vertices, z, 0.5_mm));
+  }
+}
@@ -26,6 +26,7 @@
 
 #include "TrackPropagation.h"
 #include "TrackPropagationTest_processor.h"
+#include "algorithms/tracking/ConstTrackContainerView.h"
 #include "services/rootfile/RootFile_service.h"
 
 //------------------
@@ -84,11 +85,9 @@ void TrackPropagationTest_processor::Process(const std::shared_ptr<const JEvent>
     return;
   }
 
-  // Construct ConstTrackContainer from underlying containers
-  auto trackStateContainer =
-      std::make_shared<Acts::ConstVectorMultiTrajectory>(*track_states.front());
-  auto trackContainer = std::make_shared<Acts::ConstVectorTrackContainer>(*tracks.front());
-  ActsExamples::ConstTrackContainer track_container(trackContainer, trackStateContainer);
+  // View the underlying containers as a ConstTrackContainer, without copying them
+  auto track_container =
+      eicrecon::makeConstTrackContainerView(*tracks.front(), *track_states.front());
 
   // Iterate over tracks
   m_log->debug("Propagating through {} tracks", track_container.size());